@@ -245,6 +245,21 @@ struct lsquic_stream_if {
 /** By default, packets are paced */
 #define LSQUIC_DF_PACE_PACKETS      1
 
+/** By default, C255 key pairs are generated when CHLO is built */
+#define LSQUIC_DF_C255_POOL_SIZE    0
+
+/** By default, preconnected connections are kept alive for one minute */
+#define LSQUIC_DF_PRECONN_KEEPALIVE (60 * 1000 * 1000)
+
+/** By default, packet buffers and malo pages are allocated from the heap */
+#define LSQUIC_DF_MEM_ARENA         0
+
+/** By default, handshake state is kept for the lifetime of connection */
+#define LSQUIC_DF_COMPACT           0
+
+/** By default, idle connections do not hibernate */
+#define LSQUIC_DF_HIBERNATE_AFTER   0
+
 struct lsquic_engine_settings {
     /**
      * This is a bit mask wherein each bit corresponds to a value in
@@ -432,6 +447,73 @@ struct lsquic_engine_settings {
      */
     int             es_pace_packets;
 
+    /**
+     * If set to a non-zero value, client engine keeps a pool of this many
+     * pre-generated C255 key pairs.  The key pairs are used by the
+     * handshake instead of generating a new key pair when full CHLO is
+     * built, which shortens the time to first CHLO when many connections
+     * are created at once.  The pool is filled when the engine is created
+     * and is replenished at the end of @ref lsquic_engine_process_conns().
+     *
+     * The default value is @ref LSQUIC_DF_C255_POOL_SIZE.
+     */
+    unsigned        es_c255_pool_size;
+
+    /**
+     * Number of microseconds a connection created by
+     * @ref lsquic_engine_preconnect() is kept alive using PING frames
+     * while it waits to be claimed by @ref lsquic_engine_take_preconn().
+     * After that, the connection is allowed to time out (see
+     * @ref es_idle_conn_to).
+     *
+     * The default value is @ref LSQUIC_DF_PRECONN_KEEPALIVE.
+     */
+    unsigned long   es_preconn_keepalive;
+
+    /**
+     * If set to true, the engine carves packet buffers and pages for its
+     * small-object allocators out of large memory regions.  The regions
+     * are backed by huge pages when the OS allows it (MAP_HUGETLB or
+     * transparent huge pages), which reduces TLB misses when many
+     * packets are in flight.  Memory in the arena is reused, but it is
+     * not returned to the OS until the engine is destroyed; in
+     * particular, @ref lsquic_engine_trim_mem() has no effect.
+     *
+     * The default value is @ref LSQUIC_DF_MEM_ARENA.
+     */
+    int             es_mem_arena;
+
+    /**
+     * If set to true, connections release state that is not needed after
+     * the handshake: the copy of CHLO, compressed certificates, and other
+     * handshake messages.  Write buffers of streams that have nothing
+     * buffered are freed when the connection goes quiet.  The packet
+     * objects of all connections are allocated from one shared pool
+     * instead of one pool per connection.  This reduces the memory
+     * footprint of idle connections at a small CPU cost.
+     *
+     * Also see @ref lsquic_conn_get_mem_report().
+     *
+     * The default value is @ref LSQUIC_DF_COMPACT.
+     */
+    int             es_compact;
+
+    /**
+     * If set to a non-zero value, a connection that has had no streams
+     * other than its handshake and headers streams for this many
+     * microseconds hibernates: when it has nothing to send and nothing
+     * in flight, it compacts itself (see @ref es_compact) and releases
+     * its stream hash and its pool of packet objects.  Handshake keys,
+     * receive history, and HPACK state are kept, so the connection can
+     * still answer the peer.  Hibernating connection is woken up when it
+     * is ticked -- for instance, when a packet arrives or a PING is due
+     * -- or when it is used via @ref lsquic_conn_make_stream() and other
+     * stream functions.
+     *
+     * The default value is @ref LSQUIC_DF_HIBERNATE_AFTER.
+     */
+    unsigned long   es_hibernate_after;
+
 };
 
 /* Initialize `settings' to default values */
@@ -579,6 +661,60 @@ struct lsquic_hset_if
     void                (*hsi_discard_header_set)(void *hdr_set);
 };
 
+/**
+ * Built-in header set interface.  Set @ref ea_hsi_if to it to receive
+ * headers as they were sent, without conversion to HTTP/1.x: cookies are
+ * not concatenated and "Host" is not added.  The header set returned by
+ * @ref lsquic_stream_get_hset() is a pointer to struct lsquic_hset, which
+ * is examined using the functions below and freed using
+ * @ref lsquic_hset_destroy().  @ref ea_hsi_ctx is not used.
+ *
+ * The headers are validated the same way as when they are converted to
+ * HTTP/1.x.
+ */
+extern const struct lsquic_hset_if *const lsquic_hset_native_if;
+
+struct lsquic_hset;
+
+struct lsquic_hset_header
+{
+    const char         *name;
+    const char         *value;
+    unsigned            name_len;
+    unsigned            value_len;
+    /** Index of HPACK static table entry with this name or zero if not
+     * known.  It is always set for pseudo-headers.
+     */
+    unsigned            name_idx;
+};
+
+/** Number of headers in the set */
+unsigned
+lsquic_hset_count (const struct lsquic_hset *);
+
+/**
+ * Headers are returned in the order they were received.  Pseudo-headers
+ * come first.  NULL is returned at the end of the set.
+ */
+const struct lsquic_hset_header *
+lsquic_hset_first (const struct lsquic_hset *);
+
+const struct lsquic_hset_header *
+lsquic_hset_next (const struct lsquic_hset *,
+                                        const struct lsquic_hset_header *);
+
+/**
+ * Find the next header with name `name' after header `after'.  If `after'
+ * is NULL, search from the beginning of the set.
+ */
+const struct lsquic_hset_header *
+lsquic_hset_find (const struct lsquic_hset *,
+                  const struct lsquic_hset_header *after,
+                  const char *name, unsigned name_len);
+
+void
+lsquic_hset_destroy (struct lsquic_hset *);
+
 /* TODO: describe this important data structure */
 typedef struct lsquic_engine_api
 {
@@ -644,6 +780,40 @@ lsquic_engine_connect (lsquic_engine_t *, const struct sockaddr *local_sa,
                        void *peer_ctx, lsquic_conn_ctx_t *conn_ctx,
                        const char *hostname, unsigned short max_packet_size);
 
+/**
+ * Create a client connection ahead of time, before there are any requests
+ * to send to the peer.  The handshake is performed right away, but no
+ * user callbacks are called for the connection until it is claimed by
+ * @ref lsquic_engine_take_preconn().  While it waits, the connection is
+ * kept alive using PING frames for up to @ref es_preconn_keepalive
+ * microseconds.
+ *
+ * The arguments are the same as those of @ref lsquic_engine_connect(),
+ * except that there is no connection context.  To warm up connections to
+ * several origins, call this function once for each hostname/address pair.
+ *
+ * @retval  0   Connection has been created.
+ * @retval -1   Error occurred.
+ */
+int
+lsquic_engine_preconnect (lsquic_engine_t *, const struct sockaddr *local_sa,
+                          const struct sockaddr *peer_sa, void *peer_ctx,
+                          const char *hostname, unsigned short max_packet_size);
+
+/**
+ * Claim a connection created by @ref lsquic_engine_preconnect() to the
+ * peer `peer_sa' for `hostname'.  Connections whose handshake has already
+ * succeeded are preferred.  The connection is handed out as if it were
+ * just created by @ref lsquic_engine_connect(): `on_new_conn' is called
+ * and, if the handshake is already done, so is `on_hsk_done'.
+ *
+ * If no suitable preconnected connection is available, NULL is returned.
+ * In this case, call @ref lsquic_engine_connect() to create a new one.
+ */
+lsquic_conn_t *
+lsquic_engine_take_preconn (lsquic_engine_t *, const struct sockaddr *peer_sa,
+                            lsquic_conn_ctx_t *conn_ctx, const char *hostname);
+
 /**
  * Pass incoming packet to the QUIC engine.  This function can be called
  * more than once in a row.  After you add one or more packets, call
@@ -794,6 +964,35 @@ struct lsquic_http_headers
 int lsquic_stream_send_headers(lsquic_stream_t *s,
                                const lsquic_http_headers_t *h, int eos);
 
+/**
+ * A header template holds headers that are the same in many requests or
+ * responses, such as :method, :scheme, :authority, and user-agent.  The
+ * headers are validated and copied when the template is created: names
+ * must be lowercase and pseudo-headers must come first.
+ *
+ * On error, NULL is returned and errno is set.
+ */
+struct lsquic_hdr_tmpl *
+lsquic_hdr_tmpl_new (const lsquic_http_headers_t *);
+
+void
+lsquic_hdr_tmpl_destroy (struct lsquic_hdr_tmpl *);
+
+/**
+ * Send headers from template `tmpl' followed by the varying headers `h',
+ * such as :path and content-length.  `h' may be NULL.  Pseudo-headers from
+ * `h' are placed after the template's pseudo-headers.
+ *
+ * The template's encoded headers are kept and sent again without encoding
+ * for as long as the connection's HPACK dynamic table does not change.  A
+ * template may be used with any number of streams and connections, but by
+ * only one thread at a time.
+ */
+int
+lsquic_stream_send_headers_tmpl (lsquic_stream_t *s,
+                struct lsquic_hdr_tmpl *tmpl, const lsquic_http_headers_t *h,
+                int eos);
+
 /**
  * Get header set associated with the stream.  The header set is created by
  * @ref hsi_create_header_set() callback.  After this call, the ownership of
@@ -1062,6 +1261,15 @@ lsquic_engine_earliest_adv_tick (lsquic_engine_t *engine, int *diff);
 unsigned
 lsquic_engine_count_attq (lsquic_engine_t *engine, int from_now);
 
+/**
+ * Release cached packet and page buffers the engine is not using, down to
+ * the low watermark of each buffer pool.  The engine also does this by
+ * itself, gradually, releasing buffers that remained unused for a second.
+ * Call this function after a traffic spike to return memory sooner.
+ */
+void
+lsquic_engine_trim_mem (lsquic_engine_t *engine);
+
 enum LSQUIC_CONN_STATUS
 {
     LSCONN_ST_HSK_IN_PROGRESS,
@@ -1082,6 +1290,39 @@ enum LSQUIC_CONN_STATUS
 enum LSQUIC_CONN_STATUS
 lsquic_conn_status (lsquic_conn_t *, char *errbuf, size_t bufsz);
 
+/**
+ * Breakdown of memory used by a connection, in bytes.  Components that
+ * are embedded in the connection object are reported separately and are
+ * not included in `cmr_conn'.
+ */
+struct lsquic_conn_mem_report
+{
+    size_t  cmr_conn;           /* Connection object proper */
+    size_t  cmr_send_ctl;       /* Send controller, incl. pacer, congestion
+                                 * controller, and packets it holds.
+                                 */
+    size_t  cmr_rechist;        /* Receive history */
+    size_t  cmr_closed_streams; /* Sets of IDs of closed streams */
+    size_t  cmr_stream_hist;    /* Histories of closed streams (debug) */
+    size_t  cmr_packet_objs;    /* Per-connection packet allocator */
+    size_t  cmr_stream_hash;    /* Stream lookup table */
+    size_t  cmr_streams;        /* Streams and their buffers */
+    size_t  cmr_headers;        /* Headers stream incl. HPACK state */
+    size_t  cmr_handshake;      /* Crypto session and handshake state */
+    size_t  cmr_total;          /* Sum of all of the above */
+    /* The following are included in `cmr_streams': */
+    size_t  cmr_in_pinned;      /* Incoming packets kept by unread frames */
+    size_t  cmr_in_useful;      /* Stream data in those frames */
+};
+
+/**
+ * Fill out memory report for the connection.  Returns 0 on success and -1
+ * if the connection does not support it.
+ */
+int
+lsquic_conn_get_mem_report (const lsquic_conn_t *,
+                                        struct lsquic_conn_mem_report *);
+
 extern const char *const
 lsquic_ver2str[N_LSQVER];
 
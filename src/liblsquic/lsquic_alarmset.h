@@ -23,6 +23,7 @@ enum alarm_id {
     AL_ACK,
     AL_PING,
     AL_IDLE,
+    AL_HIBERNATE,
     MAX_LSQUIC_ALARMS
 };
 
@@ -33,6 +34,7 @@ enum alarm_id_bit {
     ALBIT_ACK       = 1 << AL_ACK,
     ALBIT_PING      = 1 << AL_PING,
     ALBIT_IDLE      = 1 << AL_IDLE,
+    ALBIT_HIBERNATE = 1 << AL_HIBERNATE,
 };
 
 
@@ -0,0 +1,253 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_arena.c -- Memory arena backed by large (huge page) regions.
+ *
+ * Each region is ARENA_REGION_SZ bytes and is aligned on its size, so that
+ * the kernel can back it with a single 2 MB huge page.  We first try to
+ * get an explicit huge page using MAP_HUGETLB.  This fails unless huge
+ * pages have been reserved by the administrator, in which case we map
+ * regular memory and ask for transparent huge pages using madvise().
+ *
+ * Pages are carved from the top of the current region down and buffers
+ * from the bottom up, so that pages stay 4 KB-aligned without wasting
+ * space on alignment of buffers.
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <sys/mman.h>
+#else
+#include <vc_compat.h>
+#endif
+
+#include "fiu-local.h"
+#include "lsquic_arena.h"
+
+#define LSQUIC_LOGGER_MODULE LSQLM_ENGINE
+#include "lsquic_logger.h"
+
+#define ARENA_PAGE_SZ 0x1000
+#define ARENA_BUF_ALIGN 64
+
+struct arena_region
+{
+    SLIST_ENTRY(arena_region)   ar_next;
+    char                       *ar_base;
+    int                         ar_huge;
+};
+
+struct arena_page
+{
+    SLIST_ENTRY(arena_page)     ap_next;
+};
+
+struct lsquic_arena
+{
+    SLIST_HEAD(, arena_region)  la_regions;
+    SLIST_HEAD(, arena_page)    la_free_pages;
+    /* Unused space in the current region is [la_cur, la_end) */
+    char                       *la_cur,
+                               *la_end;
+    unsigned                    la_n_regions,
+                                la_n_huge;
+    enum {
+        LA_NO_HUGETLB   = (1 << 0),     /* MAP_HUGETLB failed before */
+    }                           la_flags;
+};
+
+
+struct lsquic_arena *
+lsquic_arena_new (void)
+{
+    struct lsquic_arena *arena;
+
+    arena = calloc(1, sizeof(*arena));
+    if (!arena)
+        return NULL;
+
+    SLIST_INIT(&arena->la_regions);
+    SLIST_INIT(&arena->la_free_pages);
+    return arena;
+}
+
+
+#ifndef WIN32
+static int
+map_region (struct lsquic_arena *arena, struct arena_region *region)
+{
+    char *map, *base;
+
+#ifdef MAP_HUGETLB
+    if (!(arena->la_flags & LA_NO_HUGETLB))
+    {
+        map = mmap(NULL, ARENA_REGION_SZ, PROT_READ|PROT_WRITE,
+                            MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+        if (map != MAP_FAILED)
+        {
+            region->ar_base = map;
+            region->ar_huge = 1;
+            return 0;
+        }
+        LSQ_INFO("cannot map huge page region, fall back to regular pages");
+        arena->la_flags |= LA_NO_HUGETLB;
+    }
+#endif
+
+    /* Map twice as much and trim it so that the region is aligned */
+    map = mmap(NULL, ARENA_REGION_SZ * 2, PROT_READ|PROT_WRITE,
+                                        MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (map == MAP_FAILED)
+        return -1;
+    base = (char *) (((uintptr_t) map + ARENA_REGION_SZ - 1)
+                                        & ~(uintptr_t) (ARENA_REGION_SZ - 1));
+    if (base > map)
+        (void) munmap(map, base - map);
+    if (map + ARENA_REGION_SZ * 2 > base + ARENA_REGION_SZ)
+        (void) munmap(base + ARENA_REGION_SZ,
+                            map + ARENA_REGION_SZ * 2 - base - ARENA_REGION_SZ);
+#ifdef MADV_HUGEPAGE
+    (void) madvise(base, ARENA_REGION_SZ, MADV_HUGEPAGE);
+#endif
+    region->ar_base = base;
+    region->ar_huge = 0;
+    return 0;
+}
+
+
+static void
+unmap_region (struct arena_region *region)
+{
+    (void) munmap(region->ar_base, ARENA_REGION_SZ);
+}
+
+
+#else
+static int
+map_region (struct lsquic_arena *arena, struct arena_region *region)
+{
+    region->ar_base = VirtualAlloc(NULL, ARENA_REGION_SZ,
+                                    MEM_COMMIT|MEM_RESERVE, PAGE_READWRITE);
+    region->ar_huge = 0;
+    return region->ar_base ? 0 : -1;
+}
+
+
+static void
+unmap_region (struct arena_region *region)
+{
+    (void) VirtualFree(region->ar_base, 0, MEM_RELEASE);
+}
+
+
+#endif
+
+
+static int
+new_region (struct lsquic_arena *arena)
+{
+    struct arena_region *region;
+
+    fiu_return_on("arena/new_region", -1);
+
+    region = malloc(sizeof(*region));
+    if (!region)
+        return -1;
+
+    if (0 != map_region(arena, region))
+    {
+        free(region);
+        return -1;
+    }
+
+    SLIST_INSERT_HEAD(&arena->la_regions, region, ar_next);
+    arena->la_cur = region->ar_base;
+    arena->la_end = region->ar_base + ARENA_REGION_SZ;
+    ++arena->la_n_regions;
+    arena->la_n_huge += region->ar_huge;
+    LSQ_DEBUG("mapped region #%u at %p (huge: %d)", arena->la_n_regions,
+                                        region->ar_base, region->ar_huge);
+    return 0;
+}
+
+
+void *
+lsquic_arena_get_page (struct lsquic_arena *arena)
+{
+    struct arena_page *page;
+
+    page = SLIST_FIRST(&arena->la_free_pages);
+    if (page)
+    {
+        SLIST_REMOVE_HEAD(&arena->la_free_pages, ap_next);
+        return page;
+    }
+
+    if (arena->la_end - arena->la_cur < ARENA_PAGE_SZ)
+        if (0 != new_region(arena))
+            return NULL;
+
+    arena->la_end -= ARENA_PAGE_SZ;
+    return arena->la_end;
+}
+
+
+void
+lsquic_arena_put_page (struct lsquic_arena *arena, void *mem)
+{
+    struct arena_page *const page = mem;
+
+    assert(0 == ((uintptr_t) mem & (ARENA_PAGE_SZ - 1)));
+    SLIST_INSERT_HEAD(&arena->la_free_pages, page, ap_next);
+}
+
+
+void *
+lsquic_arena_alloc (struct lsquic_arena *arena, size_t size)
+{
+    char *buf;
+
+    assert(size <= ARENA_REGION_SZ);
+    size = (size + ARENA_BUF_ALIGN - 1) & ~(size_t) (ARENA_BUF_ALIGN - 1);
+
+    if ((size_t) (arena->la_end - arena->la_cur) < size)
+        if (0 != new_region(arena))
+            return NULL;
+
+    buf = arena->la_cur;
+    arena->la_cur += size;
+    return buf;
+}
+
+
+void
+lsquic_arena_destroy (struct lsquic_arena *arena)
+{
+    struct arena_region *region;
+
+    while ((region = SLIST_FIRST(&arena->la_regions)))
+    {
+        SLIST_REMOVE_HEAD(&arena->la_regions, ar_next);
+        unmap_region(region);
+        free(region);
+    }
+    free(arena);
+}
+
+
+size_t
+lsquic_arena_mem_used (const struct lsquic_arena *arena)
+{
+    return sizeof(*arena) + (size_t) arena->la_n_regions
+                        * (ARENA_REGION_SZ + sizeof(struct arena_region));
+}
+
+
+unsigned
+lsquic_arena_n_huge (const struct lsquic_arena *arena)
+{
+    return arena->la_n_huge;
+}
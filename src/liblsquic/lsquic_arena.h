@@ -0,0 +1,52 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_arena.h -- Memory arena backed by large (huge page) regions.
+ *
+ * The arena maps memory in large regions and carves 4 KB pages and
+ * packet-sized buffers out of them.  Keeping these allocations close
+ * together cuts down on TLB misses when many packets are in flight.
+ * When the OS allows it, regions are backed by huge pages.
+ *
+ * Pages can be returned to the arena and are reused.  Buffers are never
+ * returned: the caller is expected to cache them.  All memory is released
+ * when the arena is destroyed.
+ */
+
+#ifndef LSQUIC_ARENA_H
+#define LSQUIC_ARENA_H 1
+
+struct lsquic_arena;
+
+/* Size of a single region.  It is a multiple of the huge page size. */
+#define ARENA_REGION_SZ (2 * 1024 * 1024)
+
+struct lsquic_arena *
+lsquic_arena_new (void);
+
+/* Get a 4 KB-aligned page of 4 KB */
+void *
+lsquic_arena_get_page (struct lsquic_arena *);
+
+void
+lsquic_arena_put_page (struct lsquic_arena *, void *page);
+
+/* Allocate a 64-byte-aligned buffer.  `size' must not be larger than
+ * ARENA_REGION_SZ.  The buffer cannot be freed.
+ */
+void *
+lsquic_arena_alloc (struct lsquic_arena *, size_t size);
+
+void
+lsquic_arena_destroy (struct lsquic_arena *);
+
+size_t
+lsquic_arena_mem_used (const struct lsquic_arena *);
+
+/* Returns number of regions that are backed by huge pages.  This is only
+ * known when MAP_HUGETLB is used; with transparent huge pages, the kernel
+ * decides and this function does not count such regions.
+ */
+unsigned
+lsquic_arena_n_huge (const struct lsquic_arena *);
+
+#endif
@@ -0,0 +1,81 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_c255_pool.c -- Pool of pre-generated C255 (X25519) key pairs
+ *
+ * The pool is a stack: key pairs are handed out from the top and new key
+ * pairs are pushed on top.  Key material is wiped when it leaves the pool.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <openssl/crypto.h>
+#include <openssl/curve25519.h>
+
+#include "lsquic_c255_pool.h"
+
+#define LSQUIC_LOGGER_MODULE LSQLM_CRYPTO
+#include "lsquic_logger.h"
+
+
+int
+lsquic_c255_pool_init (struct c255_pool *pool, unsigned size)
+{
+    pool->cp_pairs = malloc(sizeof(pool->cp_pairs[0]) * size);
+    if (!pool->cp_pairs)
+        return -1;
+    pool->cp_count = 0;
+    pool->cp_size  = size;
+    return 0;
+}
+
+
+void
+lsquic_c255_pool_cleanup (struct c255_pool *pool)
+{
+    if (pool->cp_pairs)
+    {
+        OPENSSL_cleanse(pool->cp_pairs,
+                                sizeof(pool->cp_pairs[0]) * pool->cp_size);
+        free(pool->cp_pairs);
+        pool->cp_pairs = NULL;
+    }
+    pool->cp_count = 0;
+    pool->cp_size  = 0;
+}
+
+
+unsigned
+lsquic_c255_pool_refill (struct c255_pool *pool, unsigned max)
+{
+    struct c255_key_pair *pair;
+    unsigned n;
+
+    for (n = 0; n < max && pool->cp_count < pool->cp_size; ++n)
+    {
+        pair = &pool->cp_pairs[ pool->cp_count++ ];
+        X25519_keypair(pair->ckp_pub, pair->ckp_priv);
+    }
+
+    if (n)
+        LSQ_DEBUG("generated %u key pair%.*s; pool has %u out of %u", n,
+                            n != 1, "s", pool->cp_count, pool->cp_size);
+    return n;
+}
+
+
+int
+lsquic_c255_pool_get (struct c255_pool *pool, unsigned char priv_key[32],
+                                              unsigned char pub_key[32])
+{
+    struct c255_key_pair *pair;
+
+    if (pool->cp_count == 0)
+        return -1;
+
+    pair = &pool->cp_pairs[ --pool->cp_count ];
+    memcpy(priv_key, pair->ckp_priv, sizeof(pair->ckp_priv));
+    memcpy(pub_key, pair->ckp_pub, sizeof(pair->ckp_pub));
+    OPENSSL_cleanse(pair, sizeof(*pair));
+    return 0;
+}
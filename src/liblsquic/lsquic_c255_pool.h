@@ -0,0 +1,49 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_c255_pool.h -- Pool of pre-generated C255 (X25519) key pairs
+ *
+ * Generating a key pair is the most expensive part of building a full
+ * CHLO.  The engine keeps a pool of key pairs ready and refills it after
+ * it is done ticking connections, so that the handshake does not have to
+ * generate one inline.
+ */
+
+#ifndef LSQUIC_C255_POOL_H
+#define LSQUIC_C255_POOL_H 1
+
+struct c255_key_pair
+{
+    unsigned char   ckp_priv[32];
+    unsigned char   ckp_pub[32];
+};
+
+
+struct c255_pool
+{
+    struct c255_key_pair    *cp_pairs;
+    unsigned                 cp_count,  /* Number of ready key pairs */
+                             cp_size;   /* Capacity */
+};
+
+
+/* Return 0 on success, -1 on failure (malloc) */
+int
+lsquic_c255_pool_init (struct c255_pool *, unsigned size);
+
+void
+lsquic_c255_pool_cleanup (struct c255_pool *);
+
+/* Generate up to `max' new key pairs.  Returns number of key pairs
+ * generated.
+ */
+unsigned
+lsquic_c255_pool_refill (struct c255_pool *, unsigned max);
+
+/* Return 0 if key pair was taken from the pool, -1 if the pool is empty */
+int
+lsquic_c255_pool_get (struct c255_pool *, unsigned char priv_key[32],
+                                          unsigned char pub_key[32]);
+
+#define lsquic_c255_pool_count(pool) (+(pool)->cp_count)
+
+#endif
@@ -30,6 +30,7 @@ enum lsquic_conn_flags {
     LSCONN_TICKED         = (1 << 0),
     LSCONN_HAS_OUTGOING   = (1 << 1),
     LSCONN_HASHED         = (1 << 2),
+    LSCONN_PRECONN        = (1 << 3),   /* Preconnected, not handed out yet */
     LSCONN_HAS_PEER_SA    = (1 << 4),
     LSCONN_HAS_LOCAL_SA   = (1 << 5),
     LSCONN_HANDSHAKE_DONE = (1 << 6),
@@ -109,8 +110,7 @@ struct lsquic_conn
     lsquic_cid_t                 cn_cid;
     STAILQ_ENTRY(lsquic_conn)    cn_next_closed_conn;
     TAILQ_ENTRY(lsquic_conn)     cn_next_ticked;
-    TAILQ_ENTRY(lsquic_conn)     cn_next_out,
-                                 cn_next_hash;
+    TAILQ_ENTRY(lsquic_conn)     cn_next_out;
     const struct conn_iface     *cn_if;
     const struct parse_funcs    *cn_pf;
     struct attq_elem            *cn_attq_elem;
@@ -118,8 +118,8 @@ struct lsquic_conn
     lsquic_time_t                cn_last_ticked;
     enum lsquic_conn_flags       cn_flags;
     enum lsquic_version          cn_version;
-    unsigned                     cn_hash;
     unsigned short               cn_pack_size;
+    unsigned short               cn_batch_last; /* See seal_batch() */
     unsigned char                cn_local_addr[sizeof(struct sockaddr_in6)];
     union {
         unsigned char       buf[sizeof(struct sockaddr_in6)];
@@ -161,6 +161,9 @@ struct conn_stats {
         unsigned long       bytes;              /* Overall bytes in */
         unsigned long       headers_uncomp;     /* Sum of uncompressed header bytes */
         unsigned long       headers_comp;       /* Sum of compressed header bytes */
+        unsigned long       decrypt_cycles;     /* See lsquic_cycles() */
+        unsigned long       parse_usec;         /* Time spent parsing frames */
+        unsigned long       batches;            /* Batches of packets parsed */
     }                   in;
     struct {
         unsigned long       stream_data_sz;
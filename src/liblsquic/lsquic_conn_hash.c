@@ -1,5 +1,7 @@
 /* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
 #include <assert.h>
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/queue.h>
@@ -14,9 +16,11 @@
 #include "lsquic_logger.h"
 
 
-#define n_buckets(nbits) (1U << (nbits))
-#define conn_hash_mask(conn_hash) ((1 << (conn_hash)->ch_nbits) - 1)
-#define conn_hash_bucket_no(conn_hash, hash) (hash & conn_hash_mask(conn_hash))
+#define CONN_HASH_MIN_SLOTS 8
+
+/* Slot that is neither empty (NULL) nor in use */
+#define SLOT_DELETED ((struct lsquic_conn *) (uintptr_t) 1)
+#define SLOT_IN_USE(slot) ((uintptr_t) (slot)->chs_conn > 1)
 
 #if FULL_LOCAL_ADDR_SUPPORTED
 #define HASHBUF_SZ (2 + sizeof(((struct sockaddr_in6 *) 0)->sin6_addr))
@@ -25,36 +29,35 @@
 #endif
 
 
-static const unsigned char *
-conn2hash_by_cid (const struct lsquic_conn *lconn, unsigned char *buf,
-                                                                size_t *sz)
-{
-    *sz = sizeof(lconn->cn_cid);
-    return (unsigned char *) &lconn->cn_cid;
-}
-
-
+/* The address may not be aligned -- cn_local_addr is a byte array -- so it
+ * is copied before its fields are read.
+ */
 static void
 sockaddr2hash (const struct sockaddr *sa, unsigned char *buf, size_t *sz)
 {
-    if (sa->sa_family == AF_INET)
+    struct sockaddr generic;
+    struct sockaddr_in sa4;
+    struct sockaddr_in6 sa6;
+
+    memcpy(&generic, sa, sizeof(generic));
+    if (generic.sa_family == AF_INET)
     {
-        const struct sockaddr_in *const sa4 = (void *) sa;
-        memcpy(buf, &sa4->sin_port, 2);
+        memcpy(&sa4, sa, sizeof(sa4));
+        memcpy(buf, &sa4.sin_port, 2);
 #if FULL_LOCAL_ADDR_SUPPORTED
-        memcpy(buf + 2, &sa4->sin_addr, sizeof(sa4->sin_addr));
-        *sz = 2 + sizeof(sa4->sin_addr);
+        memcpy(buf + 2, &sa4.sin_addr, sizeof(sa4.sin_addr));
+        *sz = 2 + sizeof(sa4.sin_addr);
 #else
         *sz = 2;
 #endif
     }
     else
     {
-        const struct sockaddr_in6 *const sa6 = (void *) sa;
-        memcpy(buf, &sa6->sin6_port, 2);
+        memcpy(&sa6, sa, sizeof(sa6));
+        memcpy(buf, &sa6.sin6_port, 2);
 #if FULL_LOCAL_ADDR_SUPPORTED
-        memcpy(buf + 2, &sa6->sin6_addr, sizeof(sa6->sin6_addr));
-        *sz = 2 + sizeof(sa6->sin6_addr);
+        memcpy(buf + 2, &sa6.sin6_addr, sizeof(sa6.sin6_addr));
+        *sz = 2 + sizeof(sa6.sin6_addr);
 #else
         *sz = 2;
 #endif
@@ -62,33 +65,62 @@ sockaddr2hash (const struct sockaddr *sa, unsigned char *buf, size_t *sz)
 }
 
 
-static const unsigned char *
-conn2hash_by_addr (const struct lsquic_conn *lconn, unsigned char *buf,
-                                                                size_t *sz)
+static unsigned
+addr2hash (const struct conn_hash *conn_hash, const struct sockaddr *sa)
+{
+    unsigned char hash_buf[HASHBUF_SZ];
+    size_t hash_sz;
+
+    sockaddr2hash(sa, hash_buf, &hash_sz);
+    return XXH32(hash_buf, hash_sz, (uintptr_t) conn_hash);
+}
+
+
+static int
+addr_eq (const struct sockaddr *a, const struct sockaddr *b)
+{
+    unsigned char hash_buf[2][HASHBUF_SZ];
+    size_t hash_sz[2];
+
+    sockaddr2hash(a, hash_buf[0], &hash_sz[0]);
+    sockaddr2hash(b, hash_buf[1], &hash_sz[1]);
+    return hash_sz[0] == hash_sz[1]
+                        && 0 == memcmp(hash_buf[0], hash_buf[1], hash_sz[0]);
+}
+
+
+/* When hashing by address, the key is the address hash already */
+static unsigned
+key2hash (const struct conn_hash *conn_hash, uint64_t key)
 {
-    sockaddr2hash((struct sockaddr *) &lconn->cn_local_addr, buf, sz);
-    return buf;
+    if (conn_hash->ch_flags & CHF_USE_ADDR)
+        return (unsigned) key;
+    else
+        return XXH32(&key, sizeof(key), (uintptr_t) conn_hash);
+}
+
+
+static uint64_t
+conn2key (const struct conn_hash *conn_hash, const struct lsquic_conn *lconn)
+{
+    if (conn_hash->ch_flags & CHF_USE_ADDR)
+        return addr2hash(conn_hash,
+                            (const struct sockaddr *) lconn->cn_local_addr);
+    else
+        return lconn->cn_cid;
 }
 
 
 int
 conn_hash_init (struct conn_hash *conn_hash, enum conn_hash_flags flags)
 {
-    unsigned n;
-
     memset(conn_hash, 0, sizeof(*conn_hash));
-    conn_hash->ch_nbits = 1;  /* Start small */
-    conn_hash->ch_buckets = malloc(sizeof(conn_hash->ch_buckets[0]) *
-                                                n_buckets(conn_hash->ch_nbits));
-    if (!conn_hash->ch_buckets)
+    conn_hash->ch_n_slots = CONN_HASH_MIN_SLOTS;
+    conn_hash->ch_slots = calloc(conn_hash->ch_n_slots,
+                                            sizeof(conn_hash->ch_slots[0]));
+    if (!conn_hash->ch_slots)
         return -1;
-    for (n = 0; n < n_buckets(conn_hash->ch_nbits); ++n)
-        TAILQ_INIT(&conn_hash->ch_buckets[n]);
     conn_hash->ch_flags = flags;
-    if (flags & CHF_USE_ADDR)
-        conn_hash->ch_conn2hash = conn2hash_by_addr;
-    else
-        conn_hash->ch_conn2hash = conn2hash_by_cid;
     LSQ_INFO("initialized");
     return 0;
 }
@@ -97,19 +129,29 @@ conn_hash_init (struct conn_hash *conn_hash, enum conn_hash_flags flags)
 void
 conn_hash_cleanup (struct conn_hash *conn_hash)
 {
-    free(conn_hash->ch_buckets);
+    free(conn_hash->ch_slots);
 }
 
 
 struct lsquic_conn *
 conn_hash_find_by_cid (struct conn_hash *conn_hash, lsquic_cid_t cid)
 {
-    const unsigned hash = XXH32(&cid, sizeof(cid), (uintptr_t) conn_hash);
-    const unsigned buckno = conn_hash_bucket_no(conn_hash, hash);
-    struct lsquic_conn *lconn;
-    TAILQ_FOREACH(lconn, &conn_hash->ch_buckets[buckno], cn_next_hash)
-        if (lconn->cn_cid == cid)
-            return lconn;
+    const struct conn_hash_slot *slot;
+    unsigned idx, mask;
+
+    if (conn_hash->ch_last_hit && conn_hash->ch_last_hit->cn_cid == cid)
+        return conn_hash->ch_last_hit;
+
+    mask = conn_hash->ch_n_slots - 1;
+    for (idx = key2hash(conn_hash, cid) & mask;
+            (slot = &conn_hash->ch_slots[idx])->chs_conn;
+                idx = (idx + 1) & mask)
+        if (slot->chs_key == cid && slot->chs_conn != SLOT_DELETED)
+        {
+            conn_hash->ch_last_hit = slot->chs_conn;
+            return slot->chs_conn;
+        }
+
     return NULL;
 }
 
@@ -117,62 +159,70 @@ conn_hash_find_by_cid (struct conn_hash *conn_hash, lsquic_cid_t cid)
 struct lsquic_conn *
 conn_hash_find_by_addr (struct conn_hash *conn_hash, const struct sockaddr *sa)
 {
-    unsigned char hash_buf[HASHBUF_SZ][2];
-    struct lsquic_conn *lconn;
-    unsigned hash, buckno;
-    size_t hash_sz[2];
-
-    sockaddr2hash(sa, hash_buf[0], &hash_sz[0]);
-    hash = XXH32(hash_buf, hash_sz[0], (uintptr_t) conn_hash);
-    buckno = conn_hash_bucket_no(conn_hash, hash);
-    TAILQ_FOREACH(lconn, &conn_hash->ch_buckets[buckno], cn_next_hash)
-        if (lconn->cn_hash == hash)
-        {
-            sockaddr2hash((struct sockaddr *) lconn->cn_local_addr, hash_buf[1],
-                          &hash_sz[1]);
-            if (hash_sz[0] == hash_sz[1]
-                        && 0 == memcmp(hash_buf[0], hash_buf[1], hash_sz[0]))
-                return lconn;
-        }
+    const struct conn_hash_slot *slot;
+    unsigned hash, idx, mask;
+
+    hash = addr2hash(conn_hash, sa);
+    mask = conn_hash->ch_n_slots - 1;
+    for (idx = hash & mask;
+            (slot = &conn_hash->ch_slots[idx])->chs_conn;
+                idx = (idx + 1) & mask)
+        if (slot->chs_key == hash && slot->chs_conn != SLOT_DELETED
+                && addr_eq(sa,
+                    (const struct sockaddr *) slot->chs_conn->cn_local_addr))
+            return slot->chs_conn;
 
     return NULL;
 }
 
 
+/* Place connection into the first free slot in its probe sequence */
+static void
+place_conn (struct conn_hash *conn_hash, uint64_t key,
+                                                struct lsquic_conn *lconn)
+{
+    struct conn_hash_slot *slot;
+    unsigned idx, mask;
+
+    mask = conn_hash->ch_n_slots - 1;
+    for (idx = key2hash(conn_hash, key) & mask;
+            SLOT_IN_USE(slot = &conn_hash->ch_slots[idx]);
+                idx = (idx + 1) & mask)
+        ;
+    if (slot->chs_conn == SLOT_DELETED)
+        --conn_hash->ch_n_deleted;
+    slot->chs_key  = key;
+    slot->chs_conn = lconn;
+}
+
+
+/* Move connections to a new table of `n_slots' slots, dropping deleted
+ * slots.
+ */
 static int
-double_conn_hash_buckets (struct conn_hash *conn_hash)
-{
-    struct lsquic_conn_head *new_buckets, *new[2];
-    struct lsquic_conn *lconn;
-    unsigned n, old_nbits;
-    int idx;
-
-    old_nbits = conn_hash->ch_nbits;
-    LSQ_INFO("doubling number of buckets to %u", n_buckets(old_nbits + 1));
-    new_buckets = malloc(sizeof(conn_hash->ch_buckets[0])
-                                                * n_buckets(old_nbits + 1));
-    if (!new_buckets)
+rebuild_conn_hash (struct conn_hash *conn_hash, unsigned n_slots)
+{
+    struct conn_hash_slot *old_slots;
+    unsigned n, old_n_slots;
+
+    LSQ_INFO("rebuild hash with %u slots", n_slots);
+    old_slots = conn_hash->ch_slots;
+    old_n_slots = conn_hash->ch_n_slots;
+    conn_hash->ch_slots = calloc(n_slots, sizeof(conn_hash->ch_slots[0]));
+    if (!conn_hash->ch_slots)
     {
         LSQ_WARN("malloc failed: potential trouble ahead");
+        conn_hash->ch_slots = old_slots;
         return -1;
     }
+    conn_hash->ch_n_slots = n_slots;
+    conn_hash->ch_n_deleted = 0;
 
-    for (n = 0; n < n_buckets(old_nbits); ++n)
-    {
-        new[0] = &new_buckets[n];
-        new[1] = &new_buckets[n + n_buckets(old_nbits)];
-        TAILQ_INIT(new[0]);
-        TAILQ_INIT(new[1]);
-        while ((lconn = TAILQ_FIRST(&conn_hash->ch_buckets[n])))
-        {
-            TAILQ_REMOVE(&conn_hash->ch_buckets[n], lconn, cn_next_hash);
-            idx = (lconn->cn_hash >> old_nbits) & 1;
-            TAILQ_INSERT_TAIL(new[idx], lconn, cn_next_hash);
-        }
-    }
-    free(conn_hash->ch_buckets);
-    conn_hash->ch_nbits   = old_nbits + 1;
-    conn_hash->ch_buckets = new_buckets;
+    for (n = 0; n < old_n_slots; ++n)
+        if (SLOT_IN_USE(&old_slots[n]))
+            place_conn(conn_hash, old_slots[n].chs_key, old_slots[n].chs_conn);
+
+    free(old_slots);
     return 0;
 }
 
@@ -180,23 +230,27 @@ double_conn_hash_buckets (struct conn_hash *conn_hash)
 int
 conn_hash_add (struct conn_hash *conn_hash, struct lsquic_conn *lconn)
 {
-    unsigned char hash_buf[HASHBUF_SZ];
-    const unsigned char *key;
-    size_t key_sz;
-    unsigned hash, buckno;
-
-    key = conn_hash->ch_conn2hash(lconn, hash_buf, &key_sz);
-    hash = XXH32(key, key_sz, (uintptr_t) conn_hash);
-    if (conn_hash->ch_count >=
-                n_buckets(conn_hash->ch_nbits) * CONN_HASH_MAX_PER_BUCKET &&
-        conn_hash->ch_nbits < sizeof(hash) * 8 - 1                        &&
-        0 != double_conn_hash_buckets(conn_hash))
+    unsigned n_slots;
+
+    if ((conn_hash->ch_count + conn_hash->ch_n_deleted + 1)
+                                                * CONN_HASH_MAX_LOAD_DEN
+            > conn_hash->ch_n_slots * CONN_HASH_MAX_LOAD_NUM)
     {
+        /* Grow if at least half of the slots are in use; otherwise, just
+         * get rid of deleted slots.
+         */
+        n_slots = conn_hash->ch_n_slots;
+        if ((conn_hash->ch_count + 1) * 2 > n_slots)
+        {
+            if (n_slots > UINT_MAX / 2)
+                return -1;
+            n_slots <<= 1;
+        }
+        if (0 != rebuild_conn_hash(conn_hash, n_slots))
             return -1;
     }
-    buckno = conn_hash_bucket_no(conn_hash, hash);
-    lconn->cn_hash = hash;
-    TAILQ_INSERT_TAIL(&conn_hash->ch_buckets[buckno], lconn, cn_next_hash);
+
+    place_conn(conn_hash, conn2key(conn_hash, lconn), lconn);
     ++conn_hash->ch_count;
     return 0;
 }
@@ -205,17 +259,36 @@ conn_hash_add (struct conn_hash *conn_hash, struct lsquic_conn *lconn)
 void
 conn_hash_remove (struct conn_hash *conn_hash, struct lsquic_conn *lconn)
 {
-    const unsigned buckno = conn_hash_bucket_no(conn_hash, lconn->cn_hash);
-    TAILQ_REMOVE(&conn_hash->ch_buckets[buckno], lconn, cn_next_hash);
+    struct conn_hash_slot *slot;
+    unsigned idx, mask;
+
+    mask = conn_hash->ch_n_slots - 1;
+    for (idx = key2hash(conn_hash, conn2key(conn_hash, lconn)) & mask;
+            (slot = &conn_hash->ch_slots[idx])->chs_conn != lconn;
+                idx = (idx + 1) & mask)
+        assert(slot->chs_conn);
+
+    /* No probe sequence continues past an empty slot, so if the next slot
+     * is empty, this one can be emptied as well.
+     */
+    if (conn_hash->ch_slots[(idx + 1) & mask].chs_conn)
+    {
+        slot->chs_conn = SLOT_DELETED;
+        ++conn_hash->ch_n_deleted;
+    }
+    else
+        slot->chs_conn = NULL;
     --conn_hash->ch_count;
+
+    if (conn_hash->ch_last_hit == lconn)
+        conn_hash->ch_last_hit = NULL;
 }
 
 
 void
 conn_hash_reset_iter (struct conn_hash *conn_hash)
 {
-    conn_hash->ch_iter.cur_buckno = 0;
-    conn_hash->ch_iter.next_conn  = TAILQ_FIRST(&conn_hash->ch_buckets[0]);
+    conn_hash->ch_iter_idx = 0;
 }
 
 
@@ -230,16 +303,14 @@ conn_hash_first (struct conn_hash *conn_hash)
 struct lsquic_conn *
 conn_hash_next (struct conn_hash *conn_hash)
 {
-    struct lsquic_conn *lconn = conn_hash->ch_iter.next_conn;
-    while (!lconn)
+    const struct conn_hash_slot *slot;
+
+    while (conn_hash->ch_iter_idx < conn_hash->ch_n_slots)
     {
-        ++conn_hash->ch_iter.cur_buckno;
-        if (conn_hash->ch_iter.cur_buckno >= n_buckets(conn_hash->ch_nbits))
-            return NULL;
-        lconn = TAILQ_FIRST(&conn_hash->ch_buckets[
-                                            conn_hash->ch_iter.cur_buckno]);
+        slot = &conn_hash->ch_slots[ conn_hash->ch_iter_idx++ ];
+        if (SLOT_IN_USE(slot))
+            return slot->chs_conn;
     }
-    if (lconn)
-        conn_hash->ch_iter.next_conn = TAILQ_NEXT(lconn, cn_next_hash);
-    return lconn;
+
+    return NULL;
 }
@@ -1,43 +1,51 @@
 /* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
 /*
  * lsquic_conn_hash.h -- A hash of connections
+ *
+ * Connections are kept in an open-addressing table with linear probing.
+ * Each slot holds the key -- connection ID or, when hashing by address,
+ * hash of the local address -- next to the connection pointer, so that a
+ * lookup usually touches a single cache line of the table and does not
+ * touch the connection at all.
  */
 
 #ifndef LSQUIC_MC_SET_H
 #define LSQUIC_MC_SET_H
 
-#include <sys/queue.h>
+#include <stdint.h>
 
-/* Once we reach this many per bucket on average, double the number of
- * buckets and redistribute entries.
- *
- * This value should be a power of two for speed.
+/* Once this fraction of slots, including those of removed connections, is
+ * in use, the table is rebuilt.
  */
-#define CONN_HASH_MAX_PER_BUCKET 2
+#define CONN_HASH_MAX_LOAD_NUM 3
+#define CONN_HASH_MAX_LOAD_DEN 4
 
 struct lsquic_conn;
 struct sockaddr;
 
-TAILQ_HEAD(lsquic_conn_head, lsquic_conn);
-
 enum conn_hash_flags
 {
     CHF_USE_ADDR    = 1 << 0,
 };
 
 
+struct conn_hash_slot
+{
+    uint64_t                 chs_key;
+    struct lsquic_conn      *chs_conn;
+};
+
+
 struct conn_hash
 {
-    struct lsquic_conn_head *ch_buckets;
-    struct {
-        unsigned             cur_buckno;
-        struct lsquic_conn  *next_conn;
-    }                        ch_iter;
+    struct conn_hash_slot   *ch_slots;
+    /* Consecutive packets often belong to the same connection: */
+    struct lsquic_conn      *ch_last_hit;
+    unsigned                 ch_iter_idx;
     unsigned                 ch_count;
-    unsigned                 ch_nbits;
+    unsigned                 ch_n_deleted;
+    unsigned                 ch_n_slots;    /* Power of two */
     enum conn_hash_flags     ch_flags;
-    const unsigned char *  (*ch_conn2hash)(const struct lsquic_conn *,
-                                            unsigned char *, size_t *);
 };
 
 #define conn_hash_count(conn_hash) (+(conn_hash)->ch_count)
@@ -73,6 +81,7 @@ conn_hash_remove (struct conn_hash *, struct lsquic_conn *);
  *      while ((conn = conn_hash_next(hash)))
  *          { ... }
  *
+ * It is OK to remove the current connection while iterating.
  */
 void
 conn_hash_reset_iter (struct conn_hash *);
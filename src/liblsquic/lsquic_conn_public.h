@@ -35,6 +35,12 @@ struct lsquic_conn_public {
     struct lsquic_mm               *mm;
     struct headers_stream          *hs;
     struct lsquic_send_ctl         *send_ctl;
+    /* Bytes of incoming packets referenced by stream frames waiting to be
+     * read and bytes of stream data in those frames.  See
+     * lsquic_di_nocopy.c.
+     */
+    size_t                          in_pinned,
+                                    in_useful;
 #if LSQUIC_CONN_STATS
     struct conn_stats              *conn_stats;
 #endif
@@ -39,6 +39,17 @@
  * If average stream frame size is smaller than EFF_TINY_FRAME_SZ bytes,
  * (B) condition is true.  In addition, if there are more than EFF_MAX_HOLES
  * in the stream, this is also indicative of (B).
+ *
+ * A milder form of (B) is not caught by the checks above: a handful of
+ * small frames, each arriving in a packet that carries mostly other
+ * frames, can pin many times more memory than there is stream data if
+ * the application is slow to read.  To deal with this, we keep track of
+ * how many bytes of packets the frames reference.  Once this is more than
+ * COMPACT_RATIO times the amount of stream data, or more than
+ * COMPACT_MAX_PINNED bytes, small frames are compacted: their data is
+ * copied into shared buffers and the packets are released.  A shared
+ * buffer is wrapped into a packet object of its own, so that frames can
+ * keep referencing their data the usual way.
  */
 
 
@@ -47,6 +58,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/queue.h>
 
 #include "lsquic.h"
@@ -92,6 +104,23 @@
  */
 #define EFF_TINY_FRAME_SZ       64
 
+/* Do not compact until this many bytes are pinned.  After compaction, do
+ * not try again until this many more bytes are pinned.
+ */
+#define COMPACT_MIN_PINNED      (4 * QUIC_MAX_PACKET_SZ)
+
+/* Compact if more than this many bytes are pinned, whatever the ratio */
+#define COMPACT_MAX_PINNED      (32 * QUIC_MAX_PACKET_SZ)
+
+/* Compact if the number of pinned bytes exceeds the number of stream bytes
+ * by this factor.  A frame is copied if it is smaller than its packet by
+ * the same factor.
+ */
+#define COMPACT_RATIO           4
+
+/* Size of the buffer allocated using lsquic_mm_get_1370() */
+#define COPIES_BUF_SZ           1370
+
 
 TAILQ_HEAD(stream_frames_tailq, stream_frame);
 
@@ -103,6 +132,14 @@ struct nocopy_data_in
     struct lsquic_conn_public  *ncdi_conn_pub;
     uint64_t                    ncdi_byteage;
     uint64_t                    ncdi_fin_off;
+    /* Bytes of packets referenced by the frames; see frame_pinned(): */
+    size_t                      ncdi_pinned;
+    /* Value of ncdi_pinned after compaction, adjusted down as frames are
+     * read:
+     */
+    size_t                      ncdi_pinned_after;
+    /* Shared buffer that compacted frames are copied to: */
+    struct lsquic_packet_in    *ncdi_copies;
     uint32_t                    ncdi_stream_id;
     unsigned                    ncdi_n_frames;
     unsigned                    ncdi_n_holes;
@@ -143,12 +180,57 @@ data_in_nocopy_new (struct lsquic_conn_public *conn_pub, uint32_t stream_id)
     ncdi->ncdi_n_holes          = 0;
     ncdi->ncdi_cons_far         = 0;
     ncdi->ncdi_fin_off          = 0;
+    ncdi->ncdi_pinned           = 0;
+    ncdi->ncdi_pinned_after     = 0;
+    ncdi->ncdi_copies           = NULL;
     ncdi->ncdi_flags            = 0;
     LSQ_DEBUG("initialized");
     return &ncdi->ncdi_data_in;
 }
 
 
+#define DF_OFF(frame) (frame)->data_frame.df_offset
+#define DF_FIN(frame) (frame)->data_frame.df_fin
+#define DF_SIZE(frame) (frame)->data_frame.df_size
+#define DF_END(frame) (DF_OFF(frame) + DF_SIZE(frame))
+
+
+/* Number of bytes the frame keeps from being released.  Copied frames
+ * share a buffer and only count their own data.
+ */
+static size_t
+frame_pinned (const struct stream_frame *frame)
+{
+    if (frame->packet_in->pi_flags & PI_FRAME_COPIES)
+        return DF_SIZE(frame);
+    else
+        return lsquic_packet_in_mem_used(frame->packet_in);
+}
+
+
+static void
+add_frame_bytes (struct nocopy_data_in *ncdi, const struct stream_frame *frame)
+{
+    const size_t pinned = frame_pinned(frame);
+    ncdi->ncdi_pinned += pinned;
+    ncdi->ncdi_conn_pub->in_pinned += pinned;
+    ncdi->ncdi_conn_pub->in_useful += DF_SIZE(frame);
+}
+
+
+static void
+remove_frame_bytes (struct nocopy_data_in *ncdi,
+                                            const struct stream_frame *frame)
+{
+    const size_t pinned = frame_pinned(frame);
+    ncdi->ncdi_pinned -= pinned;
+    ncdi->ncdi_conn_pub->in_pinned -= pinned;
+    ncdi->ncdi_conn_pub->in_useful -= DF_SIZE(frame);
+    if (ncdi->ncdi_pinned_after > ncdi->ncdi_pinned)
+        ncdi->ncdi_pinned_after = ncdi->ncdi_pinned;
+}
+
+
 static void
 nocopy_di_destroy (struct data_in *data_in)
 {
@@ -157,19 +239,16 @@ nocopy_di_destroy (struct data_in *data_in)
     while ((frame = TAILQ_FIRST(&ncdi->ncdi_frames_in)))
     {
         TAILQ_REMOVE(&ncdi->ncdi_frames_in, frame, next_frame);
+        remove_frame_bytes(ncdi, frame);
         lsquic_packet_in_put(ncdi->ncdi_conn_pub->mm, frame->packet_in);
         lsquic_malo_put(frame);
     }
+    if (ncdi->ncdi_copies)
+        lsquic_packet_in_put(ncdi->ncdi_conn_pub->mm, ncdi->ncdi_copies);
     free(ncdi);
 }
 
 
-#define DF_OFF(frame) (frame)->data_frame.df_offset
-#define DF_FIN(frame) (frame)->data_frame.df_fin
-#define DF_SIZE(frame) (frame)->data_frame.df_size
-#define DF_END(frame) (DF_OFF(frame) + DF_SIZE(frame))
-
-
 #if LSQUIC_EXTRA_CHECKS
 static int
 frame_list_is_sane (const struct nocopy_data_in *ncdi)
@@ -373,6 +452,97 @@ set_eff_alert (struct nocopy_data_in *ncdi)
 }
 
 
+static int
+should_compact (const struct nocopy_data_in *ncdi)
+{
+    return ncdi->ncdi_pinned >= ncdi->ncdi_pinned_after + COMPACT_MIN_PINNED
+        && (ncdi->ncdi_pinned > ncdi->ncdi_byteage * COMPACT_RATIO
+            || ncdi->ncdi_pinned > COMPACT_MAX_PINNED);
+}
+
+
+/* Replace the current shared buffer with a new one */
+static struct lsquic_packet_in *
+new_copies_packet (struct nocopy_data_in *ncdi)
+{
+    struct lsquic_mm *const mm = ncdi->ncdi_conn_pub->mm;
+    struct lsquic_packet_in *packet_in;
+
+    packet_in = lsquic_mm_get_packet_in(mm);
+    if (!packet_in)
+        return NULL;
+
+    packet_in->pi_data = lsquic_mm_get_1370(mm);
+    if (!packet_in->pi_data)
+    {
+        lsquic_mm_put_packet_in(mm, packet_in);
+        return NULL;
+    }
+    packet_in->pi_flags = PI_OWN_DATA|PI_FRAME_COPIES;
+    packet_in->pi_refcnt = 1;   /* This is our reference */
+
+    if (ncdi->ncdi_copies)
+        lsquic_packet_in_put(mm, ncdi->ncdi_copies);
+    ncdi->ncdi_copies = packet_in;
+    return packet_in;
+}
+
+
+static void
+compact_frames (struct nocopy_data_in *ncdi)
+{
+    struct lsquic_mm *const mm = ncdi->ncdi_conn_pub->mm;
+    struct stream_frame *frame;
+    struct lsquic_packet_in *packet_in, *copies;
+    unsigned char *buf;
+    size_t pinned, before;
+    unsigned n_copied;
+
+    before = ncdi->ncdi_pinned;
+    n_copied = 0;
+    TAILQ_FOREACH(frame, &ncdi->ncdi_frames_in, next_frame)
+    {
+        packet_in = frame->packet_in;
+        /* Frame that is being read is skipped, as its data pointer is
+         * referenced by the reader.
+         */
+        if ((packet_in->pi_flags & PI_FRAME_COPIES)
+                || DF_SIZE(frame) == 0 || frame->data_frame.df_read_off)
+            continue;
+        pinned = lsquic_packet_in_mem_used(packet_in);
+        if ((size_t) DF_SIZE(frame) * COMPACT_RATIO > pinned)
+            continue;
+
+        copies = ncdi->ncdi_copies;
+        if (!copies || COPIES_BUF_SZ - copies->pi_data_sz < DF_SIZE(frame))
+        {
+            copies = new_copies_packet(ncdi);
+            if (!copies)
+            {
+                LSQ_INFO("cannot allocate buffer to compact frames");
+                break;
+            }
+        }
+
+        buf = copies->pi_data + copies->pi_data_sz;
+        memcpy(buf, frame->data_frame.df_data, DF_SIZE(frame));
+        copies->pi_data_sz += DF_SIZE(frame);
+        frame->data_frame.df_data = buf;
+        frame->packet_in = lsquic_packet_in_get(copies);
+        lsquic_packet_in_put(mm, packet_in);
+
+        ncdi->ncdi_pinned -= pinned - DF_SIZE(frame);
+        ncdi->ncdi_conn_pub->in_pinned -= pinned - DF_SIZE(frame);
+        ++n_copied;
+    }
+
+    ncdi->ncdi_pinned_after = ncdi->ncdi_pinned;
+    LSQ_DEBUG("compacted %u frame%.*s: pinned bytes %zu -> %zu; stream "
+        "bytes: %"PRIu64, n_copied, n_copied != 1, "s", before,
+        ncdi->ncdi_pinned, ncdi->ncdi_byteage);
+}
+
+
 static enum ins_frame
 nocopy_di_insert_frame (struct data_in *data_in,
                         struct stream_frame *new_frame, uint64_t read_offset)
@@ -390,8 +560,11 @@ nocopy_di_insert_frame (struct data_in *data_in,
     switch (ins)
     {
     case INS_FRAME_OK:
+        add_frame_bytes(ncdi, new_frame);
         if (check_efficiency(ncdi, count))
             set_eff_alert(ncdi);
+        else if (should_compact(ncdi))
+            compact_frames(ncdi);
         break;
     case INS_FRAME_DUP:
     case INS_FRAME_ERR:
@@ -446,6 +619,7 @@ nocopy_di_frame_done (struct data_in *data_in, struct data_frame *data_frame)
     }
     LSQ_DEBUG("frame (off: %"PRIu64", size: %u, fin: %d) done",
                                 DF_OFF(frame), DF_SIZE(frame), DF_FIN(frame));
+    remove_frame_bytes(ncdi, frame);
     lsquic_packet_in_put(ncdi->ncdi_conn_pub->mm, frame->packet_in);
     lsquic_malo_put(frame);
 }
@@ -477,6 +651,7 @@ nocopy_di_switch_impl (struct data_in *data_in, uint64_t read_offset)
         TAILQ_REMOVE(&ncdi->ncdi_frames_in, frame, next_frame);
         ins = data_in_hash_insert_data_frame(new_data_in, &frame->data_frame,
                                                                   read_offset);
+        remove_frame_bytes(ncdi, frame);
         lsquic_packet_in_put(ncdi->ncdi_conn_pub->mm, frame->packet_in);
         lsquic_malo_put(frame);
         if (INS_FRAME_ERR == ins)
@@ -501,14 +676,8 @@ static size_t
 nocopy_di_mem_used (struct data_in *data_in)
 {
     struct nocopy_data_in *const ncdi = NCDI_PTR(data_in);
-    const stream_frame_t *frame;
-    size_t size;
-
-    size = sizeof(*data_in);
-    TAILQ_FOREACH(frame, &ncdi->ncdi_frames_in, next_frame)
-        size += lsquic_packet_in_mem_used(frame->packet_in);
 
-    return size;
+    return sizeof(*data_in) + ncdi->ncdi_pinned;
 }
 
 
@@ -57,6 +57,7 @@
 #include "lsquic_attq.h"
 #include "lsquic_min_heap.h"
 #include "lsquic_http1x_if.h"
+#include "lsquic_c255_pool.h"
 
 #define LSQUIC_LOGGER_MODULE LSQLM_ENGINE
 #include "lsquic_logger.h"
@@ -69,11 +70,28 @@
 #define MIN_OUT_BATCH_SIZE 4
 #define INITIAL_OUT_BATCH_SIZE 32
 
+/* Maximum number of key pairs generated at the end of each call to
+ * lsquic_engine_process_conns().
+ */
+#define C255_POOL_REFILL_BATCH 8
+
 struct out_batch
 {
     lsquic_conn_t           *conns  [MAX_OUT_BATCH_SIZE];
     lsquic_packet_out_t     *packets[MAX_OUT_BATCH_SIZE];
     struct lsquic_out_spec   outs   [MAX_OUT_BATCH_SIZE];
+    /* Packets are sealed once the whole batch has been collected.  Until
+     * then, their headers are kept here.  Header size is positive if the
+     * packet is waiting to be sealed, zero if it is ready to be sent, and
+     * negative if sealing failed and the packet is to be dropped from the
+     * batch.
+     */
+    unsigned char            headers[MAX_OUT_BATCH_SIZE][QUIC_MAX_PUBHDR_SZ];
+    short                    header_sz[MAX_OUT_BATCH_SIZE];
+    /* Index of the next packet of the same connection or -1.  Set up by
+     * seal_batch().
+     */
+    short                    next_same[MAX_OUT_BATCH_SIZE];
 };
 
 typedef struct lsquic_conn * (*conn_iter_f)(struct lsquic_engine *);
@@ -138,6 +156,17 @@ force_close_conn (lsquic_engine_t *engine, lsquic_conn_t *conn);
 
 
 
+/* Connection created by lsquic_engine_preconnect() that has not been
+ * claimed yet.
+ */
+struct preconn
+{
+    TAILQ_ENTRY(preconn)               pc_next;
+    lsquic_conn_t                     *pc_conn;
+    char                               pc_hostname[0];
+};
+
+
 struct lsquic_engine
 {
     struct lsquic_engine_public        pub;
@@ -150,6 +179,7 @@ struct lsquic_engine
                                          * function went past time threshold.
                                          */
 #ifndef NDEBUG
+        ENG_CONST_BATCH = (1 << 25),    /* Out batch size does not change */
         ENG_DTOR        = (1 << 26),    /* Engine destructor */
 #endif
     }                                  flags;
@@ -179,6 +209,8 @@ struct lsquic_engine
     FILE                              *stats_fh;
 #endif
     struct out_batch                   out_batch;
+    struct c255_pool                   c255_pool;
+    TAILQ_HEAD(, preconn)              preconns;
 };
 
 
@@ -219,6 +251,11 @@ lsquic_engine_init_settings (struct lsquic_engine_settings *settings,
     settings->es_rw_once         = LSQUIC_DF_RW_ONCE;
     settings->es_proc_time_thresh= LSQUIC_DF_PROC_TIME_THRESH;
     settings->es_pace_packets    = LSQUIC_DF_PACE_PACKETS;
+    settings->es_c255_pool_size  = LSQUIC_DF_C255_POOL_SIZE;
+    settings->es_preconn_keepalive = LSQUIC_DF_PRECONN_KEEPALIVE;
+    settings->es_mem_arena       = LSQUIC_DF_MEM_ARENA;
+    settings->es_compact         = LSQUIC_DF_COMPACT;
+    settings->es_hibernate_after = LSQUIC_DF_HIBERNATE_AFTER;
 }
 
 
@@ -310,15 +347,17 @@ lsquic_engine_new (unsigned flags,
     engine = calloc(1, sizeof(*engine));
     if (!engine)
         return NULL;
-    if (0 != lsquic_mm_init(&engine->pub.enp_mm))
-    {
-        free(engine);
-        return NULL;
-    }
     if (api->ea_settings)
         engine->pub.enp_settings        = *api->ea_settings;
     else
         lsquic_engine_init_settings(&engine->pub.enp_settings, flags);
+    if (0 != (engine->pub.enp_settings.es_mem_arena
+                            ? lsquic_mm_init_arena(&engine->pub.enp_mm)
+                            : lsquic_mm_init(&engine->pub.enp_mm)))
+    {
+        free(engine);
+        return NULL;
+    }
     engine->pub.enp_flags = ENPUB_CAN_SEND;
 
     engine->flags           = flags;
@@ -354,6 +393,35 @@ lsquic_engine_new (unsigned flags,
     engine->attq = attq_create();
     eng_hist_init(&engine->history);
     engine->batch_size = INITIAL_OUT_BATCH_SIZE;
+#ifndef NDEBUG
+    {
+        const char *val;
+        int batch_size;
+        if ((val = getenv("LSQUIC_OUT_BATCH_SIZE")))
+        {
+            batch_size = atoi(val);
+            if (batch_size >= 1 && batch_size <= MAX_OUT_BATCH_SIZE)
+            {
+                engine->batch_size = batch_size;
+                engine->flags |= ENG_CONST_BATCH;
+            }
+        }
+    }
+#endif
+    TAILQ_INIT(&engine->preconns);
+    if (!(flags & ENG_SERVER) && engine->pub.enp_settings.es_c255_pool_size)
+    {
+        if (0 == lsquic_c255_pool_init(&engine->c255_pool,
+                                engine->pub.enp_settings.es_c255_pool_size))
+        {
+            (void) lsquic_c255_pool_refill(&engine->c255_pool,
+                                engine->pub.enp_settings.es_c255_pool_size);
+            engine->pub.enp_c255_pool = &engine->c255_pool;
+        }
+        else
+            LSQ_WARN("cannot allocate C255 key pool: keys will be "
+                                                    "generated on demand");
+    }
 
 #if LSQUIC_CONN_STATS
     engine->stats_fh = api->ea_stats_fh;
@@ -367,6 +435,10 @@ lsquic_engine_new (unsigned flags,
 static void
 grow_batch_size (struct lsquic_engine *engine)
 {
+#ifndef NDEBUG
+    if (engine->flags & ENG_CONST_BATCH)
+        return;
+#endif
     engine->batch_size <<= engine->batch_size < MAX_OUT_BATCH_SIZE;
 }
 
@@ -374,6 +446,10 @@ grow_batch_size (struct lsquic_engine *engine)
 static void
 shrink_batch_size (struct lsquic_engine *engine)
 {
+#ifndef NDEBUG
+    if (engine->flags & ENG_CONST_BATCH)
+        return;
+#endif
     engine->batch_size >>= engine->batch_size > MIN_OUT_BATCH_SIZE;
 }
 
@@ -400,6 +476,24 @@ update_stats_sum (struct lsquic_engine *engine, struct lsquic_conn *conn)
 #endif
 
 
+static void
+drop_preconn (struct lsquic_engine *engine, lsquic_conn_t *conn)
+{
+    struct preconn *preconn;
+
+    TAILQ_FOREACH(preconn, &engine->preconns, pc_next)
+        if (preconn->pc_conn == conn)
+        {
+            TAILQ_REMOVE(&engine->preconns, preconn, pc_next);
+            free(preconn);
+            LSQ_DEBUG("preconnected connection %"PRIu64" was not claimed",
+                                                                conn->cn_cid);
+            return;
+        }
+    assert(0);
+}
+
+
 /* Wrapper to make sure important things occur before the connection is
  * really destroyed.
  */
@@ -409,6 +503,8 @@ destroy_conn (struct lsquic_engine *engine, lsquic_conn_t *conn)
 #if LSQUIC_CONN_STATS
     update_stats_sum(engine, conn);
 #endif
+    if (conn->cn_flags & LSCONN_PRECONN)
+        drop_preconn(engine, conn);
     --engine->n_conns;
     conn->cn_flags |= LSCONN_NEVER_TICKABLE;
     conn->cn_if->ci_destroy(conn);
@@ -609,11 +705,14 @@ lsquic_engine_destroy (lsquic_engine_t *engine)
     conn_hash_cleanup(&engine->conns_hash);
 
     assert(0 == engine->n_conns);
+    assert(TAILQ_EMPTY(&engine->preconns));
     attq_destroy(engine->attq);
 
     assert(0 == lsquic_mh_count(&engine->conns_out));
     assert(0 == lsquic_mh_count(&engine->conns_tickable));
     lsquic_mm_cleanup(&engine->pub.enp_mm);
+    if (engine->pub.enp_c255_pool)
+        lsquic_c255_pool_cleanup(engine->pub.enp_c255_pool);
     free(engine->conns_tickable.mh_elems);
 #if LSQUIC_CONN_STATS
     if (engine->stats_fh)
@@ -657,26 +756,27 @@ lsquic_engine_destroy (lsquic_engine_t *engine)
 }
 
 
-lsquic_conn_t *
-lsquic_engine_connect (lsquic_engine_t *engine, const struct sockaddr *local_sa,
-                       const struct sockaddr *peer_sa,
-                       void *peer_ctx, lsquic_conn_ctx_t *conn_ctx, 
-                       const char *hostname, unsigned short max_packet_size)
+/* Create client connection and place it into the connection hash and the
+ * Tickable Queue.  User callbacks are not called.
+ */
+static lsquic_conn_t *
+create_client_conn (lsquic_engine_t *engine, const struct sockaddr *local_sa,
+                    const struct sockaddr *peer_sa, void *peer_ctx,
+                    const char *hostname, unsigned short max_packet_size)
 {
     lsquic_conn_t *conn;
-    ENGINE_IN(engine);
 
     if (engine->flags & ENG_SERVER)
     {
-        LSQ_ERROR("`%s' must only be called in client mode", __func__);
-        goto err;
+        LSQ_ERROR("client connections must only be created in client mode");
+        return NULL;
     }
 
     if (conn_hash_using_addr(&engine->conns_hash)
                 && conn_hash_find_by_addr(&engine->conns_hash, local_sa))
     {
         LSQ_ERROR("cannot have more than one connection on the same port");
-        goto err;
+        return NULL;
     }
 
     if (0 == max_packet_size)
@@ -694,14 +794,14 @@ lsquic_engine_connect (lsquic_engine_t *engine, const struct sockaddr *local_sa,
 
     conn = new_full_conn_client(engine, hostname, max_packet_size);
     if (!conn)
-        goto err;
+        return NULL;
     lsquic_conn_record_sockaddr(conn, local_sa, peer_sa);
     if (0 != conn_hash_add(&engine->conns_hash, conn))
     {
         LSQ_WARN("cannot add connection %"PRIu64" to hash - destroy",
             conn->cn_cid);
         destroy_conn(engine, conn);
-        goto err;
+        return NULL;
     }
     assert(!(conn->cn_flags &
         (CONN_REF_FLAGS
@@ -712,14 +812,165 @@ lsquic_engine_connect (lsquic_engine_t *engine, const struct sockaddr *local_sa,
     lsquic_mh_insert(&engine->conns_tickable, conn, conn->cn_last_ticked);
     engine_incref_conn(conn, LSCONN_TICKABLE);
     conn->cn_peer_ctx = peer_ctx;
+    return conn;
+}
+
+
+lsquic_conn_t *
+lsquic_engine_connect (lsquic_engine_t *engine, const struct sockaddr *local_sa,
+                       const struct sockaddr *peer_sa,
+                       void *peer_ctx, lsquic_conn_ctx_t *conn_ctx, 
+                       const char *hostname, unsigned short max_packet_size)
+{
+    lsquic_conn_t *conn;
+    ENGINE_IN(engine);
+
+    conn = create_client_conn(engine, local_sa, peer_sa, peer_ctx, hostname,
+                                                            max_packet_size);
+    if (conn)
+    {
+        lsquic_conn_set_ctx(conn, conn_ctx);
+        full_conn_client_call_on_new(conn);
+    }
+
+    ENGINE_OUT(engine);
+    return conn;
+}
+
+
+int
+lsquic_engine_preconnect (lsquic_engine_t *engine,
+                const struct sockaddr *local_sa, const struct sockaddr *peer_sa,
+                void *peer_ctx, const char *hostname,
+                unsigned short max_packet_size)
+{
+    struct preconn *preconn;
+    lsquic_conn_t *conn;
+    size_t len;
+    int s;
+
+    ENGINE_IN(engine);
+
+    len = hostname ? strlen(hostname) : 0;
+    preconn = malloc(sizeof(*preconn) + len + 1);
+    if (!preconn)
+        goto err;
+
+    conn = create_client_conn(engine, local_sa, peer_sa, peer_ctx, hostname,
+                                                            max_packet_size);
+    if (!conn)
+    {
+        free(preconn);
+        goto err;
+    }
+
+    if (len)
+        memcpy(preconn->pc_hostname, hostname, len);
+    preconn->pc_hostname[len] = '\0';
+    preconn->pc_conn = conn;
+    TAILQ_INSERT_TAIL(&engine->preconns, preconn, pc_next);
+    full_conn_client_preconnect(conn, lsquic_time_now()
+                            + engine->pub.enp_settings.es_preconn_keepalive);
+    LSQ_DEBUG("preconnected connection %"PRIu64" to `%s'", conn->cn_cid,
+                                                        preconn->pc_hostname);
+    s = 0;
+
+  end:
+    ENGINE_OUT(engine);
+    return s;
+
+  err:
+    s = -1;
+    goto end;
+}
+
+
+static int
+sockaddr_eq (const struct sockaddr *a, const struct sockaddr *b)
+{
+    const struct sockaddr_in *a4, *b4;
+    const struct sockaddr_in6 *a6, *b6;
+
+    if (a->sa_family != b->sa_family)
+        return 0;
+
+    switch (a->sa_family)
+    {
+    case AF_INET:
+        a4 = (const struct sockaddr_in *) a;
+        b4 = (const struct sockaddr_in *) b;
+        return a4->sin_port == b4->sin_port
+            && a4->sin_addr.s_addr == b4->sin_addr.s_addr;
+    case AF_INET6:
+        a6 = (const struct sockaddr_in6 *) a;
+        b6 = (const struct sockaddr_in6 *) b;
+        return a6->sin6_port == b6->sin6_port
+            && 0 == memcmp(&a6->sin6_addr, &b6->sin6_addr,
+                                                    sizeof(a6->sin6_addr));
+    default:
+        return 0;
+    }
+}
+
+
+lsquic_conn_t *
+lsquic_engine_take_preconn (lsquic_engine_t *engine,
+                            const struct sockaddr *peer_sa,
+                            lsquic_conn_ctx_t *conn_ctx, const char *hostname)
+{
+    struct preconn *preconn, *best;
+    lsquic_conn_t *conn;
+
+    ENGINE_IN(engine);
+
+    if (!hostname)
+        hostname = "";
+
+    best = NULL;
+    TAILQ_FOREACH(preconn, &engine->preconns, pc_next)
+    {
+        conn = preconn->pc_conn;
+        if (!((conn->cn_flags & LSCONN_HAS_PEER_SA)
+                && sockaddr_eq(peer_sa, &conn->cn_peer_addr_u.sa)
+                && 0 == strcmp(hostname, preconn->pc_hostname)))
+            continue;
+        switch (lsquic_conn_status(conn, NULL, 0))
+        {
+        case LSCONN_ST_CONNECTED:
+            best = preconn;
+            goto found;
+        case LSCONN_ST_HSK_IN_PROGRESS:
+            if (!best)
+                best = preconn;
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (!best)
+    {
+        conn = NULL;
+        goto end;
+    }
+
+  found:
+    TAILQ_REMOVE(&engine->preconns, best, pc_next);
+    conn = best->pc_conn;
+    free(best);
+    LSQ_DEBUG("hand out preconnected connection %"PRIu64, conn->cn_cid);
     lsquic_conn_set_ctx(conn, conn_ctx);
     full_conn_client_call_on_new(conn);
+    /* The user is likely to create streams right away: */
+    if (!(conn->cn_flags & LSCONN_TICKABLE))
+    {
+        lsquic_mh_insert(&engine->conns_tickable, conn, conn->cn_last_ticked);
+        engine_incref_conn(conn, LSCONN_TICKABLE);
+    }
+
   end:
     ENGINE_OUT(engine);
     return conn;
-  err:
-    conn = NULL;
-    goto end;
 }
 
 
@@ -831,6 +1082,7 @@ lsquic_engine_process_conns (lsquic_engine_t *engine)
 {
     lsquic_conn_t *conn;
     lsquic_time_t now;
+    size_t bytes;
 
     ENGINE_IN(engine);
 
@@ -846,44 +1098,27 @@ lsquic_engine_process_conns (lsquic_engine_t *engine)
     }
 
     process_connections(engine, conn_iter_next_tickable, now);
+
+    /* Connections have been ticked and packets sent: now is a good time
+     * to replenish the key pool.
+     */
+    if (engine->pub.enp_c255_pool && !(engine->flags & ENG_PAST_DEADLINE))
+        (void) lsquic_c255_pool_refill(engine->pub.enp_c255_pool,
+                                                    C255_POOL_REFILL_BATCH);
+    bytes = lsquic_mm_maybe_trim(&engine->pub.enp_mm, now);
+    if (bytes)
+        LSQ_DEBUG("trimmed %zu bytes of cached buffers", bytes);
     ENGINE_OUT(engine);
 }
 
 
-static ssize_t
-really_encrypt_packet (const lsquic_conn_t *conn,
-                       struct lsquic_packet_out *packet_out,
-                       unsigned char *buf, size_t bufsz)
+void
+lsquic_engine_trim_mem (lsquic_engine_t *engine)
 {
-    int header_sz, is_hello_packet;
-    enum enc_level enc_level;
-    size_t packet_sz;
-    unsigned char header_buf[QUIC_MAX_PUBHDR_SZ];
-
-    header_sz = conn->cn_pf->pf_gen_reg_pkt_header(conn, packet_out,
-                                            header_buf, sizeof(header_buf));
-    if (header_sz < 0)
-        return -1;
+    size_t bytes;
 
-    is_hello_packet = !!(packet_out->po_flags & PO_HELLO);
-    enc_level = conn->cn_esf->esf_encrypt(conn->cn_enc_session,
-                conn->cn_version, 0,
-                packet_out->po_packno, header_buf, header_sz,
-                packet_out->po_data, packet_out->po_data_sz,
-                buf, bufsz, &packet_sz, is_hello_packet);
-    if ((int) enc_level >= 0)
-    {
-        lsquic_packet_out_set_enc_level(packet_out, enc_level);
-        LSQ_DEBUG("encrypted packet %"PRIu64"; plaintext is %zu bytes, "
-            "ciphertext is %zd bytes",
-            packet_out->po_packno,
-            conn->cn_pf->pf_packout_header_size(conn, packet_out->po_flags) +
-                                                packet_out->po_data_sz,
-            packet_sz);
-        return packet_sz;
-    }
-    else
-        return -1;
+    bytes = lsquic_mm_trim(&engine->pub.enp_mm);
+    LSQ_DEBUG("trimmed %zu bytes of cached buffers", bytes);
 }
 
 
@@ -894,13 +1129,16 @@ conn_peer_ipv6 (const struct lsquic_conn *conn)
 }
 
 
+/* Allocate buffer for the encrypted packet and generate packet header.
+ * The packet is sealed later -- see seal_batch().
+ */
 static enum { ENCPA_OK, ENCPA_NOMEM, ENCPA_BADCRYPT, }
-encrypt_packet (lsquic_engine_t *engine, const lsquic_conn_t *conn,
-                                            lsquic_packet_out_t *packet_out)
+prepare_packet (lsquic_engine_t *engine, const lsquic_conn_t *conn,
+                lsquic_packet_out_t *packet_out, struct out_batch *batch,
+                unsigned n)
 {
-    ssize_t enc_sz;
+    int header_sz;
     size_t bufsz;
-    unsigned sent_sz;
     unsigned char *buf;
     int ipv6;
 
@@ -908,6 +1146,12 @@ encrypt_packet (lsquic_engine_t *engine, const lsquic_conn_t *conn,
                                 packet_out->po_data_sz + QUIC_PACKET_HASH_SZ;
     if (bufsz > USHRT_MAX)
         return ENCPA_BADCRYPT;  /* To cause connection to close */
+
+    header_sz = conn->cn_pf->pf_gen_reg_pkt_header(conn, packet_out,
+                            batch->headers[n], sizeof(batch->headers[n]));
+    if (header_sz <= 0)
+        return ENCPA_BADCRYPT;
+
     ipv6 = conn_peer_ipv6(conn);
     buf = engine->pub.enp_pmi->pmi_allocate(engine->pub.enp_pmi_ctx,
                                             conn->cn_peer_ctx, bufsz, ipv6);
@@ -918,28 +1162,50 @@ encrypt_packet (lsquic_engine_t *engine, const lsquic_conn_t *conn,
         return ENCPA_NOMEM;
     }
 
-    {
-        enc_sz = really_encrypt_packet(conn, packet_out, buf, bufsz);
-        sent_sz = enc_sz;
-    }
-
-    if (enc_sz < 0)
-    {
-        engine->pub.enp_pmi->pmi_return(engine->pub.enp_pmi_ctx,
-                                                conn->cn_peer_ctx, buf, ipv6);
-        return ENCPA_BADCRYPT;
-    }
-
     packet_out->po_enc_data    = buf;
-    packet_out->po_enc_data_sz = enc_sz;
-    packet_out->po_sent_sz     = sent_sz;
+    packet_out->po_enc_data_sz = bufsz;
     packet_out->po_flags &= ~PO_IPv6;
-    packet_out->po_flags |= PO_ENCRYPTED|PO_SENT_SZ|(ipv6 << POIPv6_SHIFT);
+    packet_out->po_flags |= ipv6 << POIPv6_SHIFT;
+    batch->header_sz[n] = header_sz;
 
     return ENCPA_OK;
 }
 
 
+static int
+seal_packet (const lsquic_conn_t *conn, struct lsquic_packet_out *packet_out,
+             const unsigned char *header, size_t header_sz)
+{
+    int is_hello_packet;
+    enum enc_level enc_level;
+    size_t packet_sz;
+
+    is_hello_packet = !!(packet_out->po_flags & PO_HELLO);
+    enc_level = conn->cn_esf->esf_encrypt(conn->cn_enc_session,
+                conn->cn_version, 0,
+                packet_out->po_packno, header, header_sz,
+                packet_out->po_data, packet_out->po_data_sz,
+                packet_out->po_enc_data, packet_out->po_enc_data_sz,
+                &packet_sz, is_hello_packet);
+    if ((int) enc_level >= 0)
+    {
+        lsquic_packet_out_set_enc_level(packet_out, enc_level);
+        LSQ_DEBUG("encrypted packet %"PRIu64"; plaintext is %zu bytes, "
+            "ciphertext is %zd bytes",
+            packet_out->po_packno,
+            conn->cn_pf->pf_packout_header_size(conn, packet_out->po_flags) +
+                                                packet_out->po_data_sz,
+            packet_sz);
+        packet_out->po_enc_data_sz = packet_sz;
+        packet_out->po_sent_sz     = packet_sz;
+        packet_out->po_flags |= PO_ENCRYPTED|PO_SENT_SZ;
+        return 0;
+    }
+    else
+        return -1;
+}
+
+
 static void
 release_or_return_enc_data (struct lsquic_engine *engine,
                 void (*pmi_rel_or_ret) (void *, void *, void *, char),
@@ -1153,6 +1419,138 @@ check_deadline (lsquic_engine_t *engine)
 }
 
 
+static void
+close_unsendable_conn (struct lsquic_engine *engine,
+                       struct conns_out_iter *conns_iter, lsquic_conn_t *conn,
+                       struct conns_tailq *ticked_conns,
+                       struct conns_stailq *closed_conns)
+{
+    if (conn->cn_flags & LSCONN_EVANESCENT)
+        return;
+    if (!(conn->cn_flags & LSCONN_CLOSING))
+    {
+        LSQ_INFO("conn %"PRIu64" has unsendable packets", conn->cn_cid);
+        STAILQ_INSERT_TAIL(closed_conns, conn, cn_next_closed_conn);
+        engine_incref_conn(conn, LSCONN_CLOSING);
+        if (conn->cn_flags & LSCONN_HASHED)
+            remove_conn_from_hash(engine, conn);
+    }
+    if (conn->cn_flags & LSCONN_COI_ACTIVE)
+        coi_deactivate(conns_iter, conn);
+    if (conn->cn_flags & LSCONN_TICKED)
+    {
+        TAILQ_REMOVE(ticked_conns, conn, cn_next_ticked);
+        engine_decref_conn(engine, conn, LSCONN_TICKED);
+    }
+}
+
+
+/* Seal packets that have been collected into the batch.  This is done
+ * connection by connection, so that the same key is used back to back.
+ *
+ * If a packet cannot be sealed, it and the packets of the same connection
+ * that follow it are returned to the connection and removed from the
+ * batch, and the connection is closed.
+ *
+ * Returns the number of packets left in the batch.
+ */
+static unsigned
+seal_batch (struct lsquic_engine *engine, struct conns_out_iter *conns_iter,
+            struct out_batch *batch, unsigned n,
+            struct conns_tailq *ticked_conns,
+            struct conns_stailq *closed_conns)
+{
+    lsquic_packet_out_t *packet_out;
+    lsquic_conn_t *conn;
+    unsigned i, j, k, last, n_dropped;
+    int idx;
+
+    /* Chain packets of each connection together.  cn_batch_last is not
+     * reset between batches: the value left over from the previous batch
+     * cannot point to a packet of the same connection that comes before
+     * the connection's first packet in this batch.
+     */
+    for (i = 0; i < n; ++i)
+    {
+        conn = batch->conns[i];
+        last = conn->cn_batch_last;
+        if (last < i && batch->conns[last] == conn)
+            batch->next_same[last] = i;
+        batch->next_same[i] = -1;
+        conn->cn_batch_last = i;
+    }
+
+    n_dropped = 0;
+    for (i = 0; i < n; ++i)
+    {
+        if (batch->header_sz[i] <= 0)
+            continue;
+        /* This is the first packet of the connection still to be sealed:
+         * the ones before it have been sealed when the chain was walked.
+         */
+        conn = batch->conns[i];
+        for (idx = i; idx >= 0; idx = batch->next_same[idx])
+        {
+            j = idx;
+            if (batch->header_sz[j] <= 0)
+                continue;
+            packet_out = batch->packets[j];
+            if (0 == seal_packet(conn, packet_out, batch->headers[j],
+                                                    batch->header_sz[j]))
+            {
+                batch->outs[j].buf  = packet_out->po_enc_data;
+                batch->outs[j].sz   = packet_out->po_enc_data_sz;
+                batch->header_sz[j] = 0;
+            }
+            else
+            {
+                for ( ; idx >= 0; idx = batch->next_same[idx])
+                {
+                    batch->header_sz[idx] = -1;
+                    ++n_dropped;
+                }
+                break;
+            }
+        }
+    }
+
+    if (0 == n_dropped)
+        return n;
+
+    /* Return packets in reverse order so that the packet ordering is
+     * maintained.
+     */
+    for (k = n; k-- > 0; )
+        if (batch->header_sz[k] < 0)
+        {
+            conn = batch->conns[k];
+            packet_out = batch->packets[k];
+            if (!(packet_out->po_flags & PO_ENCRYPTED)
+                                                && packet_out->po_enc_data)
+                return_enc_data(engine, conn, packet_out);
+            conn->cn_if->ci_packet_not_sent(conn, packet_out);
+        }
+
+    for (j = 0, k = 0; k < n; ++k)
+        if (batch->header_sz[k] < 0)
+            close_unsendable_conn(engine, conns_iter, batch->conns[k],
+                                                ticked_conns, closed_conns);
+        else
+        {
+            if (j != k)
+            {
+                batch->conns  [j] = batch->conns  [k];
+                batch->packets[j] = batch->packets[k];
+                batch->outs   [j] = batch->outs   [k];
+            }
+            ++j;
+        }
+
+    assert(j + n_dropped == n);
+    return j;
+}
+
+
 static void
 send_packets_out (struct lsquic_engine *engine,
                   struct conns_tailq *ticked_conns,
@@ -1188,9 +1586,10 @@ send_packets_out (struct lsquic_engine *engine,
              */
             return_enc_data(engine, conn, packet_out);
         }
+        batch->header_sz[n] = 0;
         if (!(packet_out->po_flags & (PO_ENCRYPTED|PO_NOENCRYPT)))
         {
-            switch (encrypt_packet(engine, conn, packet_out))
+            switch (prepare_packet(engine, conn, packet_out, batch, n))
             {
             case ENCPA_NOMEM:
                 /* Send what we have and wait for a more opportune moment */
@@ -1199,23 +1598,8 @@ send_packets_out (struct lsquic_engine *engine,
             case ENCPA_BADCRYPT:
                 /* This is pretty bad: close connection immediately */
                 conn->cn_if->ci_packet_not_sent(conn, packet_out);
-                LSQ_INFO("conn %"PRIu64" has unsendable packets", conn->cn_cid);
-                if (!(conn->cn_flags & LSCONN_EVANESCENT))
-                {
-                    if (!(conn->cn_flags & LSCONN_CLOSING))
-                    {
-                        STAILQ_INSERT_TAIL(closed_conns, conn, cn_next_closed_conn);
-                        engine_incref_conn(conn, LSCONN_CLOSING);
-                        if (conn->cn_flags & LSCONN_HASHED)
-                            remove_conn_from_hash(engine, conn);
-                    }
-                    coi_deactivate(&conns_iter, conn);
-                    if (conn->cn_flags & LSCONN_TICKED)
-                    {
-                        TAILQ_REMOVE(ticked_conns, conn, cn_next_ticked);
-                        engine_decref_conn(engine, conn, LSCONN_TICKED);
-                    }
-                }
+                close_unsendable_conn(engine, &conns_iter, conn,
+                                                ticked_conns, closed_conns);
                 continue;
             case ENCPA_OK:
                 break;
@@ -1231,6 +1615,7 @@ send_packets_out (struct lsquic_engine *engine,
         }
         else
         {
+            /* If the packet is to be sealed, these are set by seal_batch() */
             batch->outs[n].buf     = packet_out->po_data;
             batch->outs[n].sz      = packet_out->po_data_sz;
         }
@@ -1242,15 +1627,20 @@ send_packets_out (struct lsquic_engine *engine,
         ++n;
         if (n == engine->batch_size)
         {
-            n = 0;
-            w = send_batch(engine, &conns_iter, batch, engine->batch_size);
+            n = seal_batch(engine, &conns_iter, batch, n, ticked_conns,
+                                                                closed_conns);
+            if (0 == n)
+                continue;
+            w = send_batch(engine, &conns_iter, batch, n);
             ++n_batches_sent;
             n_sent += w;
-            if (w < engine->batch_size)
+            if (w < n)
             {
+                n = 0;
                 shrink = 1;
                 break;
             }
+            n = 0;
             deadline_exceeded = check_deadline(engine);
             if (deadline_exceeded)
                 break;
@@ -1259,6 +1649,9 @@ send_packets_out (struct lsquic_engine *engine,
     }
   end_for:
 
+    if (n > 0)
+        n = seal_batch(engine, &conns_iter, batch, n, ticked_conns,
+                                                                closed_conns);
     if (n > 0) {
         w = send_batch(engine, &conns_iter, batch, n);
         n_sent += w;
@@ -10,6 +10,7 @@
 struct lsquic_conn;
 struct lsquic_engine;
 struct stack_st_X509;
+struct c255_pool;
 
 struct lsquic_engine_public {
     struct lsquic_mm                enp_mm;
@@ -23,6 +24,7 @@ struct lsquic_engine_public {
                                    *enp_pmi;
     void                           *enp_pmi_ctx;
     struct lsquic_engine           *enp_engine;
+    struct c255_pool               *enp_c255_pool;  /* May be NULL */
     enum {
         ENPUB_PROC  = (1 << 0), /* Being processed by one of the user-facing
                                  * functions.
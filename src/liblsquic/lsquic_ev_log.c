@@ -290,7 +290,8 @@ lsquic_ev_log_generated_stop_waiting_frame (lsquic_cid_t cid,
 void
 lsquic_ev_log_generated_http_headers (lsquic_cid_t cid, uint32_t stream_id,
                     int is_server, const struct http_prio_frame *prio_frame,
-                    const struct lsquic_http_headers *headers)
+                    const struct lsquic_http_headers *headers,
+                    const struct lsquic_http_headers *extra_headers)
 {
     uint32_t dep_stream_id;
     int exclusive, i;
@@ -316,6 +317,14 @@ lsquic_ev_log_generated_http_headers (lsquic_cid_t cid, uint32_t stream_id,
             (char *) headers->headers[i].name.iov_base,
             (int)    headers->headers[i].value.iov_len,
             (char *) headers->headers[i].value.iov_base);
+
+    if (extra_headers)
+        for (i = 0; i < extra_headers->count; ++i)
+            LCID("  %.*s: %.*s",
+                (int)    extra_headers->headers[i].name.iov_len,
+                (char *) extra_headers->headers[i].name.iov_base,
+                (int)    extra_headers->headers[i].value.iov_len,
+                (char *) extra_headers->headers[i].value.iov_base);
 }
 
 
@@ -189,7 +189,8 @@ lsquic_ev_log_generated_stop_waiting_frame (lsquic_cid_t, lsquic_packno_t);
 void
 lsquic_ev_log_generated_http_headers (lsquic_cid_t, uint32_t stream_id,
                             int is_server, const struct http_prio_frame *,
-                            const struct lsquic_http_headers *);
+                            const struct lsquic_http_headers *,
+                            const struct lsquic_http_headers *extra_headers);
 
 
 #define EV_LOG_GENERATED_HTTP_HEADERS(...) do {                             \
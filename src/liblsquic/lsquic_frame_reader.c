@@ -114,13 +114,24 @@ struct lsquic_frame_reader
     void                            *fr_hsi_ctx;
     struct http1x_ctor_ctx           fr_h1x_ctor_ctx;
     /* The the header block is shared between HEADERS, PUSH_PROMISE, and
-     * CONTINUATION frames.  It gets added to as block fragments come in.
+     * CONTINUATION frames.  It is decoded as block fragments come in: only
+     * the header field that has not been read in full yet is kept in
+     * fr_hb_buf.  Decoded headers go into fr_hb_hset right away.
      */
-    unsigned char                   *fr_header_block;
+    unsigned char                   *fr_hb_buf;
+    void                            *fr_hb_hset;
 #if LSQUIC_CONN_STATS
     struct conn_stats               *fr_conn_stats;
 #endif
-    unsigned                         fr_header_block_sz;
+    unsigned                         fr_hb_buf_sz;
+    unsigned                         fr_hb_nbuf;    /* Bytes in fr_hb_buf */
+    unsigned                         fr_header_block_sz;    /* Read so far */
+    /* The first error is reported when the whole block has been read.
+     * Until then, the fields are still decoded to keep the HPACK dynamic
+     * table in sync -- unless decoding itself failed.
+     */
+    enum frame_reader_error          fr_hb_err;
+    int                              fr_hb_decomp_err;
     unsigned                         fr_max_headers_sz; /* 0 means no limit */
     enum frame_reader_flags          fr_flags;
     /* Keep some information about previous frame to catch framing errors.
@@ -194,10 +205,13 @@ lsquic_frame_reader_new (enum frame_reader_flags flags,
     fr->fr_read           = read;
     fr->fr_callbacks      = cb;
     fr->fr_cb_ctx         = frame_reader_cb_ctx;
-    fr->fr_header_block   = NULL;
+    fr->fr_hb_buf         = NULL;
+    fr->fr_hb_hset        = NULL;
+    fr->fr_hb_buf_sz      = 0;
+    fr->fr_hb_nbuf        = 0;
     fr->fr_max_headers_sz = max_headers_sz;
     fr->fr_hsi_if         = hsi_if;
-    if (hsi_if == lsquic_http1x_if)
+    if (hsi_if == lsquic_http1x_if || hsi_if == lsquic_hset_native_if)
     {
         fr->fr_h1x_ctor_ctx = (struct http1x_ctor_ctx) {
             .cid            = LSQUIC_LOG_CONN_ID,
@@ -219,7 +233,9 @@ lsquic_frame_reader_new (enum frame_reader_flags flags,
 void
 lsquic_frame_reader_destroy (struct lsquic_frame_reader *fr)
 {
-    free(fr->fr_header_block);
+    if (fr->fr_hb_hset)
+        fr->fr_hsi_if->hsi_discard_header_set(fr->fr_hb_hset);
+    free(fr->fr_hb_buf);
     free(fr);
 }
 
@@ -240,11 +256,48 @@ lsquic_frame_reader_destroy (struct lsquic_frame_reader *fr)
 } while (0)
 
 
+/* Initial size of fr_hb_buf.  It is doubled if a single header field does
+ * not fit into it and shrunk back once the header block is done.
+ */
+#define HB_BUF_SZ 0x1000
+
+
+static void
+abandon_header_block (struct lsquic_frame_reader *fr)
+{
+    if (fr->fr_hb_hset)
+    {
+        fr->fr_hsi_if->hsi_discard_header_set(fr->fr_hb_hset);
+        fr->fr_hb_hset = NULL;
+    }
+    fr->fr_hb_nbuf = 0;
+    if (fr->fr_hb_buf_sz > HB_BUF_SZ)
+    {
+        free(fr->fr_hb_buf);
+        fr->fr_hb_buf = NULL;
+        fr->fr_hb_buf_sz = 0;
+    }
+}
+
+
+static void
+begin_header_block (struct lsquic_frame_reader *fr, int is_push_promise)
+{
+    abandon_header_block(fr);
+    fr->fr_header_block_sz = 0;
+    fr->fr_hb_err = 0;
+    fr->fr_hb_decomp_err = 0;
+    fr->fr_hb_hset = fr->fr_hsi_if->hsi_create_header_set(fr->fr_hsi_ctx,
+                                                            is_push_promise);
+    if (!fr->fr_hb_hset)
+        fr->fr_hb_err = FR_ERR_NOMEM;
+}
+
+
 static int
 prepare_for_payload (struct lsquic_frame_reader *fr)
 {
     uint32_t stream_id;
-    unsigned char *header_block;
 
     /* RFC 7540, Section 4.1: Ignore R bit: */
     fr->fr_state.header.hfh_stream_id[0] &= ~0x80;
@@ -303,6 +356,7 @@ prepare_for_payload (struct lsquic_frame_reader *fr)
             return -1;
         }
         fr->fr_state.reader_type = READER_HEADERS;
+        begin_header_block(fr, 0);
         break;
     case HTTP_FRAME_PUSH_PROMISE:
         if (fr->fr_flags & FRF_SERVER)
@@ -337,6 +391,7 @@ prepare_for_payload (struct lsquic_frame_reader *fr)
             return -1;
         }
         fr->fr_state.reader_type = READER_PUSH_PROMISE;
+        begin_header_block(fr, 1);
         break;
     case HTTP_FRAME_CONTINUATION:
         if (0 == (fr->fr_flags & FRF_HAVE_PREV))
@@ -364,24 +419,13 @@ prepare_for_payload (struct lsquic_frame_reader *fr)
         }
         if (fr->fr_state.reader_type == READER_SKIP)
             goto continue_skipping;
-        fr->fr_header_block_sz += fr->fr_state.payload_length;
         if (fr->fr_max_headers_sz &&
-            fr->fr_header_block_sz > fr->fr_max_headers_sz)
+            fr->fr_header_block_sz + fr->fr_state.payload_length
+                                                    > fr->fr_max_headers_sz)
         {
-            free(fr->fr_header_block);
-            fr->fr_header_block = NULL;
+            abandon_header_block(fr);
             goto headers_too_large;
         }
-        header_block = realloc(fr->fr_header_block, fr->fr_header_block_sz);
-        if (!header_block)
-        {
-            LSQ_WARN("cannot allocate %u bytes for header block",
-                                                    fr->fr_header_block_sz);
-            fr->fr_callbacks->frc_on_error(fr->fr_cb_ctx, stream_id,
-                                                                FR_ERR_NOMEM);
-            return -1;
-        }
-        fr->fr_header_block = header_block;
         fr->fr_state.by_type.headers_state.nread = 0;
         fr->fr_state.reader_type = READER_CONTIN;
         break;
@@ -507,61 +551,137 @@ skip_headers_padding (struct lsquic_frame_reader *fr)
 }
 
 
-static int
-decode_and_pass_payload (struct lsquic_frame_reader *fr)
+/* Decode header fields that have been read in full and pass them to the
+ * header set.  The partial field at the end, if any, is moved to the front
+ * of fr_hb_buf.
+ */
+static void
+decode_header_fields (struct lsquic_frame_reader *fr)
 {
-    struct headers_state *hs = &fr->fr_state.by_type.headers_state;
     const unsigned char *comp, *end;
     enum frame_reader_error err;
-    int s;
+    int len;
     uint32_t name_idx;
     lshpack_strlen_t name_len, val_len;
+    const char *name, *value;
     char *buf;
-    struct uncompressed_headers *uh = NULL;
-    void *hset = NULL;
 
-    buf = lsquic_mm_get_16k(fr->fr_mm);
-    if (!buf)
+    if (fr->fr_hb_decomp_err)
     {
-        err = FR_ERR_NOMEM;
-        goto stream_error;
+        fr->fr_hb_nbuf = 0;
+        return;
     }
 
-    hset = fr->fr_hsi_if->hsi_create_header_set(fr->fr_hsi_ctx,
-                            READER_PUSH_PROMISE == fr->fr_state.reader_type);
-    if (!hset)
+    buf = lsquic_mm_get_16k(fr->fr_mm);
+    if (!buf)
     {
-        err = FR_ERR_NOMEM;
-        goto stream_error;
+        /* The dynamic table cannot be kept in sync without decoding */
+        if (!fr->fr_hb_err)
+            fr->fr_hb_err = FR_ERR_NOMEM;
+        fr->fr_hb_decomp_err = 1;
+        fr->fr_hb_nbuf = 0;
+        return;
     }
 
-    comp = fr->fr_header_block;
-    end = comp + fr->fr_header_block_sz;
+    comp = fr->fr_hb_buf;
+    end = comp + fr->fr_hb_nbuf;
 
     while (comp < end)
     {
-        s = lshpack_dec_decode(fr->fr_hdec, &comp, end,
-                    buf, buf + 16 * 1024, &name_len, &val_len, &name_idx);
-        if (s == 0)
+        len = lshpack_dec_field_len(comp, end);
+        if (len == 0)
+            break;
+        /* Only Huffman-encoded strings are decoded into `buf' */
+        if (len < 0
+            || 0 != lshpack_dec_decode_ref(fr->fr_hdec, &comp, comp + len,
+                    buf, buf + 16 * 1024, &name, &name_len, &value, &val_len,
+                    &name_idx))
         {
-            err = (enum frame_reader_error)
-                fr->fr_hsi_if->hsi_process_header(hset, name_idx, buf,
-                                        name_len, buf + name_len, val_len);
-            if (err == 0)
-            {
-#if LSQUIC_CONN_STATS
-                fr->fr_conn_stats->in.headers_uncomp += name_len + val_len;
-#endif
-                continue;
-            }
+            LSQ_INFO("cannot decode header field");
+            if (!fr->fr_hb_err)
+                fr->fr_hb_err = FR_ERR_DECOMPRESS;
+            fr->fr_hb_decomp_err = 1;
+            break;
         }
+        if (fr->fr_hb_err)
+            continue;
+        err = (enum frame_reader_error)
+            fr->fr_hsi_if->hsi_process_header(fr->fr_hb_hset, name_idx, name,
+                                                name_len, value, val_len);
+        if (err)
+            fr->fr_hb_err = err;
+#if LSQUIC_CONN_STATS
         else
-            err = FR_ERR_DECOMPRESS;
-        goto stream_error;
+            fr->fr_conn_stats->in.headers_uncomp += name_len + val_len;
+#endif
     }
-    assert(comp == end);
+
     lsquic_mm_put_16k(fr->fr_mm, buf);
-    buf = NULL;
+
+    if (fr->fr_hb_decomp_err)
+        fr->fr_hb_nbuf = 0;
+    else
+    {
+        fr->fr_hb_nbuf = end - comp;
+        memmove(fr->fr_hb_buf, comp, fr->fr_hb_nbuf);
+    }
+}
+
+
+/* Read up to `ntoread' bytes of header block fragment and decode what can
+ * be decoded.  Returns number of bytes read or -1 on error.
+ */
+static ssize_t
+read_header_block_data (struct lsquic_frame_reader *fr, unsigned ntoread)
+{
+    unsigned char *buf;
+    unsigned buf_sz;
+    ssize_t nr;
+
+    if (fr->fr_hb_nbuf == fr->fr_hb_buf_sz)
+    {
+        buf_sz = fr->fr_hb_buf_sz ? fr->fr_hb_buf_sz * 2 : HB_BUF_SZ;
+        buf = realloc(fr->fr_hb_buf, buf_sz);
+        if (!buf)
+        {
+            LSQ_WARN("cannot allocate %u bytes for header field", buf_sz);
+            return -1;
+        }
+        fr->fr_hb_buf = buf;
+        fr->fr_hb_buf_sz = buf_sz;
+    }
+
+    if (ntoread > fr->fr_hb_buf_sz - fr->fr_hb_nbuf)
+        ntoread = fr->fr_hb_buf_sz - fr->fr_hb_nbuf;
+    nr = fr->fr_read(fr->fr_stream, fr->fr_hb_buf + fr->fr_hb_nbuf, ntoread);
+    if (nr <= 0)
+        RETURN_ERROR(nr);
+    fr->fr_hb_nbuf += nr;
+    fr->fr_header_block_sz += nr;
+    decode_header_fields(fr);
+    return nr;
+}
+
+
+static int
+finish_header_block (struct lsquic_frame_reader *fr)
+{
+    struct headers_state *hs = &fr->fr_state.by_type.headers_state;
+    enum frame_reader_error err;
+    struct uncompressed_headers *uh = NULL;
+    void *hset;
+
+    hset = fr->fr_hb_hset;
+    fr->fr_hb_hset = NULL;
+    err = fr->fr_hb_err;
+    if (!err && fr->fr_hb_nbuf)
+    {
+        LSQ_INFO("header block ends in the middle of a header field");
+        err = FR_ERR_DECOMPRESS;
+    }
+    abandon_header_block(fr);
+    if (err)
+        goto stream_error;
 
     err = (enum frame_reader_error)
         fr->fr_hsi_if->hsi_process_header(hset, 0, 0, 0, 0, 0);
@@ -614,10 +734,6 @@ decode_and_pass_payload (struct lsquic_frame_reader *fr)
     LSQ_INFO("%s: stream error %u", __func__, err);
     if (hset)
         fr->fr_hsi_if->hsi_discard_header_set(hset);
-    if (uh)
-        free(uh);
-    if (buf)
-        lsquic_mm_put_16k(fr->fr_mm, buf);
     fr->fr_callbacks->frc_on_error(fr->fr_cb_ctx, fr_get_stream_id(fr), err);
     return 0;
 }
@@ -630,30 +746,13 @@ read_headers_block_fragment (struct lsquic_frame_reader *fr)
     ssize_t nr;
     unsigned payload_length = fr->fr_state.payload_length - hs->pesw_size -
                                                                 hs->pad_length;
-    if (!fr->fr_header_block)
-    {
-        fr->fr_header_block_sz = payload_length;
-        fr->fr_header_block = malloc(payload_length);
-        if (!fr->fr_header_block)
-            return -1;
-    }
-    nr = fr->fr_read(fr->fr_stream, fr->fr_header_block + hs->nread,
-                                            fr->fr_header_block_sz - hs->nread);
-    if (nr <= 0)
-    {
-        free(fr->fr_header_block);
-        fr->fr_header_block = NULL;
-        RETURN_ERROR(nr);
-    }
+    nr = read_header_block_data(fr, payload_length - hs->nread);
+    if (nr < 0)
+        return -1;
     hs->nread += nr;
     if (hs->nread == payload_length &&
                 (fr->fr_state.header.hfh_flags & HFHF_END_HEADERS))
-    {
-        int rv = decode_and_pass_payload(fr);
-        free(fr->fr_header_block);
-        fr->fr_header_block = NULL;
-        return rv;
-    }
+        return finish_header_block(fr);
     else
         return 0;
 }
@@ -671,8 +770,6 @@ read_headers_block_fragment_and_padding (struct lsquic_frame_reader *fr)
         rv = skip_headers_padding(fr);
     else
     {   /* Edge case where PESW takes up the whole frame */
-        fr->fr_header_block_sz = 0;
-        fr->fr_header_block    = NULL;
         rv = 0;
     }
     if (0 == rv && hs->nread == payload_length)
@@ -779,19 +876,15 @@ read_contin (struct lsquic_frame_reader *fr)
     ssize_t nr;
 
     ntoread = fr->fr_state.payload_length - hs->nread;
-    nr = fr->fr_read(fr->fr_stream,
-                     fr->fr_header_block + fr->fr_header_block_sz - ntoread,
-                     ntoread);
-    if (nr <= 0)
-        RETURN_ERROR(nr);
+    nr = read_header_block_data(fr, ntoread);
+    if (nr < 0)
+        return -1;
     hs->nread += nr;
     if (hs->nread == fr->fr_state.payload_length)
     {
         if (fr->fr_state.header.hfh_flags & HFHF_END_HEADERS)
         {
-            int rv = decode_and_pass_payload(fr);
-            free(fr->fr_header_block);
-            fr->fr_header_block = NULL;
+            int rv = finish_header_block(fr);
             reset_state(fr);
             return rv;
         }
@@ -917,7 +1010,6 @@ lsquic_frame_reader_mem_used (const struct lsquic_frame_reader *fr)
 {
     size_t size;
     size = sizeof(*fr);
-    if (fr->fr_header_block)
-        size += fr->fr_header_block_sz;
+    size += fr->fr_hb_buf_sz;
     return size;
 }
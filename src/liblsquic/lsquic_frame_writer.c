@@ -25,6 +25,7 @@
 #include "lsquic_conn.h"
 
 #include "lsquic_frame_writer.h"
+#include "lsquic_hdr_tmpl.h"
 #include "lsquic_frame_common.h"
 #include "lsquic_ev_log.h"
 
@@ -410,14 +411,8 @@ have_oversize_strings (const struct lsquic_http_headers *headers)
 
 
 static int
-check_headers_size (const struct lsquic_frame_writer *fw,
-                    const struct lsquic_http_headers *headers,
-                    const struct lsquic_http_headers *extra_headers)
+check_list_size (const struct lsquic_frame_writer *fw, uint32_t headers_sz)
 {
-    uint32_t headers_sz;
-    headers_sz = calc_headers_size(headers);
-    if (extra_headers)
-        headers_sz += calc_headers_size(extra_headers);
     if (headers_sz > fw->fw_max_header_list_sz)
     {
         LSQ_INFO("Headers size %u is larger than max allowed (%u)",
@@ -429,6 +424,19 @@ check_headers_size (const struct lsquic_frame_writer *fw,
 }
 
 
+static int
+check_headers_size (const struct lsquic_frame_writer *fw,
+                    const struct lsquic_http_headers *headers,
+                    const struct lsquic_http_headers *extra_headers)
+{
+    uint32_t headers_sz;
+    headers_sz = calc_headers_size(headers);
+    if (extra_headers)
+        headers_sz += calc_headers_size(extra_headers);
+    return check_list_size(fw, headers_sz);
+}
+
+
 static int
 check_headers_case (const struct lsquic_frame_writer *fw,
                     const struct lsquic_http_headers *headers)
@@ -449,11 +457,12 @@ check_headers_case (const struct lsquic_frame_writer *fw,
 }
 
 
+/* `indexed_type' is passed to lshpack_enc_encode() */
 static int
 write_headers (struct lsquic_frame_writer *fw,
                const struct lsquic_http_headers *headers,
                struct header_framer_ctx *hfc, unsigned char *buf,
-               const unsigned buf_sz)
+               const unsigned buf_sz, int indexed_type)
 {
     unsigned char *end;
     int i, s;
@@ -463,7 +472,7 @@ write_headers (struct lsquic_frame_writer *fw,
         end = lshpack_enc_encode(fw->fw_henc, buf, buf + buf_sz,
                                  LSHPACK_HDR_UNKNOWN,
                                  (const lshpack_header_t *)&headers->headers[i],
-                                 0);
+                                 indexed_type);
         if (end > buf)
         {
             s = hfc_write(hfc, buf, end - buf);
@@ -488,6 +497,37 @@ write_headers (struct lsquic_frame_writer *fw,
 }
 
 
+/* Start HEADERS frame.  Clients also write the priority. */
+static int
+write_headers_start (struct lsquic_frame_writer *fw,
+                     struct header_framer_ctx *hfc,
+                     struct http_prio_frame *prio_frame, uint32_t stream_id,
+                     int eos, unsigned weight)
+{
+    enum http_frame_header_flags flags;
+
+    if (eos)
+        flags = HFHF_END_STREAM;
+    else
+        flags = 0;
+
+    if (!(fw->fw_flags & FW_SERVER))
+        flags |= HFHF_PRIORITY;
+
+    hfc_init(hfc, fw, fw->fw_max_frame_sz, HTTP_FRAME_HEADERS, stream_id,
+                                                                        flags);
+
+    if (!(fw->fw_flags & FW_SERVER))
+    {
+        memset(&prio_frame->hpf_stream_id, 0, sizeof(prio_frame->hpf_stream_id));
+        prio_frame->hpf_weight = weight - 1;
+        return hfc_write(hfc, prio_frame, sizeof(struct http_prio_frame));
+    }
+    else
+        return 0;
+}
+
+
 int
 lsquic_frame_writer_write_headers (struct lsquic_frame_writer *fw,
                                    uint32_t stream_id,
@@ -497,7 +537,6 @@ lsquic_frame_writer_write_headers (struct lsquic_frame_writer *fw,
     struct header_framer_ctx hfc;
     int s;
     struct http_prio_frame prio_frame;
-    enum http_frame_header_flags flags;
     unsigned char *buf;
 
     /* Internal function: weight must be valid here */
@@ -512,35 +551,19 @@ lsquic_frame_writer_write_headers (struct lsquic_frame_writer *fw,
     if (have_oversize_strings(headers))
         return -1;
 
-    if (eos)
-        flags = HFHF_END_STREAM;
-    else
-        flags = 0;
-
-    if (!(fw->fw_flags & FW_SERVER))
-        flags |= HFHF_PRIORITY;
-
-    hfc_init(&hfc, fw, fw->fw_max_frame_sz, HTTP_FRAME_HEADERS, stream_id,
-                                                                        flags);
-
-    if (!(fw->fw_flags & FW_SERVER))
-    {
-        memset(&prio_frame.hpf_stream_id, 0, sizeof(prio_frame.hpf_stream_id));
-        prio_frame.hpf_weight = weight - 1;
-        s = hfc_write(&hfc, &prio_frame, sizeof(struct http_prio_frame));
-        if (s < 0)
-            return s;
-    }
+    s = write_headers_start(fw, &hfc, &prio_frame, stream_id, eos, weight);
+    if (s < 0)
+        return s;
 
     buf = malloc(MAX_HEADERS_SIZE);
     if (!buf)
         return -1;
-    s = write_headers(fw, headers, &hfc, buf, MAX_HEADERS_SIZE);
+    s = write_headers(fw, headers, &hfc, buf, MAX_HEADERS_SIZE, 0);
     free(buf);
     if (0 == s)
     {
         EV_LOG_GENERATED_HTTP_HEADERS(LSQUIC_LOG_CONN_ID, stream_id,
-                            fw->fw_flags & FW_SERVER, &prio_frame, headers);
+                    fw->fw_flags & FW_SERVER, &prio_frame, headers, NULL);
         hfc_terminate_frame(&hfc, HFHF_END_HEADERS);
         return lsquic_frame_writer_flush(fw);
     }
@@ -549,6 +572,181 @@ lsquic_frame_writer_write_headers (struct lsquic_frame_writer *fw,
 }
 
 
+/* Encode template headers from `first' up to `last' with indexing and
+ * append them to the template's header block.
+ */
+static int
+write_tmpl_headers (struct lsquic_frame_writer *fw,
+                    struct lsquic_hdr_tmpl *tmpl, unsigned first,
+                    unsigned last, struct header_framer_ctx *hfc)
+{
+    const struct lsquic_http_header *header;
+    unsigned char *buf, *end;
+    unsigned i;
+    int s;
+
+    for (i = first; i < last; ++i)
+    {
+        header = &tmpl->ht_headers.headers[i];
+        buf = tmpl->ht_enc + tmpl->ht_enc_sz;
+        end = lshpack_enc_encode(fw->fw_henc, buf,
+                                 tmpl->ht_enc + tmpl->ht_enc_max,
+                                 LSHPACK_HDR_UNKNOWN,
+                                 (const lshpack_header_t *) header, 0);
+        if (end > buf)
+        {
+            s = hfc_write(hfc, buf, end - buf);
+            if (s < 0)
+                return s;
+            tmpl->ht_enc_sz += end - buf;
+#if LSQUIC_CONN_STATS
+            fw->fw_conn_stats->out.headers_uncomp +=
+                        header->name.iov_len + header->value.iov_len;
+            fw->fw_conn_stats->out.headers_comp += end - buf;
+#endif
+        }
+        else
+        {
+            LSQ_WARN("error encoding header");
+            errno = EBADMSG;
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+
+/* The header block consists of template pseudo-headers, varying
+ * pseudo-headers, template regular headers, and varying regular headers.
+ * Template headers are encoded with indexing, so that once they are all
+ * in the dynamic table, encoding them again produces the same bytes
+ * and does not change the table.  Varying headers are encoded without
+ * indexing: they do not change the table, either.  Thus, the template's
+ * part of the header block is kept and copied out for as long as the
+ * dynamic table stays the same.
+ */
+int
+lsquic_frame_writer_write_headers_tmpl (struct lsquic_frame_writer *fw,
+                        uint32_t stream_id, struct lsquic_hdr_tmpl *tmpl,
+                        const struct lsquic_http_headers *headers, int eos,
+                        unsigned weight)
+{
+    struct header_framer_ctx hfc;
+    struct http_prio_frame prio_frame;
+    struct lsquic_http_headers pseudo, regular;
+    lsquic_cid_t cid;
+    uint64_t gen;
+    unsigned char *buf;
+    int i, s, use_enc;
+
+    /* Internal function: weight must be valid here */
+    assert(weight >= 1 && weight <= 256);
+
+    pseudo.headers = NULL;
+    pseudo.count = 0;
+    regular = pseudo;
+    if (headers)
+    {
+        if (0 != check_headers_case(fw, headers))
+            return -1;
+
+        if (have_oversize_strings(headers))
+            return -1;
+
+        for (i = 0; i < headers->count; ++i)
+            if (headers->headers[i].name.iov_len > 0
+                && ':' == *(char *) headers->headers[i].name.iov_base)
+            {
+                if (i != pseudo.count)
+                {
+                    LSQ_INFO("pseudo-header follows regular header");
+                    errno = EINVAL;
+                    return -1;
+                }
+                ++pseudo.count;
+            }
+        pseudo.headers = headers->headers;
+        regular.headers = headers->headers + pseudo.count;
+        regular.count = headers->count - pseudo.count;
+    }
+
+    if (fw->fw_max_header_list_sz && 0 != check_list_size(fw,
+            tmpl->ht_list_size + (headers ? calc_headers_size(headers) : 0)))
+        return -1;
+
+    s = write_headers_start(fw, &hfc, &prio_frame, stream_id, eos, weight);
+    if (s < 0)
+        return s;
+
+    if (headers && headers->count > 0)
+    {
+        buf = malloc(MAX_HEADERS_SIZE);
+        if (!buf)
+            return -1;
+    }
+    else
+        buf = NULL;
+
+    cid = lsquic_conn_id(lsquic_stream_conn(fw->fw_stream));
+    gen = lshpack_enc_table_gen(fw->fw_henc);
+    use_enc = tmpl->ht_henc == fw->fw_henc && tmpl->ht_cid == cid
+                                                    && tmpl->ht_gen == gen;
+    if (!use_enc)
+    {
+        tmpl->ht_henc = NULL;
+        tmpl->ht_enc_sz = 0;
+    }
+
+    if (use_enc)
+        s = hfc_write(&hfc, tmpl->ht_enc, tmpl->ht_enc_pseudo_sz);
+    else
+    {
+        s = write_tmpl_headers(fw, tmpl, 0, tmpl->ht_n_pseudo, &hfc);
+        tmpl->ht_enc_pseudo_sz = tmpl->ht_enc_sz;
+    }
+    if (0 == s)
+        s = write_headers(fw, &pseudo, &hfc, buf, MAX_HEADERS_SIZE, 1);
+    if (0 == s)
+    {
+        if (use_enc)
+            s = hfc_write(&hfc, tmpl->ht_enc + tmpl->ht_enc_pseudo_sz,
+                                tmpl->ht_enc_sz - tmpl->ht_enc_pseudo_sz);
+        else
+            s = write_tmpl_headers(fw, tmpl, tmpl->ht_n_pseudo,
+                                        tmpl->ht_headers.count, &hfc);
+    }
+    if (0 == s)
+        s = write_headers(fw, &regular, &hfc, buf, MAX_HEADERS_SIZE, 1);
+    free(buf);
+    if (s != 0)
+        return s;
+
+    if (use_enc)
+    {
+        LSQ_DEBUG("reused %u-byte template header block", tmpl->ht_enc_sz);
+#if LSQUIC_CONN_STATS
+        fw->fw_conn_stats->out.headers_uncomp += tmpl->ht_uncomp_sz;
+        fw->fw_conn_stats->out.headers_comp += tmpl->ht_enc_sz;
+#endif
+    }
+    else if (gen == lshpack_enc_table_gen(fw->fw_henc))
+    {
+        /* Nothing was added to the dynamic table: the header block can
+         * be used again.
+         */
+        tmpl->ht_henc = fw->fw_henc;
+        tmpl->ht_cid = cid;
+        tmpl->ht_gen = gen;
+    }
+
+    EV_LOG_GENERATED_HTTP_HEADERS(LSQUIC_LOG_CONN_ID, stream_id,
+        fw->fw_flags & FW_SERVER, &prio_frame, &tmpl->ht_headers, headers);
+    hfc_terminate_frame(&hfc, HFHF_END_HEADERS);
+    return lsquic_frame_writer_flush(fw);
+}
+
+
 int
 lsquic_frame_writer_write_promise (struct lsquic_frame_writer *fw,
                            uint32_t stream_id, uint32_t promised_stream_id,
@@ -606,7 +804,7 @@ lsquic_frame_writer_write_promise (struct lsquic_frame_writer *fw,
     if (!buf)
         return -1;
 
-    s = write_headers(fw, &mpas, &hfc, buf, MAX_HEADERS_SIZE);
+    s = write_headers(fw, &mpas, &hfc, buf, MAX_HEADERS_SIZE, 0);
     if (s != 0)
     {
         free(buf);
@@ -614,7 +812,8 @@ lsquic_frame_writer_write_promise (struct lsquic_frame_writer *fw,
     }
 
     if (extra_headers)
-        s = write_headers(fw, extra_headers, &hfc, buf, MAX_HEADERS_SIZE);
+        s = write_headers(fw, extra_headers, &hfc, buf,
+                                                        MAX_HEADERS_SIZE, 0);
 
     free(buf);
 
@@ -734,7 +933,7 @@ lsquic_frame_writer_write_priority (struct lsquic_frame_writer *fw,
     stream_id = htonl(stream_id);
     memcpy(fh->hfh_stream_id, &stream_id, 4);
 
-    stream_dep_id |= !!exclusive << 31;
+    stream_dep_id |= (uint32_t) !!exclusive << 31;
     stream_id = htonl(stream_dep_id);
     memcpy(prio_frame->hpf_stream_id, &stream_id, 4);
     prio_frame->hpf_weight = weight - 1;
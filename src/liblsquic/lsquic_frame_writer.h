@@ -17,6 +17,7 @@ struct lsquic_mm;
 struct lsquic_frame_writer;
 struct lsquic_stream;
 struct lsquic_http_headers;
+struct lsquic_hdr_tmpl;
 struct lsquic_http2_setting;
 #if LSQUIC_CONN_STATS
 struct conn_stats;
@@ -48,6 +49,13 @@ lsquic_frame_writer_write_headers (struct lsquic_frame_writer *,
                                    const struct lsquic_http_headers *,
                                    int eos, unsigned weight);
 
+int
+lsquic_frame_writer_write_headers_tmpl (struct lsquic_frame_writer *,
+                                        uint32_t stream_id,
+                                        struct lsquic_hdr_tmpl *,
+                                        const struct lsquic_http_headers *,
+                                        int eos, unsigned weight);
+
 int
 lsquic_frame_writer_write_settings (struct lsquic_frame_writer *,
     const struct lsquic_http2_setting *, unsigned n_settings);
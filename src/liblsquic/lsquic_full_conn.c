@@ -50,6 +50,7 @@
 #include "lsquic_ev_log.h"
 #include "lsquic_version.h"
 #include "lsquic_hash.h"
+#include "lsquic_stream_win.h"
 #include "lsquic_headers.h"
 
 #include "lsquic_conn.h"
@@ -100,6 +101,9 @@ enum full_conn_flags {
     FC_HAVE_SAVED_ACK = (1 <<22),
     FC_ABORT_COMPLAINED
                       = (1 <<23),
+    FC_COMPACT        = (1 <<24),   /* Compact connection when it goes quiet */
+    FC_HIBERNATE_NOW  = (1 <<25),   /* Idle long enough to hibernate */
+    FC_HIBERNATING    = (1 <<26),   /* See hibernate_conn() */
 };
 
 #define FC_IMMEDIATE_CLOSE_FLAGS \
@@ -121,7 +125,7 @@ struct stream_history
 #endif
 
 #ifndef KEEP_PACKET_HISTORY
-#ifdef NDEBUG
+#if defined(NDEBUG) || LSQUIC_COMPACT
 #define KEEP_PACKET_HISTORY 0
 #else
 #define KEEP_PACKET_HISTORY 16
@@ -162,6 +166,10 @@ struct full_conn
     struct lsquic_conn_public    fc_pub;
     lsquic_alarmset_t            fc_alset;
     lsquic_set32_t               fc_closed_stream_ids[2];
+    /* Index of streams in fc_pub.all_streams by stream ID parity.  Streams
+     * that do not fit into the window are only in the hash.
+     */
+    struct lsquic_stream_win     fc_stream_wins[2];
     const struct lsquic_engine_settings
                                 *fc_settings;
     struct lsquic_engine_public *fc_enpub;
@@ -206,6 +214,22 @@ struct full_conn
                                  fc_stream_ids_to_reset;
     struct short_ack_info        fc_saved_ack_info;
     lsquic_time_t                fc_saved_ack_received;
+    /* Incoming packets are decrypted as they arrive, but their frames are
+     * not parsed until the next tick.  See process_pending_packets().
+     */
+    TAILQ_HEAD(, lsquic_packet_in)
+                                 fc_pending_packets;
+    /* Largest packet number among the pending packets, used to restore
+     * packet numbers before the receive history is updated:
+     */
+    lsquic_packno_t              fc_max_pending_packno;
+    /* Preconnected connection is kept alive using PINGs until this time: */
+    lsquic_time_t                fc_preconn_deadline;
+    /* While the connection hibernates, its handshake and headers streams
+     * are kept here instead of in the stream hash:
+     */
+    lsquic_stream_t             *fc_hib_streams[2];
+    unsigned                     fc_n_hib_streams;
 };
 
 
@@ -230,6 +254,12 @@ struct full_conn
 #define ABORT_WARN(...) \
     ABORT_WITH_FLAG(conn, LSQ_LOG_WARN, FC_ERROR, __VA_ARGS__)
 
+static void
+process_pending_packets (struct full_conn *);
+
+static void
+drop_pending_packets (struct full_conn *);
+
 static void
 idle_alarm_expired (void *ctx, lsquic_time_t expiry, lsquic_time_t now);
 
@@ -242,6 +272,9 @@ handshake_alarm_expired (void *ctx, lsquic_time_t expiry, lsquic_time_t now);
 static void
 ack_alarm_expired (void *ctx, lsquic_time_t expiry, lsquic_time_t now);
 
+static void
+hibernate_alarm_expired (void *ctx, lsquic_time_t expiry, lsquic_time_t now);
+
 static lsquic_stream_t *
 new_stream (struct full_conn *conn, uint32_t stream_id, enum stream_ctor_flags);
 
@@ -253,6 +286,8 @@ write_is_possible (struct full_conn *);
 
 static const struct headers_stream_callbacks *headers_callbacks_ptr;
 
+static const struct conn_iface *full_conn_iface_ptr;
+
 #if KEEP_CLOSED_STREAM_HISTORY
 
 static void
@@ -341,30 +376,316 @@ highest_bit_set (unsigned sz)
 }
 
 
-static size_t
-calc_mem_used (const struct full_conn *conn)
+static void
+get_mem_report (const struct full_conn *conn,
+                                    struct lsquic_conn_mem_report *report)
 {
     const lsquic_stream_t *stream;
     const struct lsquic_hash_elem *el;
-    size_t size;
+    unsigned n;
+
+    report->cmr_send_ctl = lsquic_send_ctl_mem_used(&conn->fc_send_ctl);
+    report->cmr_rechist = lsquic_rechist_mem_used(&conn->fc_rechist);
+    report->cmr_closed_streams =
+                lsquic_set32_mem_used(&conn->fc_closed_stream_ids[0])
+              + lsquic_set32_mem_used(&conn->fc_closed_stream_ids[1]);
+#if KEEP_CLOSED_STREAM_HISTORY
+    report->cmr_stream_hist = sizeof(conn->fc_stream_histories);
+#else
+    report->cmr_stream_hist = 0;
+#endif
+    report->cmr_conn = sizeof(*conn)
+                     - sizeof(conn->fc_send_ctl)
+                     - sizeof(conn->fc_rechist)
+                     - sizeof(conn->fc_closed_stream_ids)
+                     - report->cmr_stream_hist;
+    if (conn->fc_errmsg)
+        report->cmr_conn += MAX_ERRMSG;
+
+    if (conn->fc_pub.packet_out_malo)
+        report->cmr_packet_objs =
+                        lsquic_malo_mem_used(conn->fc_pub.packet_out_malo);
+    else
+        report->cmr_packet_objs = 0;
+
+    report->cmr_streams = 0;
+    if (conn->fc_pub.all_streams)
+    {
+        report->cmr_stream_hash =
+                    lsquic_hash_mem_used(conn->fc_pub.all_streams)
+                  + lsquic_stream_win_mem_used(&conn->fc_stream_wins[0])
+                  + lsquic_stream_win_mem_used(&conn->fc_stream_wins[1])
+                  - sizeof(conn->fc_stream_wins);
+        for (el = lsquic_hash_first(conn->fc_pub.all_streams); el;
+                             el = lsquic_hash_next(conn->fc_pub.all_streams))
+        {
+            stream = lsquic_hashelem_getdata(el);
+            report->cmr_streams += lsquic_stream_mem_used(stream);
+        }
+    }
+    else
+    {
+        /* Hibernating */
+        report->cmr_stream_hash = 0;
+        for (n = 0; n < conn->fc_n_hib_streams; ++n)
+            report->cmr_streams +=
+                            lsquic_stream_mem_used(conn->fc_hib_streams[n]);
+    }
 
-    size = sizeof(*conn);
-    size -= sizeof(conn->fc_send_ctl);
-    size += lsquic_send_ctl_mem_used(&conn->fc_send_ctl);
-    size += lsquic_hash_mem_used(conn->fc_pub.all_streams);
-    size += lsquic_malo_mem_used(conn->fc_pub.packet_out_malo);
     if (conn->fc_pub.hs)
-        size += lsquic_headers_stream_mem_used(conn->fc_pub.hs);
+        report->cmr_headers = lsquic_headers_stream_mem_used(conn->fc_pub.hs);
+    else
+        report->cmr_headers = 0;
+
+    if (conn->fc_conn.cn_enc_session)
+        report->cmr_handshake = conn->fc_conn.cn_esf->esf_mem_used(
+                                                conn->fc_conn.cn_enc_session);
+    else
+        report->cmr_handshake = 0;
+
+    report->cmr_in_pinned = conn->fc_pub.in_pinned;
+    report->cmr_in_useful = conn->fc_pub.in_useful;
+
+    report->cmr_total = report->cmr_conn + report->cmr_send_ctl
+        + report->cmr_rechist + report->cmr_closed_streams
+        + report->cmr_stream_hist + report->cmr_packet_objs
+        + report->cmr_stream_hash + report->cmr_streams
+        + report->cmr_headers + report->cmr_handshake;
+}
+
+
+int
+lsquic_conn_get_mem_report (const lsquic_conn_t *lconn,
+                                    struct lsquic_conn_mem_report *report)
+{
+    const struct full_conn *const conn = (const struct full_conn *) lconn;
+
+    if (lconn->cn_if != full_conn_iface_ptr)
+        return -1;
+
+    get_mem_report(conn, report);
+    return 0;
+}
+
+
+/* Release state that is not needed while the connection is quiet */
+static void
+compact_conn (struct full_conn *conn)
+{
+    struct lsquic_hash_elem *el;
+    size_t before;
+    struct lsquic_conn_mem_report report;
+
+    if (LSQ_LOG_ENABLED(LSQ_LOG_DEBUG))
+    {
+        get_mem_report(conn, &report);
+        before = report.cmr_total;
+    }
+    else
+        before = 0;
+
+    conn->fc_flags &= ~FC_COMPACT;
+    if (conn->fc_conn.cn_enc_session && conn->fc_conn.cn_esf->esf_compact
+            && (conn->fc_conn.cn_flags & LSCONN_HANDSHAKE_DONE))
+        conn->fc_conn.cn_esf->esf_compact(conn->fc_conn.cn_enc_session);
+
+    for (el = lsquic_hash_first(conn->fc_pub.all_streams); el;
+                                 el = lsquic_hash_next(conn->fc_pub.all_streams))
+        lsquic_stream_compact(lsquic_hashelem_getdata(el));
+
+    if (LSQ_LOG_ENABLED(LSQ_LOG_DEBUG))
+    {
+        get_mem_report(conn, &report);
+        LSQ_DEBUG("compacted connection: %zd -> %zd bytes", before,
+                                                        report.cmr_total);
+    }
+}
+
+
+/* Connection is idle when the only streams it has are the handshake and
+ * headers streams.
+ */
+static int
+conn_is_idle (struct full_conn *conn)
+{
+    const lsquic_stream_t *stream;
+    struct lsquic_hash_elem *el;
+
+    if (!(conn->fc_conn.cn_flags & LSCONN_HANDSHAKE_DONE)
+        || (conn->fc_flags & (FC_IMMEDIATE_CLOSE_FLAGS|FC_CLOSING
+                                            |FC_GOING_AWAY|FC_RECV_CLOSE))
+        || conn->fc_n_delayed_streams > 0)
+        return 0;
 
     for (el = lsquic_hash_first(conn->fc_pub.all_streams); el;
                                  el = lsquic_hash_next(conn->fc_pub.all_streams))
     {
         stream = lsquic_hashelem_getdata(el);
-        size += lsquic_stream_mem_used(stream);
+        if (!lsquic_stream_is_critical(stream))
+            return 0;
     }
-    size += conn->fc_conn.cn_esf->esf_mem_used(conn->fc_conn.cn_enc_session);
 
-    return size;
+    return 1;
+}
+
+
+/* Idle connection can hibernate once it has nothing to send and no
+ * retransmittable packets in flight.
+ */
+static int
+can_hibernate (struct full_conn *conn)
+{
+    return lsquic_send_ctl_is_idle(&conn->fc_send_ctl)
+        && !(conn->fc_flags & (FC_SEND_PING|FC_SEND_GOAWAY|FC_SEND_WUF
+                    |FC_SEND_STOP_WAITING|FC_ACK_QUEUED|FC_HAVE_SAVED_ACK))
+        && !lsquic_alarmset_is_set(&conn->fc_alset, AL_ACK)
+        && TAILQ_EMPTY(&conn->fc_pending_packets)
+        && TAILQ_EMPTY(&conn->fc_pub.sending_streams)
+        && TAILQ_EMPTY(&conn->fc_pub.service_streams)
+        && STAILQ_EMPTY(&conn->fc_stream_ids_to_reset)
+        && lsquic_hash_count(conn->fc_pub.all_streams)
+                <= sizeof(conn->fc_hib_streams)
+                                        / sizeof(conn->fc_hib_streams[0]);
+}
+
+
+/* Hibernating connection keeps only what it needs to answer the next
+ * packet or to resume sending: handshake keys, receive history, flow
+ * control state, and the handshake and headers streams.  The latter
+ * keep the HPACK tables, which must stay in sync with the peer.  The
+ * stream hash and the packet object pool are released.
+ */
+static void
+hibernate_conn (struct full_conn *conn)
+{
+    struct lsquic_hash_elem *el;
+    size_t before;
+    struct lsquic_conn_mem_report report;
+
+    if (LSQ_LOG_ENABLED(LSQ_LOG_DEBUG))
+    {
+        get_mem_report(conn, &report);
+        before = report.cmr_total;
+    }
+    else
+        before = 0;
+
+    compact_conn(conn);
+
+    conn->fc_n_hib_streams = 0;
+    while ((el = lsquic_hash_first(conn->fc_pub.all_streams)))
+    {
+        conn->fc_hib_streams[ conn->fc_n_hib_streams++ ] =
+                                                lsquic_hashelem_getdata(el);
+        lsquic_hash_erase(conn->fc_pub.all_streams, el);
+    }
+    lsquic_hash_destroy(conn->fc_pub.all_streams);
+    conn->fc_pub.all_streams = NULL;
+    lsquic_stream_win_cleanup(&conn->fc_stream_wins[0]);
+    lsquic_stream_win_cleanup(&conn->fc_stream_wins[1]);
+
+    /* ACK-only packets may still be waiting to be acknowledged.  Packets
+     * allocated while the pool is gone come from the shared pool.
+     */
+    if (conn->fc_pub.packet_out_malo
+                        && lsquic_send_ctl_is_empty(&conn->fc_send_ctl))
+    {
+        lsquic_malo_destroy(conn->fc_pub.packet_out_malo);
+        conn->fc_pub.packet_out_malo = NULL;
+    }
+
+    conn->fc_flags |= FC_HIBERNATING;
+
+    if (LSQ_LOG_ENABLED(LSQ_LOG_DEBUG))
+    {
+        get_mem_report(conn, &report);
+        LSQ_DEBUG("hibernate: %zd -> %zd bytes", before, report.cmr_total);
+    }
+}
+
+
+/* Restore state released by hibernate_conn().  Returns 0 on success and
+ * -1 if memory could not be allocated, in which case the connection stays
+ * hibernating.
+ */
+static int
+wake_conn (struct full_conn *conn)
+{
+    lsquic_stream_t *stream;
+    unsigned n;
+
+    if (!(conn->fc_flags & FC_HIBERNATING))
+        return 0;
+
+    conn->fc_pub.all_streams = lsquic_hash_create();
+    if (!conn->fc_pub.all_streams)
+        return -1;
+
+    for (n = 0; n < conn->fc_n_hib_streams; ++n)
+    {
+        stream = conn->fc_hib_streams[n];
+        if (!lsquic_hash_insert(conn->fc_pub.all_streams, &stream->id,
+                                                sizeof(stream->id), stream))
+        {
+            lsquic_hash_destroy(conn->fc_pub.all_streams);
+            conn->fc_pub.all_streams = NULL;
+            lsquic_stream_win_cleanup(&conn->fc_stream_wins[0]);
+            lsquic_stream_win_cleanup(&conn->fc_stream_wins[1]);
+            return -1;
+        }
+        if (!lsquic_stream_is_critical(stream))
+            (void) lsquic_stream_win_insert(
+                    &conn->fc_stream_wins[stream->id & 1], stream->id, stream);
+    }
+
+    if (!conn->fc_pub.packet_out_malo && !conn->fc_settings->es_compact)
+        /* If this fails, packets keep coming from the shared pool */
+        conn->fc_pub.packet_out_malo = lsquic_mm_malo_create(
+                    conn->fc_pub.mm, sizeof(struct lsquic_packet_out));
+
+    conn->fc_n_hib_streams = 0;
+    conn->fc_flags &= ~FC_HIBERNATING;
+    LSQ_DEBUG("woke up from hibernation");
+    return 0;
+}
+
+
+/* Called when the user is about to use the connection.  Unlike a wakeup
+ * due to an incoming packet or an alarm, this resets the idle timer.
+ */
+static int
+wake_conn_for_user (struct full_conn *conn)
+{
+    conn->fc_flags &= ~FC_HIBERNATE_NOW;
+    lsquic_alarmset_unset(&conn->fc_alset, AL_HIBERNATE);
+    if (0 == wake_conn(conn))
+        return 0;
+    ABORT_ERROR("cannot wake up connection: %s", strerror(errno));
+    return -1;
+}
+
+
+/* Called when the connection has gone quiet */
+static void
+maybe_hibernate (struct full_conn *conn, lsquic_time_t now)
+{
+    if (!conn_is_idle(conn))
+    {
+        conn->fc_flags &= ~FC_HIBERNATE_NOW;
+        lsquic_alarmset_unset(&conn->fc_alset, AL_HIBERNATE);
+    }
+    else if (conn->fc_flags & FC_HIBERNATE_NOW)
+    {
+        /* The flag stays set: after being woken up by an incoming packet
+         * or an alarm, the connection goes back to sleep as soon as it
+         * is quiet again.
+         */
+        if (can_hibernate(conn))
+            hibernate_conn(conn);
+    }
+    else if (!lsquic_alarmset_is_set(&conn->fc_alset, AL_HIBERNATE))
+        lsquic_alarmset_set(&conn->fc_alset, AL_HIBERNATE,
+                                    now + conn->fc_settings->es_hibernate_after);
 }
 
 
@@ -515,8 +836,6 @@ apply_peer_settings (struct full_conn *conn)
 }
 
 
-static const struct conn_iface *full_conn_iface_ptr;
-
 static struct full_conn *
 new_conn_common (lsquic_cid_t cid, struct lsquic_engine_public *enpub,
                  const struct lsquic_stream_if *stream_if,
@@ -544,8 +863,19 @@ new_conn_common (lsquic_cid_t cid, struct lsquic_engine_public *enpub,
 #if LSQUIC_CONN_STATS
     conn->fc_pub.conn_stats = &conn->fc_stats;
 #endif
-    conn->fc_pub.packet_out_malo =
-                        lsquic_malo_create(sizeof(struct lsquic_packet_out));
+    /* In compact mode, packets come from the memory manager's shared pool
+     * and the connection does not keep a page for its own.
+     */
+    if (!enpub->enp_settings.es_compact)
+    {
+        conn->fc_pub.packet_out_malo = lsquic_mm_malo_create(&enpub->enp_mm,
+                                            sizeof(struct lsquic_packet_out));
+        if (!conn->fc_pub.packet_out_malo)
+        {
+            free(conn);
+            return NULL;
+        }
+    }
     conn->fc_stream_ifs[STREAM_IF_STD].stream_if     = stream_if;
     conn->fc_stream_ifs[STREAM_IF_STD].stream_if_ctx = stream_if_ctx;
     conn->fc_settings = &enpub->enp_settings;
@@ -571,14 +901,18 @@ new_conn_common (lsquic_cid_t cid, struct lsquic_engine_public *enpub,
     TAILQ_INIT(&conn->fc_pub.write_streams);
     TAILQ_INIT(&conn->fc_pub.service_streams);
     STAILQ_INIT(&conn->fc_stream_ids_to_reset);
+    TAILQ_INIT(&conn->fc_pending_packets);
     lsquic_conn_cap_init(&conn->fc_pub.conn_cap, LSQUIC_MIN_FCW);
     lsquic_alarmset_init(&conn->fc_alset, cid);
     lsquic_alarmset_init_alarm(&conn->fc_alset, AL_IDLE, idle_alarm_expired, conn);
     lsquic_alarmset_init_alarm(&conn->fc_alset, AL_ACK, ack_alarm_expired, conn);
     lsquic_alarmset_init_alarm(&conn->fc_alset, AL_PING, ping_alarm_expired, conn);
     lsquic_alarmset_init_alarm(&conn->fc_alset, AL_HANDSHAKE, handshake_alarm_expired, conn);
+    lsquic_alarmset_init_alarm(&conn->fc_alset, AL_HIBERNATE, hibernate_alarm_expired, conn);
     lsquic_set32_init(&conn->fc_closed_stream_ids[0]);
     lsquic_set32_init(&conn->fc_closed_stream_ids[1]);
+    lsquic_stream_win_init(&conn->fc_stream_wins[0]);
+    lsquic_stream_win_init(&conn->fc_stream_wins[1]);
     lsquic_cfcw_init(&conn->fc_pub.cfcw, &conn->fc_pub, conn->fc_settings->es_cfcw);
     lsquic_send_ctl_init(&conn->fc_send_ctl, &conn->fc_alset, conn->fc_enpub,
                  &conn->fc_ver_neg, &conn->fc_pub, conn->fc_conn.cn_pack_size);
@@ -620,6 +954,10 @@ new_conn_common (lsquic_cid_t cid, struct lsquic_engine_public *enpub,
 
     if (conn->fc_pub.all_streams)
         lsquic_hash_destroy(conn->fc_pub.all_streams);
+    lsquic_stream_win_cleanup(&conn->fc_stream_wins[0]);
+    lsquic_stream_win_cleanup(&conn->fc_stream_wins[1]);
+    if (conn->fc_pub.packet_out_malo)
+        lsquic_malo_destroy(conn->fc_pub.packet_out_malo);
     lsquic_rechist_cleanup(&conn->fc_rechist);
     if (conn->fc_flags & FC_HTTP)
     {
@@ -695,9 +1033,32 @@ void
 full_conn_client_call_on_new (struct lsquic_conn *lconn)
 {
     struct full_conn *const conn = (struct full_conn *) lconn;
+    const int was_preconn = !!(lconn->cn_flags & LSCONN_PRECONN);
+
     assert(conn->fc_flags & FC_CREATED_OK);
+    lconn->cn_flags &= ~LSCONN_PRECONN;
     conn->fc_conn_ctx = conn->fc_stream_ifs[STREAM_IF_STD].stream_if
         ->on_new_conn(conn->fc_stream_ifs[STREAM_IF_STD].stream_if_ctx, lconn);
+    /* The handshake of a preconnected connection may have completed while
+     * it was waiting to be handed out:
+     */
+    if (was_preconn && (lconn->cn_flags & LSCONN_HANDSHAKE_DONE)
+                && conn->fc_stream_ifs[STREAM_IF_STD].stream_if->on_hsk_done)
+        conn->fc_stream_ifs[STREAM_IF_STD].stream_if->on_hsk_done(lconn, 1);
+}
+
+
+void
+full_conn_client_preconnect (struct lsquic_conn *lconn,
+                                            lsquic_time_t keepalive_until)
+{
+    struct full_conn *const conn = (struct full_conn *) lconn;
+
+    assert(conn->fc_flags & FC_CREATED_OK);
+    lconn->cn_flags |= LSCONN_PRECONN;
+    conn->fc_preconn_deadline = keepalive_until;
+    LSQ_DEBUG("preconnected; keep alive for %"PRIu64" usec",
+                                    keepalive_until - lsquic_time_now());
 }
 
 
@@ -709,12 +1070,26 @@ is_our_stream (const struct full_conn *conn, const lsquic_stream_t *stream)
 }
 
 
+static int
+stream_counts (const lsquic_stream_t *stream, int is_server, int peer)
+{
+    int ours;
+
+    ours = (1 & stream->id) ^ is_server;
+    return (ours ^ peer)
+        && !(lsquic_stream_is_closed(stream)
+                        /* When counting peer-initiated streams, do not
+                         * include those that have been reset:
+                         */
+                        || (peer && lsquic_stream_is_reset(stream)));
+}
+
+
 static unsigned
 count_streams (const struct full_conn *conn, int peer)
 {
     const lsquic_stream_t *stream;
-    unsigned count;
-    int ours;
+    unsigned count, n;
     int is_server;
     struct lsquic_hash_elem *el;
 
@@ -722,18 +1097,17 @@ count_streams (const struct full_conn *conn, int peer)
     is_server = !!(conn->fc_flags & FC_SERVER);
     count = 0;
 
-    for (el = lsquic_hash_first(conn->fc_pub.all_streams); el;
+    if (conn->fc_pub.all_streams)
+        for (el = lsquic_hash_first(conn->fc_pub.all_streams); el;
                                  el = lsquic_hash_next(conn->fc_pub.all_streams))
-    {
-        stream = lsquic_hashelem_getdata(el);
-        ours = (1 & stream->id) ^ is_server;
-        if (ours ^ peer)
-            count += !(lsquic_stream_is_closed(stream)
-                                /* When counting peer-initiated streams, do not
-                                 * include those that have been reset:
-                                 */
-                                || (peer && lsquic_stream_is_reset(stream)));
-    }
+        {
+            stream = lsquic_hashelem_getdata(el);
+            count += stream_counts(stream, is_server, peer);
+        }
+    else
+        /* Hibernating */
+        for (n = 0; n < conn->fc_n_hib_streams; ++n)
+            count += stream_counts(conn->fc_hib_streams[n], is_server, peer);
 
     return count;
 }
@@ -783,16 +1157,27 @@ full_conn_ci_destroy (lsquic_conn_t *lconn)
 
     LSQ_DEBUG("destroy connection");
     conn->fc_flags |= FC_CLOSING;
+    drop_pending_packets(conn);
     lsquic_set32_cleanup(&conn->fc_closed_stream_ids[0]);
     lsquic_set32_cleanup(&conn->fc_closed_stream_ids[1]);
-    while ((el = lsquic_hash_first(conn->fc_pub.all_streams)))
+    lsquic_stream_win_cleanup(&conn->fc_stream_wins[0]);
+    lsquic_stream_win_cleanup(&conn->fc_stream_wins[1]);
+    if (conn->fc_flags & FC_HIBERNATING)
+        while (conn->fc_n_hib_streams > 0)
+            lsquic_stream_destroy(
+                        conn->fc_hib_streams[ --conn->fc_n_hib_streams ]);
+    else
     {
-        stream = lsquic_hashelem_getdata(el);
-        lsquic_hash_erase(conn->fc_pub.all_streams, el);
-        lsquic_stream_destroy(stream);
+        while ((el = lsquic_hash_first(conn->fc_pub.all_streams)))
+        {
+            stream = lsquic_hashelem_getdata(el);
+            lsquic_hash_erase(conn->fc_pub.all_streams, el);
+            lsquic_stream_destroy(stream);
+        }
+        lsquic_hash_destroy(conn->fc_pub.all_streams);
     }
-    lsquic_hash_destroy(conn->fc_pub.all_streams);
-    if (conn->fc_flags & FC_CREATED_OK)
+    if ((conn->fc_flags & FC_CREATED_OK)
+                            && !(conn->fc_conn.cn_flags & LSCONN_PRECONN))
         conn->fc_stream_ifs[STREAM_IF_STD].stream_if
                     ->on_conn_closed(&conn->fc_conn);
     if (conn->fc_pub.hs)
@@ -802,7 +1187,8 @@ full_conn_ci_destroy (lsquic_conn_t *lconn)
     lsquic_rechist_cleanup(&conn->fc_rechist);
     if (conn->fc_conn.cn_enc_session)
         conn->fc_conn.cn_esf->esf_destroy(conn->fc_conn.cn_enc_session);
-    lsquic_malo_destroy(conn->fc_pub.packet_out_malo);
+    if (conn->fc_pub.packet_out_malo)
+        lsquic_malo_destroy(conn->fc_pub.packet_out_malo);
 #if LSQUIC_CONN_STATS
     LSQ_NOTICE("# ticks: %lu", conn->fc_stats.n_ticks);
     LSQ_NOTICE("received %lu packets, of which %lu were not decryptable, %lu were "
@@ -815,6 +1201,9 @@ full_conn_ci_destroy (lsquic_conn_t *lconn)
     LSQ_NOTICE("ACKs: in: %lu; processed: %lu; merged to: new %lu, old %lu",
         conn->fc_stats.in.n_acks, conn->fc_stats.in.n_acks_proc,
         conn->fc_stats.in.n_acks_merged[0], conn->fc_stats.in.n_acks_merged[1]);
+    LSQ_NOTICE("incoming packets: decrypted in %lu cycles; parsed in %lu "
+        "batches in %lu usec", conn->fc_stats.in.decrypt_cycles,
+        conn->fc_stats.in.batches, conn->fc_stats.in.parse_usec);
 #endif
     while ((sitr = STAILQ_FIRST(&conn->fc_stream_ids_to_reset)))
     {
@@ -1001,8 +1390,17 @@ new_stream_ext (struct full_conn *conn, uint32_t stream_id, int if_idx,
         conn->fc_stream_ifs[if_idx].stream_if_ctx, conn->fc_settings->es_sfcw,
         conn->fc_cfg.max_stream_send, stream_ctor_flags);
     if (stream)
+    {
         lsquic_hash_insert(conn->fc_pub.all_streams, &stream->id, sizeof(stream->id),
                                                                         stream);
+        /* The handshake and headers streams live as long as the connection
+         * does and would keep the window from sliding.  They are looked up
+         * in the hash.
+         */
+        if (!lsquic_stream_is_critical(stream))
+            (void) lsquic_stream_win_insert(
+                    &conn->fc_stream_wins[stream_id & 1], stream_id, stream);
+    }
     return stream;
 }
 
@@ -1075,8 +1473,12 @@ either_side_going_away (const struct full_conn *conn)
 unsigned
 lsquic_conn_n_avail_streams (const lsquic_conn_t *lconn)
 {
-    struct full_conn *conn = (struct full_conn *) lconn;
-    unsigned stream_count = count_streams(conn, 0);
+    /* Hibernating connection is not woken up: the streams it keeps are
+     * counted where they are.
+     */
+    const struct full_conn *conn = (const struct full_conn *) lconn;
+    unsigned stream_count;
+    stream_count = count_streams(conn, 0);
     if (conn->fc_cfg.max_streams_out < stream_count)
         return 0;
     return conn->fc_cfg.max_streams_out - stream_count;
@@ -1087,6 +1489,8 @@ void
 lsquic_conn_make_stream (lsquic_conn_t *lconn)
 {
     struct full_conn *conn = (struct full_conn *) lconn;
+    if (0 != wake_conn_for_user(conn))
+        return;
     if (lsquic_conn_n_avail_streams(lconn) > 0)
     {
         if (!new_stream(conn, generate_stream_id(conn), SCF_CALL_ON_NEW))
@@ -1108,6 +1512,21 @@ static lsquic_stream_t *
 find_stream_by_id (struct full_conn *conn, uint32_t stream_id)
 {
     struct lsquic_hash_elem *el;
+    lsquic_stream_t *stream;
+
+    stream = lsquic_stream_win_find(&conn->fc_stream_wins[stream_id & 1],
+                                                                stream_id);
+    if (stream)
+        return stream;
+
+    /* If all streams are in the windows, there is no need to search the
+     * hash:
+     */
+    if (lsquic_hash_count(conn->fc_pub.all_streams)
+                == lsquic_stream_win_count(&conn->fc_stream_wins[0])
+                 + lsquic_stream_win_count(&conn->fc_stream_wins[1]))
+        return NULL;
+
     el = lsquic_hash_find(conn->fc_pub.all_streams, &stream_id, sizeof(stream_id));
     if (el)
         return lsquic_hashelem_getdata(el);
@@ -1120,6 +1539,16 @@ lsquic_stream_t *
 lsquic_conn_get_stream_by_id (lsquic_conn_t *lconn, uint32_t stream_id)
 {
     struct full_conn *conn = (struct full_conn *) lconn;
+    unsigned n;
+
+    if (conn->fc_flags & FC_HIBERNATING)
+    {
+        /* Only the handshake and headers streams exist */
+        for (n = 0; n < conn->fc_n_hib_streams; ++n)
+            if (conn->fc_hib_streams[n]->id == stream_id)
+                return conn->fc_hib_streams[n];
+        return NULL;
+    }
     return find_stream_by_id(conn, stream_id);
 }
 
@@ -1386,7 +1815,8 @@ process_goaway_frame (struct full_conn *conn, lsquic_packet_in_t *packet_in,
     {
         conn->fc_conn.cn_flags |= LSCONN_PEER_GOING_AWAY;
         conn->fc_goaway_stream_id = stream_id;
-        if (conn->fc_stream_ifs[STREAM_IF_STD].stream_if->on_goaway_received)
+        if (conn->fc_stream_ifs[STREAM_IF_STD].stream_if->on_goaway_received
+                && !(conn->fc_conn.cn_flags & LSCONN_PRECONN))
         {
             LSQ_DEBUG("calling on_goaway_received");
             conn->fc_stream_ifs[STREAM_IF_STD].stream_if->on_goaway_received(
@@ -1941,6 +2371,8 @@ reconstruct_packet_number (struct full_conn *conn, lsquic_packet_in_t *packet_in
 
     cur_packno = packet_in->pi_packno;
     max_packno = lsquic_rechist_largest_packno(&conn->fc_rechist);
+    if (max_packno < conn->fc_max_pending_packno)
+        max_packno = conn->fc_max_pending_packno;
     bits = lsquic_packet_in_packno_bits(packet_in);
     packet_in->pi_packno = restore_packno(cur_packno, bits, max_packno);
     LSQ_DEBUG("reconstructed (bits: %u, packno: %"PRIu64", max: %"PRIu64") "
@@ -1998,7 +2430,9 @@ process_regular_packet (struct full_conn *conn, lsquic_packet_in_t *packet_in)
     enum quic_ft_bit frame_types;
     int was_missing;
 
-    reconstruct_packet_number(conn, packet_in);
+    /* Packet number has already been reconstructed by
+     * full_conn_ci_packet_in().
+     */
     EV_LOG_PACKET_IN(LSQUIC_LOG_CONN_ID, packet_in);
 
 #if LSQUIC_CONN_STATS
@@ -2151,6 +2585,16 @@ ping_alarm_expired (void *ctx, lsquic_time_t expiry, lsquic_time_t now)
 }
 
 
+static void
+hibernate_alarm_expired (void *ctx, lsquic_time_t expiry, lsquic_time_t now)
+{
+    struct full_conn *conn = ctx;
+    LSQ_DEBUG("connection has been idle for %lu usec: hibernate when quiet",
+                                    conn->fc_settings->es_hibernate_after);
+    conn->fc_flags |= FC_HIBERNATE_NOW;
+}
+
+
 static lsquic_packet_out_t *
 get_writeable_packet (struct full_conn *conn, unsigned need_at_least)
 {
@@ -2549,8 +2993,12 @@ service_streams (struct full_conn *conn)
             el = lsquic_hash_find(conn->fc_pub.all_streams, &stream->id, sizeof(stream->id));
             if (el)
                 lsquic_hash_erase(conn->fc_pub.all_streams, el);
+            lsquic_stream_win_remove(&conn->fc_stream_wins[stream->id & 1],
+                                                        stream->id, stream);
             SAVE_STREAM_HISTORY(conn, stream);
             lsquic_stream_destroy(stream);
+            if (conn->fc_settings->es_compact)
+                conn->fc_flags |= FC_COMPACT;
         }
     }
 
@@ -2833,13 +3281,32 @@ full_conn_ci_tick (lsquic_conn_t *lconn, lsquic_time_t now)
     ++conn->fc_stats.n_ticks;
 #endif
 
+    if (0 != wake_conn(conn))
+    {
+        ABORT_ERROR("cannot wake up connection: %s", strerror(errno));
+        CLOSE_IF_NECESSARY();
+    }
+
     if (LSQ_LOG_ENABLED(LSQ_LOG_DEBUG)
         && conn->fc_mem_logged_last + 1000000 <= now)
     {
+        struct lsquic_conn_mem_report report;
         conn->fc_mem_logged_last = now;
-        LSQ_DEBUG("memory used: %zd bytes", calc_mem_used(conn));
+        get_mem_report(conn, &report);
+        LSQ_DEBUG("memory used: %zd bytes: conn: %zd; send_ctl: %zd; "
+            "rechist: %zd; closed streams: %zd; stream hist: %zd; "
+            "packet objs: %zd; stream hash: %zd; streams: %zd; headers: %zd; "
+            "handshake: %zd; incoming packets pinned: %zd, stream data in "
+            "them: %zd", report.cmr_total, report.cmr_conn,
+            report.cmr_send_ctl, report.cmr_rechist,
+            report.cmr_closed_streams, report.cmr_stream_hist,
+            report.cmr_packet_objs, report.cmr_stream_hash,
+            report.cmr_streams, report.cmr_headers, report.cmr_handshake,
+            report.cmr_in_pinned, report.cmr_in_useful);
     }
 
+    process_pending_packets(conn);
+
     if (conn->fc_flags & FC_HAVE_SAVED_ACK)
     {
         (void) /* If there is an error, we'll fail shortly */
@@ -3042,6 +3509,10 @@ full_conn_ci_tick (lsquic_conn_t *lconn, lsquic_time_t now)
         }
         else
         {
+            if (conn->fc_flags & FC_COMPACT)
+                compact_conn(conn);
+            if (conn->fc_settings->es_hibernate_after)
+                maybe_hibernate(conn, now);
             tick |= TICK_QUIET;
             goto end;
         }
@@ -3062,7 +3533,10 @@ full_conn_ci_tick (lsquic_conn_t *lconn, lsquic_time_t now)
      *  " a stream is open.
      */
     if (0 == (conn->fc_flags & FC_SERVER) &&
-                                        lsquic_hash_count(conn->fc_pub.all_streams) > 0)
+                                        lsquic_hash_count(conn->fc_pub.all_streams) > 0
+        /* Preconnected connection that nobody claimed is let to time out: */
+        && !((conn->fc_conn.cn_flags & LSCONN_PRECONN)
+                                    && now >= conn->fc_preconn_deadline))
         lsquic_alarmset_set(&conn->fc_alset, AL_PING, now + TIME_BETWEEN_PINGS);
 
     tick |= TICK_SEND;
@@ -3081,15 +3555,108 @@ static void
 full_conn_ci_packet_in (lsquic_conn_t *lconn, lsquic_packet_in_t *packet_in)
 {
     struct full_conn *conn = (struct full_conn *) lconn;
+    int s;
+#if LSQUIC_CONN_STATS
+    uint64_t c_start;
+#endif
 
 #if LSQUIC_CONN_STATS
     conn->fc_stats.in.bytes += packet_in->pi_data_sz;
 #endif
     lsquic_alarmset_set(&conn->fc_alset, AL_IDLE,
                 packet_in->pi_received + conn->fc_settings->es_idle_conn_to);
-    if (0 == (conn->fc_flags & FC_ERROR))
-        if (0 != process_incoming_packet(conn, packet_in))
-            conn->fc_flags |= FC_ERROR;
+    if (conn->fc_flags & FC_ERROR)
+        return;
+
+    /* Decryption is performed right away, while the packet data is still
+     * hot in cache; the frames are parsed in the next tick, after all the
+     * packets that arrived before it have been decrypted.  A packet that
+     * cannot be decrypted yet -- for example, because the keys will only
+     * become available once the preceding packets are processed -- is
+     * decrypted again when it is parsed.
+     */
+    if (lsquic_packet_in_is_gquic_prst(packet_in)
+            || (lsquic_packet_in_is_verneg(packet_in)
+                                    && !(conn->fc_flags & FC_SERVER)))
+        goto copy;
+
+    reconstruct_packet_number(conn, packet_in);
+    if (conn->fc_ver_neg.vn_tag)
+        goto copy;
+
+    /* Decrypting a packet takes less than a microsecond: use the cycle
+     * counter, as lsquic_time_now() would mostly record zeroes.
+     */
+#if LSQUIC_CONN_STATS
+    c_start = lsquic_cycles();
+#endif
+    s = conn_decrypt_packet(conn, packet_in);
+#if LSQUIC_CONN_STATS
+    conn->fc_stats.in.decrypt_cycles += lsquic_cycles() - c_start;
+#endif
+    if (0 == s)
+    {
+        if (packet_in->pi_packno > conn->fc_max_pending_packno)
+            conn->fc_max_pending_packno = packet_in->pi_packno;
+        goto queue;
+    }
+
+  copy:
+    if (!(packet_in->pi_flags & PI_OWN_DATA)
+        && 0 != lsquic_conn_copy_and_release_pi_data(&conn->fc_conn,
+                                                conn->fc_enpub, packet_in))
+    {
+        ABORT_ERROR("cannot allocate memory to hold incoming packet");
+        return;
+    }
+
+  queue:
+    lsquic_packet_in_upref(packet_in);
+    TAILQ_INSERT_TAIL(&conn->fc_pending_packets, packet_in, pi_next);
+}
+
+
+/* Parse the packets queued up by full_conn_ci_packet_in() in the order
+ * in which they were received.
+ */
+static void
+process_pending_packets (struct full_conn *conn)
+{
+    struct lsquic_packet_in *packet_in;
+#if LSQUIC_CONN_STATS
+    lsquic_time_t t_start;
+
+    if (!TAILQ_EMPTY(&conn->fc_pending_packets))
+        ++conn->fc_stats.in.batches;
+    t_start = lsquic_time_now();
+#endif
+
+    while ((packet_in = TAILQ_FIRST(&conn->fc_pending_packets)))
+    {
+        TAILQ_REMOVE(&conn->fc_pending_packets, packet_in, pi_next);
+        if (0 == (conn->fc_flags & FC_ERROR))
+            if (0 != process_incoming_packet(conn, packet_in))
+                conn->fc_flags |= FC_ERROR;
+        lsquic_packet_in_put(conn->fc_pub.mm, packet_in);
+    }
+    conn->fc_max_pending_packno = 0;
+
+#if LSQUIC_CONN_STATS
+    conn->fc_stats.in.parse_usec += lsquic_time_now() - t_start;
+#endif
+}
+
+
+static void
+drop_pending_packets (struct full_conn *conn)
+{
+    struct lsquic_packet_in *packet_in;
+
+    while ((packet_in = TAILQ_FIRST(&conn->fc_pending_packets)))
+    {
+        TAILQ_REMOVE(&conn->fc_pending_packets, packet_in, pi_next);
+        lsquic_packet_in_put(conn->fc_pub.mm, packet_in);
+    }
 }
 
 
@@ -3143,10 +3710,15 @@ full_conn_ci_handshake_ok (lsquic_conn_t *lconn)
     LSQ_DEBUG("handshake reportedly done");
     lsquic_alarmset_unset(&conn->fc_alset, AL_HANDSHAKE);
     if (0 == apply_peer_settings(conn))
+    {
         lconn->cn_flags |= LSCONN_HANDSHAKE_DONE;
+        if (conn->fc_settings->es_compact)
+            conn->fc_flags |= FC_COMPACT;
+    }
     else
         conn->fc_flags |= FC_ERROR;
-    if (conn->fc_stream_ifs[STREAM_IF_STD].stream_if->on_hsk_done)
+    if (conn->fc_stream_ifs[STREAM_IF_STD].stream_if->on_hsk_done
+                                    && !(lconn->cn_flags & LSCONN_PRECONN))
         conn->fc_stream_ifs[STREAM_IF_STD].stream_if->on_hsk_done(lconn, 1);
 }
 
@@ -3158,7 +3730,8 @@ full_conn_ci_handshake_failed (lsquic_conn_t *lconn)
     LSQ_DEBUG("handshake failed");
     lsquic_alarmset_unset(&conn->fc_alset, AL_HANDSHAKE);
     conn->fc_flags |= FC_HSK_FAILED;
-    if (conn->fc_stream_ifs[STREAM_IF_STD].stream_if->on_hsk_done)
+    if (conn->fc_stream_ifs[STREAM_IF_STD].stream_if->on_hsk_done
+                                    && !(lconn->cn_flags & LSCONN_PRECONN))
         conn->fc_stream_ifs[STREAM_IF_STD].stream_if->on_hsk_done(lconn, 0);
 }
 
@@ -3181,6 +3754,8 @@ lsquic_conn_close (lsquic_conn_t *lconn)
 
     if (!(conn->fc_flags & FC_CLOSING))
     {
+        if (0 != wake_conn_for_user(conn))
+            return;
         for (el = lsquic_hash_first(conn->fc_pub.all_streams); el;
                                      el = lsquic_hash_next(conn->fc_pub.all_streams))
         {
@@ -3516,6 +4091,9 @@ full_conn_ci_is_tickable (lsquic_conn_t *lconn)
     struct full_conn *conn = (struct full_conn *) lconn;
     const struct lsquic_stream *stream;
 
+    if (!TAILQ_EMPTY(&conn->fc_pending_packets))
+        return 1;
+
     if (!TAILQ_EMPTY(&conn->fc_pub.service_streams))
         return 1;
 
@@ -16,4 +16,12 @@ full_conn_client_new (struct lsquic_engine_public *,
 void
 full_conn_client_call_on_new (struct lsquic_conn *);
 
+/* Mark connection as preconnected: user callbacks are not called until
+ * full_conn_client_call_on_new() hands the connection out.  Until then,
+ * PINGs keep the connection alive until `keepalive_until'.
+ */
+void
+full_conn_client_preconnect (struct lsquic_conn *,
+                                        lsquic_time_t keepalive_until);
+
 #endif
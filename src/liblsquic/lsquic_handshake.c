@@ -31,6 +31,7 @@
 #include "lsquic_hash.h"
 #include "lsquic_buf.h"
 #include "lsquic_qtags.h"
+#include "lsquic_c255_pool.h"
 
 #include "fiu-local.h"
 
@@ -1027,8 +1028,14 @@ lsquic_enc_session_gen_chlo (lsquic_enc_session_t *enc_session,
                                             ++n_tags;           /* PUBS */
             MSG_LEN_ADD(msg_len, sizeof(enc_session->hs_ctx.nonc));
                                             ++n_tags;           /* NONC */
-            rand_bytes(enc_session->priv_key, 32);
-            c255_get_pub_key(enc_session->priv_key, pub_key);
+            if (!(enc_session->enpub->enp_c255_pool
+                    && 0 == lsquic_c255_pool_get(
+                                    enc_session->enpub->enp_c255_pool,
+                                    enc_session->priv_key, pub_key)))
+            {
+                rand_bytes(enc_session->priv_key, 32);
+                c255_get_pub_key(enc_session->priv_key, pub_key);
+            }
             gen_nonce_c(enc_session->hs_ctx.nonc, enc_session->info->orbt);
         }
     }
@@ -1894,6 +1901,26 @@ lsquic_enc_session_verify_reset_token (lsquic_enc_session_t *enc_session,
 }
 
 
+/* SNI is kept: it is used to look up the server certificate chain. */
+static void
+lsquic_enc_session_compact (lsquic_enc_session_t *enc_session)
+{
+    hs_ctx_t *const hs_ctx = &enc_session->hs_ctx;
+
+    assert(enc_session->hsk_state == HSK_COMPLETED);
+    lsquic_str_d(&hs_ctx->ccs);
+    lsquic_str_d(&hs_ctx->ccrt);
+    lsquic_str_d(&hs_ctx->stk);
+    lsquic_str_d(&hs_ctx->sno);
+    lsquic_str_d(&hs_ctx->prof);
+    lsquic_str_d(&hs_ctx->csct);
+    lsquic_str_d(&hs_ctx->crt);
+    lsquic_str_d(&enc_session->chlo);
+    lsquic_str_d(&enc_session->sstk);
+    lsquic_str_d(&enc_session->ssno);
+}
+
+
 static STACK_OF(X509) *
 lsquic_enc_session_get_server_cert_chain (lsquic_enc_session_t *enc_session)
 {
@@ -1950,6 +1977,7 @@ struct enc_session_funcs lsquic_enc_session_gquic_1 =
     .esf_gen_chlo = lsquic_enc_session_gen_chlo,
     .esf_handle_chlo_reply = lsquic_enc_session_handle_chlo_reply,
     .esf_mem_used = lsquic_enc_session_mem_used,
+    .esf_compact = lsquic_enc_session_compact,
     .esf_verify_reset_token = lsquic_enc_session_verify_reset_token,
     .esf_get_server_cert_chain = lsquic_enc_session_get_server_cert_chain,
 };
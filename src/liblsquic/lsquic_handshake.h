@@ -56,7 +56,7 @@ typedef struct lsquic_session_cache_info_st
 } lsquic_session_cache_info_t;
 
 #ifndef LSQUIC_KEEP_ENC_SESS_HISTORY
-#   ifndef NDEBUG
+#   if !defined(NDEBUG) && !LSQUIC_COMPACT
 #       define LSQUIC_KEEP_ENC_SESS_HISTORY 1
 #   else
 #       define LSQUIC_KEEP_ENC_SESS_HISTORY 0
@@ -137,6 +137,12 @@ struct enc_session_funcs
     size_t
     (*esf_mem_used)(lsquic_enc_session_t *);
 
+    /* Free handshake messages and other state that is no longer needed
+     * once the handshake has completed.
+     */
+    void
+    (*esf_compact) (lsquic_enc_session_t *);
+
     int
     (*esf_verify_reset_token) (lsquic_enc_session_t *, const unsigned char *,
                                                                     size_t);
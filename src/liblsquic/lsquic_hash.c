@@ -1,85 +1,143 @@
 /* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
 /*
- * lsquic_hash.c
+ * lsquic_hash.c -- Open-addressing hash with inline elements.
+ *
+ * The layout follows SwissTable: elements are stored in an array of slots
+ * and each slot has a control byte in a separate array.  The control byte
+ * is either EMPTY, DELETED, or, for full slots, seven bits of the hash
+ * value.  Slots are probed sixteen at a time: the control bytes of a group
+ * are compared against the seven hash bits using SSE2 when available, so
+ * that the element itself is only looked at when there is a likely match.
+ * Groups are probed quadratically.
+ *
+ * Short keys are copied into the element, so that comparing them does not
+ * require following a pointer.  Longer keys are referenced and must stay
+ * valid for as long as they are in the hash.
  */
 
 #include <assert.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/queue.h>
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define QH_SSE2 1
+#else
+#define QH_SSE2 0
+#endif
 #ifdef WIN32
 #include <vc_compat.h>
 #endif
 
-#include "lsquic_malo.h"
 #include "lsquic_hash.h"
 #include "lsquic_xxhash.h"
 
+#define QHE_INLINE_KEY_SZ 16
+
 struct lsquic_hash_elem
 {
-    TAILQ_ENTRY(lsquic_hash_elem)
-                    qhe_next_bucket,
-                    qhe_next_all;
-    const void     *qhe_key_data;
-    unsigned        qhe_key_len;
     void           *qhe_value;
+    unsigned        qhe_key_len;
     unsigned        qhe_hash_val;
+    union {
+        const void     *ptr;                        /* Long keys */
+        unsigned char   buf[QHE_INLINE_KEY_SZ];     /* Short keys */
+    }               qhe_key;
 };
 
-TAILQ_HEAD(hels_head, lsquic_hash_elem);
+#define QHE_KEY(el) ((el)->qhe_key_len <= QHE_INLINE_KEY_SZ ?               \
+                            (const void *) (el)->qhe_key.buf : (el)->qhe_key.ptr)
+
+#define GROUP_SZ 16
+#define MIN_N_SLOTS GROUP_SZ
 
-#define N_BUCKETS(n_bits) (1U << (n_bits))
-#define BUCKNO(n_bits, hash) ((hash) & (N_BUCKETS(n_bits) - 1))
+/* Control bytes */
+#define CTRL_EMPTY   0x80
+#define CTRL_DELETED 0xFE
+/* Full slots have the high bit clear: */
+#define CTRL_H2(hash_val) ((unsigned char) ((hash_val) >> 25))
 
 struct lsquic_hash
 {
-    struct hels_head        *qh_buckets,
-                             qh_all;
-    struct malo             *qh_malo_els;
-    struct lsquic_hash_elem *qh_iter_next;
-    unsigned                 qh_count;
-    unsigned                 qh_nbits;
+    unsigned char           *qh_ctrl;
+    struct lsquic_hash_elem *qh_slots;
+    unsigned                 qh_n_slots,    /* Zero or power of two */
+                             qh_count,      /* Full slots */
+                             qh_n_deleted,  /* Deleted slots */
+                             qh_iter_idx;
 };
 
 
-struct lsquic_hash *
-lsquic_hash_create (void)
+/* Bitmasks of slots in a group, bit N corresponding to slot N: */
+
+#if QH_SSE2
+static unsigned
+group_match (const unsigned char *ctrl, unsigned char byte)
 {
-    struct hels_head *buckets;
-    struct lsquic_hash *hash;
-    struct malo *malo;
-    unsigned nbits = 2;
-    unsigned i;
+    const __m128i group = _mm_loadu_si128((const __m128i *) ctrl);
+    return (unsigned) _mm_movemask_epi8(
+                        _mm_cmpeq_epi8(group, _mm_set1_epi8((char) byte)));
+}
 
-    buckets = malloc(sizeof(buckets[0]) * N_BUCKETS(nbits));
-    if (!buckets)
-        return NULL;
 
-    hash = malloc(sizeof(*hash));
-    if (!hash)
-    {
-        free(buckets);
-        return NULL;
-    }
+/* Empty or deleted */
+static unsigned
+group_match_free (const unsigned char *ctrl)
+{
+    const __m128i group = _mm_loadu_si128((const __m128i *) ctrl);
+    return (unsigned) _mm_movemask_epi8(group);
+}
 
-    malo = lsquic_malo_create(sizeof(struct lsquic_hash_elem));
-    if (!malo)
-    {
-        free(hash);
-        free(buckets);
-        return NULL;
-    }
 
-    for (i = 0; i < N_BUCKETS(nbits); ++i)
-        TAILQ_INIT(&buckets[i]);
+#else
+static unsigned
+group_match (const unsigned char *ctrl, unsigned char byte)
+{
+    unsigned n, mask;
+
+    mask = 0;
+    for (n = 0; n < GROUP_SZ; ++n)
+        mask |= (unsigned) (ctrl[n] == byte) << n;
+    return mask;
+}
+
 
-    TAILQ_INIT(&hash->qh_all);
-    hash->qh_buckets   = buckets;
-    hash->qh_nbits     = nbits;
-    hash->qh_malo_els  = malo;
-    hash->qh_iter_next = NULL;
-    hash->qh_count     = 0;
+static unsigned
+group_match_free (const unsigned char *ctrl)
+{
+    unsigned n, mask;
+
+    mask = 0;
+    for (n = 0; n < GROUP_SZ; ++n)
+        mask |= (unsigned) (ctrl[n] >> 7) << n;
+    return mask;
+}
+
+
+#endif
+
+
+static unsigned
+first_bit (unsigned mask)
+{
+#if __GNUC__
+    return __builtin_ctz(mask);
+#else
+    unsigned n;
+    for (n = 0; !(mask & 1); ++n)
+        mask >>= 1;
+    return n;
+#endif
+}
+
+
+struct lsquic_hash *
+lsquic_hash_create (void)
+{
+    struct lsquic_hash *hash;
+
+    /* Slots are allocated on first insertion */
+    hash = calloc(1, sizeof(*hash));
     return hash;
 }
 
@@ -87,42 +145,69 @@ lsquic_hash_create (void)
 void
 lsquic_hash_destroy (struct lsquic_hash *hash)
 {
-    lsquic_malo_destroy(hash->qh_malo_els);
-    free(hash->qh_buckets);
+    free(hash->qh_ctrl);
+    free(hash->qh_slots);
     free(hash);
 }
 
 
+/* Returns index of the first free slot in probe sequence for `hash_val' */
+static unsigned
+find_free_slot (const struct lsquic_hash *hash, unsigned hash_val)
+{
+    const unsigned group_mask = hash->qh_n_slots / GROUP_SZ - 1;
+    unsigned group, n_probes, mask;
+
+    group = hash_val & group_mask;
+    n_probes = 0;
+    while (1)
+    {
+        mask = group_match_free(&hash->qh_ctrl[group * GROUP_SZ]);
+        if (mask)
+            return group * GROUP_SZ + first_bit(mask);
+        group = (group + ++n_probes) & group_mask;
+    }
+}
+
+
+/* Allocate `n_slots' slots and move all elements there.  Deleted slots are
+ * dropped.
+ */
 static int
-lsquic_hash_grow (struct lsquic_hash *hash)
+rehash (struct lsquic_hash *hash, unsigned n_slots)
 {
-    struct hels_head *new_buckets, *new[2];
-    struct lsquic_hash_elem *el;
-    unsigned n, old_nbits;
-    int idx;
+    struct lsquic_hash_elem *old_slots;
+    unsigned char *old_ctrl;
+    unsigned n, idx, old_n_slots;
 
-    old_nbits = hash->qh_nbits;
-    new_buckets = malloc(sizeof(hash->qh_buckets[0])
-                                                * N_BUCKETS(old_nbits + 1));
-    if (!new_buckets)
-        return -1;
+    old_ctrl = hash->qh_ctrl;
+    old_slots = hash->qh_slots;
+    old_n_slots = hash->qh_n_slots;
 
-    for (n = 0; n < N_BUCKETS(old_nbits); ++n)
+    hash->qh_ctrl = malloc(n_slots);
+    hash->qh_slots = malloc(n_slots * sizeof(hash->qh_slots[0]));
+    if (!(hash->qh_ctrl && hash->qh_slots))
     {
-        new[0] = &new_buckets[n];
-        new[1] = &new_buckets[n + N_BUCKETS(old_nbits)];
-        TAILQ_INIT(new[0]);
-        TAILQ_INIT(new[1]);
-        while ((el = TAILQ_FIRST(&hash->qh_buckets[n])))
+        free(hash->qh_ctrl);
+        free(hash->qh_slots);
+        hash->qh_ctrl = old_ctrl;
+        hash->qh_slots = old_slots;
+        return -1;
+    }
+    memset(hash->qh_ctrl, CTRL_EMPTY, n_slots);
+    hash->qh_n_slots = n_slots;
+    hash->qh_n_deleted = 0;
+
+    for (n = 0; n < old_n_slots; ++n)
+        if (!(old_ctrl[n] & 0x80))
         {
-            TAILQ_REMOVE(&hash->qh_buckets[n], el, qhe_next_bucket);
-            idx = (BUCKNO(old_nbits + 1, el->qhe_hash_val) >> old_nbits) & 1;
-            TAILQ_INSERT_TAIL(new[idx], el, qhe_next_bucket);
+            idx = find_free_slot(hash, old_slots[n].qhe_hash_val);
+            hash->qh_ctrl[idx] = old_ctrl[n];
+            hash->qh_slots[idx] = old_slots[n];
         }
-    }
-    free(hash->qh_buckets);
-    hash->qh_nbits   = old_nbits + 1;
-    hash->qh_buckets = new_buckets;
+
+    free(old_ctrl);
+    free(old_slots);
     return 0;
 }
 
@@ -131,48 +216,117 @@ struct lsquic_hash_elem *
 lsquic_hash_insert (struct lsquic_hash *hash, const void *key,
                                             unsigned key_sz, void *data)
 {
-    unsigned buckno, hash_val;
     struct lsquic_hash_elem *el;
+    unsigned hash_val, idx, n_slots;
 
-    el = lsquic_malo_get(hash->qh_malo_els);
-    if (!el)
-        return NULL;
-
-    if (hash->qh_count >= N_BUCKETS(hash->qh_nbits) / 2 &&
-                                            0 != lsquic_hash_grow(hash))
+    /* Keep load factor, including deleted slots, at or below 7/8.  This
+     * guarantees that every probe sequence ends in an empty slot.
+     */
+    if ((hash->qh_count + hash->qh_n_deleted + 1) * 8 > hash->qh_n_slots * 7)
     {
-        lsquic_malo_put(el);
-        return NULL;
+        n_slots = hash->qh_n_slots ? hash->qh_n_slots : MIN_N_SLOTS;
+        /* If much of the space is taken up by deleted slots, clean up
+         * without growing:
+         */
+        if ((hash->qh_count + 1) * 16 > n_slots * 7)
+            n_slots <<= 1;
+        if (0 != rehash(hash, n_slots))
+            return NULL;
     }
 
     hash_val = XXH64(key, key_sz, (uintptr_t) hash);
-    buckno = BUCKNO(hash->qh_nbits, hash_val);
-    TAILQ_INSERT_TAIL(&hash->qh_all, el, qhe_next_all);
-    TAILQ_INSERT_TAIL(&hash->qh_buckets[buckno], el, qhe_next_bucket);
-    el->qhe_key_data = key;
-    el->qhe_key_len  = key_sz;
+    idx = find_free_slot(hash, hash_val);
+    hash->qh_n_deleted -= hash->qh_ctrl[idx] == CTRL_DELETED;
+    hash->qh_ctrl[idx] = CTRL_H2(hash_val);
+    el = &hash->qh_slots[idx];
     el->qhe_value    = data;
+    el->qhe_key_len  = key_sz;
     el->qhe_hash_val = hash_val;
+    if (key_sz <= QHE_INLINE_KEY_SZ)
+        memcpy(el->qhe_key.buf, key, key_sz);
+    else
+        el->qhe_key.ptr = key;
     ++hash->qh_count;
     return el;
 }
 
 
+/* Returns the next element after `el' whose hash value and key length
+ * match.  The key itself is compared by the caller: keeping the call to
+ * memcmp() out of the probe loop lets the compiler keep the loop's state
+ * in registers.
+ */
+static struct lsquic_hash_elem *
+find_candidate (const struct lsquic_hash *hash, unsigned hash_val,
+                            unsigned key_sz, const struct lsquic_hash_elem *el)
+{
+    const unsigned char *ctrl;
+    unsigned group, group_mask, n_probes, mask, idx;
+
+    group_mask = hash->qh_n_slots / GROUP_SZ - 1;
+    group = hash_val & group_mask;
+    n_probes = 0;
+    while (1)
+    {
+        ctrl = &hash->qh_ctrl[group * GROUP_SZ];
+        for (mask = group_match(ctrl, CTRL_H2(hash_val)); mask;
+                                                        mask &= mask - 1)
+        {
+            idx = group * GROUP_SZ + first_bit(mask);
+            if (el)
+            {
+                /* Resume search after previous candidate */
+                if (el == &hash->qh_slots[idx])
+                    el = NULL;
+            }
+            else if (hash_val == hash->qh_slots[idx].qhe_hash_val
+                            && key_sz == hash->qh_slots[idx].qhe_key_len)
+                return &hash->qh_slots[idx];
+        }
+        if (group_match(ctrl, CTRL_EMPTY))
+            return NULL;
+        group = (group + ++n_probes) & group_mask;
+    }
+}
+
+
+/* Stream IDs and connection IDs are compared without calling memcmp() */
+static int
+key_eq (const void *a, const void *b, unsigned key_sz)
+{
+    uint32_t a32, b32;
+    uint64_t a64, b64;
+
+    switch (key_sz)
+    {
+    case sizeof(uint32_t):
+        memcpy(&a32, a, sizeof(a32));
+        memcpy(&b32, b, sizeof(b32));
+        return a32 == b32;
+    case sizeof(uint64_t):
+        memcpy(&a64, a, sizeof(a64));
+        memcpy(&b64, b, sizeof(b64));
+        return a64 == b64;
+    default:
+        return 0 == memcmp(a, b, key_sz);
+    }
+}
+
+
 struct lsquic_hash_elem *
 lsquic_hash_find (struct lsquic_hash *hash, const void *key, unsigned key_sz)
 {
-    unsigned buckno, hash_val;
     struct lsquic_hash_elem *el;
+    unsigned hash_val;
+
+    if (hash->qh_count == 0)
+        return NULL;
 
     hash_val = XXH64(key, key_sz, (uintptr_t) hash);
-    buckno = BUCKNO(hash->qh_nbits, hash_val);
-    TAILQ_FOREACH(el, &hash->qh_buckets[buckno], qhe_next_bucket)
-        if (hash_val == el->qhe_hash_val &&
-            key_sz   == el->qhe_key_len &&
-            0 == memcmp(key, el->qhe_key_data, key_sz))
-        {
+    el = NULL;
+    while ((el = find_candidate(hash, hash_val, key_sz, el)))
+        if (key_eq(key, QHE_KEY(el), key_sz))
             return el;
-        }
 
     return NULL;
 }
@@ -188,12 +342,23 @@ lsquic_hashelem_getdata (const struct lsquic_hash_elem *el)
 void
 lsquic_hash_erase (struct lsquic_hash *hash, struct lsquic_hash_elem *el)
 {
-    unsigned buckno;
-
-    buckno = BUCKNO(hash->qh_nbits, el->qhe_hash_val);
-    TAILQ_REMOVE(&hash->qh_buckets[buckno], el, qhe_next_bucket);
-    TAILQ_REMOVE(&hash->qh_all, el, qhe_next_all);
-    lsquic_malo_put(el);
+    unsigned idx;
+
+    idx = el - hash->qh_slots;
+    assert(idx < hash->qh_n_slots);
+    assert(!(hash->qh_ctrl[idx] & 0x80));
+
+    /* Probe sequences that reach a group with an empty slot stop there.
+     * If this group has no empty slots, some elements may have been placed
+     * further along the probe sequence, so the slot is marked deleted.
+     */
+    if (group_match(&hash->qh_ctrl[idx & ~(GROUP_SZ - 1)], CTRL_EMPTY))
+        hash->qh_ctrl[idx] = CTRL_EMPTY;
+    else
+    {
+        hash->qh_ctrl[idx] = CTRL_DELETED;
+        ++hash->qh_n_deleted;
+    }
     --hash->qh_count;
 }
 
@@ -201,7 +366,7 @@ lsquic_hash_erase (struct lsquic_hash *hash, struct lsquic_hash_elem *el)
 void
 lsquic_hash_reset_iter (struct lsquic_hash *hash)
 {
-    hash->qh_iter_next = TAILQ_FIRST(&hash->qh_all);
+    hash->qh_iter_idx = 0;
 }
 
 
@@ -216,11 +381,10 @@ lsquic_hash_first (struct lsquic_hash *hash)
 struct lsquic_hash_elem *
 lsquic_hash_next (struct lsquic_hash *hash)
 {
-    struct lsquic_hash_elem *el;
-    el = hash->qh_iter_next;
-    if (el)
-        hash->qh_iter_next = TAILQ_NEXT(el, qhe_next_all);
-    return el;
+    while (hash->qh_iter_idx < hash->qh_n_slots)
+        if (!(hash->qh_ctrl[ hash->qh_iter_idx++ ] & 0x80))
+            return &hash->qh_slots[ hash->qh_iter_idx - 1 ];
+    return NULL;
 }
 
 
@@ -235,6 +399,5 @@ size_t
 lsquic_hash_mem_used (const struct lsquic_hash *hash)
 {
     return sizeof(*hash)
-         + N_BUCKETS(hash->qh_nbits) * sizeof(hash->qh_buckets[0])
-         + lsquic_malo_mem_used(hash->qh_malo_els);
+         + hash->qh_n_slots * (sizeof(hash->qh_slots[0]) + 1);
 }
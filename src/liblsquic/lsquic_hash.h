@@ -1,6 +1,14 @@
 /* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
 /*
  * lsquic_hash.c -- A generic hash
+ *
+ * Elements live inside the hash table.  A pointer to an element stays
+ * valid until the element is erased or until the next insertion, which
+ * may move elements.  Erasing elements while iterating is allowed;
+ * inserting is not.
+ *
+ * Keys of up to 16 bytes are copied.  Longer keys are not copied and must
+ * stay valid while the element is in the hash.
  */
 
 #ifndef LSQUIC_HASH_H
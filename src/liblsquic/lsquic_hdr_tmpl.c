@@ -0,0 +1,132 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_hdr_tmpl.c -- Header block templates.
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lshpack.h"
+#include "lsquic.h"
+#include "lsquic_hdr_tmpl.h"
+
+/* Literal header field: type byte and two strings, each with up to three
+ * bytes of length continuation.  lshpack uses Huffman encoding only when it
+ * makes the string shorter.
+ */
+#define MAX_ENC_OVERHEAD 9
+
+
+static int
+is_pseudo (const lsquic_http_header_t *header)
+{
+    return header->name.iov_len > 0
+        && ':' == *(const char *) header->name.iov_base;
+}
+
+
+static int
+check_header (const lsquic_http_header_t *header)
+{
+    const unsigned char *p, *end;
+
+    if (header->name.iov_len == 0
+            || header->name.iov_len > LSHPACK_MAX_STRLEN
+            || header->value.iov_len > LSHPACK_MAX_STRLEN)
+        return -1;
+
+    p = header->name.iov_base;
+    for (end = p + header->name.iov_len; p < end; ++p)
+        if (*p >= 'A' && *p <= 'Z')
+            return -1;
+
+    return 0;
+}
+
+
+struct lsquic_hdr_tmpl *
+lsquic_hdr_tmpl_new (const lsquic_http_headers_t *headers)
+{
+    struct lsquic_hdr_tmpl *tmpl;
+    lsquic_http_header_t *header;
+    size_t strings_sz, enc_max, list_size;
+    char *p;
+    unsigned n_pseudo;
+    int i;
+
+    if (!headers || headers->count < 0)
+    {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    n_pseudo = 0;
+    strings_sz = 0;
+    for (i = 0; i < headers->count; ++i)
+    {
+        if (0 != check_header(&headers->headers[i]))
+        {
+            errno = EINVAL;
+            return NULL;
+        }
+        if (is_pseudo(&headers->headers[i]))
+        {
+            if (n_pseudo != (unsigned) i)
+            {   /* RFC 7540, Section 8.1.2.1 */
+                errno = EINVAL;
+                return NULL;
+            }
+            ++n_pseudo;
+        }
+        strings_sz += headers->headers[i].name.iov_len
+                    + headers->headers[i].value.iov_len;
+    }
+
+    enc_max = strings_sz + MAX_ENC_OVERHEAD * (size_t) headers->count;
+    if (enc_max > UINT32_MAX)
+    {
+        errno = EMSGSIZE;
+        return NULL;
+    }
+
+    tmpl = malloc(sizeof(*tmpl)
+                + sizeof(headers->headers[0]) * (size_t) headers->count
+                + strings_sz + enc_max);
+    if (!tmpl)
+        return NULL;
+
+    memset(tmpl, 0, sizeof(*tmpl));
+    tmpl->ht_headers.count = headers->count;
+    tmpl->ht_headers.headers = (lsquic_http_header_t *) (tmpl + 1);
+    tmpl->ht_n_pseudo = n_pseudo;
+    tmpl->ht_uncomp_sz = strings_sz;
+    list_size = strings_sz + 32 * (size_t) headers->count;
+    tmpl->ht_list_size = list_size < UINT32_MAX ? list_size : UINT32_MAX;
+    tmpl->ht_enc_max = enc_max;
+
+    p = (char *) (tmpl->ht_headers.headers + headers->count);
+    for (i = 0; i < headers->count; ++i)
+    {
+        header = &tmpl->ht_headers.headers[i];
+        header->name.iov_base = p;
+        header->name.iov_len = headers->headers[i].name.iov_len;
+        memcpy(p, headers->headers[i].name.iov_base, header->name.iov_len);
+        p += header->name.iov_len;
+        header->value.iov_base = p;
+        header->value.iov_len = headers->headers[i].value.iov_len;
+        memcpy(p, headers->headers[i].value.iov_base, header->value.iov_len);
+        p += header->value.iov_len;
+    }
+    tmpl->ht_enc = (unsigned char *) p;
+
+    return tmpl;
+}
+
+
+void
+lsquic_hdr_tmpl_destroy (struct lsquic_hdr_tmpl *tmpl)
+{
+    free(tmpl);
+}
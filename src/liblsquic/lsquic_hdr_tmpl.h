@@ -0,0 +1,38 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_hdr_tmpl.h -- Header block templates.
+ *
+ * A template is a set of headers that is the same in many HEADERS frames.
+ * The headers are validated once, when the template is created.  The frame
+ * writer keeps the template's encoded header block and sends it again as
+ * is for as long as the HPACK encoder's dynamic table does not change.
+ */
+
+#ifndef LSQUIC_HDR_TMPL_H
+#define LSQUIC_HDR_TMPL_H 1
+
+struct lshpack_enc;
+
+struct lsquic_hdr_tmpl
+{
+    /* Pseudo-headers come first.  The header array, names, values, and
+     * ht_enc are allocated together with the template.
+     */
+    struct lsquic_http_headers  ht_headers;
+    unsigned                    ht_n_pseudo;
+    uint32_t                    ht_list_size;   /* 32 + name + value each */
+    unsigned                    ht_uncomp_sz;   /* Sum of names and values */
+
+    /* The encoded header block is valid if the encoder is the same and its
+     * table generation has not changed.  NULL ht_henc means not valid.
+     */
+    const struct lshpack_enc   *ht_henc;
+    lsquic_cid_t                ht_cid;
+    uint64_t                    ht_gen;
+    unsigned                    ht_enc_sz;
+    unsigned                    ht_enc_pseudo_sz;   /* Pseudo-headers part */
+    unsigned                    ht_enc_max;         /* Size of ht_enc */
+    unsigned char              *ht_enc;
+};
+
+#endif
@@ -179,6 +179,26 @@ lsquic_headers_stream_send_headers (struct headers_stream *hs,
 }
 
 
+int
+lsquic_headers_stream_send_headers_tmpl (struct headers_stream *hs,
+    uint32_t stream_id, struct lsquic_hdr_tmpl *tmpl,
+    const struct lsquic_http_headers *headers, int eos, unsigned weight)
+{
+    LSQ_DEBUG("received template headers to send");
+    int s;
+    s = lsquic_frame_writer_write_headers_tmpl(hs->hs_fw, stream_id, tmpl,
+                                                    headers, eos, weight);
+    if (0 == s)
+    {
+        lsquic_stream_wantwrite(hs->hs_stream,
+            lsquic_frame_writer_have_leftovers(hs->hs_fw));
+    }
+    else
+        LSQ_INFO("Error writing headers: %s", strerror(errno));
+    return s;
+}
+
+
 int
 lsquic_headers_stream_send_priority (struct headers_stream *hs,
     uint32_t stream_id, int exclusive, uint32_t dep_stream_id, unsigned weight)
@@ -401,9 +421,14 @@ lsquic_headers_stream_mem_used (const struct headers_stream *hs)
 {
     size_t size;
 
-    size = sizeof(*hs);
+    size = sizeof(*hs) - sizeof(hs->hs_henc) - sizeof(hs->hs_hdec);
     size += lsquic_frame_reader_mem_used(hs->hs_fr);
     size += lsquic_frame_writer_mem_used(hs->hs_fw);
+    if (hs->hs_flags & HS_HENC_INITED)
+        size += lshpack_enc_mem_used(&hs->hs_henc);
+    else
+        size += sizeof(hs->hs_henc);
+    size += lshpack_dec_mem_used(&hs->hs_hdec);
     /* XXX: get rid of this mem_used business as we no longer use it? */
 
     return size;
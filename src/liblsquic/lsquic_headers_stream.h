@@ -13,6 +13,7 @@ struct lsquic_stream_if;
 struct lsquic_stream;
 struct lsquic_mm;
 struct lsquic_http_headers;
+struct lsquic_hdr_tmpl;
 struct lsquic_frame_reader;
 struct lsquic_frame_writer;
 struct uncompressed_headers;
@@ -57,6 +58,12 @@ lsquic_headers_stream_send_headers (struct headers_stream *hs,
                                 const struct lsquic_http_headers *, int eos,
                                 unsigned weight);
 
+int
+lsquic_headers_stream_send_headers_tmpl (struct headers_stream *hs,
+                                uint32_t stream_id, struct lsquic_hdr_tmpl *,
+                                const struct lsquic_http_headers *, int eos,
+                                unsigned weight);
+
 int
 lsquic_headers_stream_push_promise (struct headers_stream *hs,
                         uint32_t stream_id, uint32_t promised_stream_id,
@@ -0,0 +1,416 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_hset.c -- Built-in header set.
+ *
+ * Headers are kept in the order and form in which they arrive from the
+ * HPACK decoder: nothing is converted to HTTP/1.x.  Names and values are
+ * copied back to back into a single buffer.  Until the set is complete,
+ * the header array records offsets into the buffer, which are turned into
+ * pointers at the end.  Both the buffer and the array grow by doubling,
+ * so that a typical header set takes three allocations.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lsquic.h"
+#include "lsquic_http1x_if.h"
+
+#define LSQUIC_LOGGER_MODULE LSQLM_HSET
+#define LSQUIC_LOG_CONN_ID hset->hs_cid
+#include "lsquic_logger.h"
+
+enum pseudo_header
+{
+    PSEH_AUTHORITY,
+    PSEH_METHOD,
+    PSEH_PATH,
+    PSEH_SCHEME,
+    PSEH_STATUS,
+};
+
+#define BIT(x) (1 << (x))
+
+#define ALL_REQUEST_PSEH (BIT(PSEH_METHOD)|BIT(PSEH_SCHEME)|BIT(PSEH_AUTHORITY)|BIT(PSEH_PATH))
+#define REQUIRED_REQUEST_PSEH (BIT(PSEH_METHOD)|BIT(PSEH_SCHEME)|BIT(PSEH_PATH))
+
+#define ALL_SERVER_PSEH BIT(PSEH_STATUS)
+#define REQUIRED_SERVER_PSEH ALL_SERVER_PSEH
+
+/* HPACK static table entries with pseudo-header names are at the start
+ * of the table, see RFC 7541, Appendix A.
+ */
+#define LAST_PSEH_IDX 14
+
+/* Indexed by static table index */
+static const signed char idx2pseh[LAST_PSEH_IDX + 1] =
+{
+    [1]  = PSEH_AUTHORITY,
+    [2]  = PSEH_METHOD,     [3]  = PSEH_METHOD,
+    [4]  = PSEH_PATH,       [5]  = PSEH_PATH,
+    [6]  = PSEH_SCHEME,     [7]  = PSEH_SCHEME,
+    [8]  = PSEH_STATUS,     [9]  = PSEH_STATUS,     [10] = PSEH_STATUS,
+    [11] = PSEH_STATUS,     [12] = PSEH_STATUS,     [13] = PSEH_STATUS,
+    [14] = PSEH_STATUS,
+};
+
+/* First static table index for each pseudo-header */
+static const unsigned char pseh2idx[] =
+{
+    [PSEH_AUTHORITY] = 1,
+    [PSEH_METHOD]    = 2,
+    [PSEH_PATH]      = 4,
+    [PSEH_SCHEME]    = 6,
+    [PSEH_STATUS]    = 8,
+};
+
+/* Number of entries in the HPACK static table */
+#define N_STATIC_ENTRIES 61
+
+#define MIN_BUF_SZ 0x400
+#define MIN_HEADERS 16
+
+
+struct lsquic_hset
+{
+    struct lsquic_hset_header   *hs_headers;
+    char                        *hs_buf;
+    unsigned                     hs_count,
+                                 hs_nalloc,     /* Elements in hs_headers */
+                                 hs_buf_off,
+                                 hs_buf_sz,
+                                 hs_list_size,
+                                 hs_max_list_size;  /* 0 means unlimited */
+    lsquic_cid_t                 hs_cid;
+    enum {
+        HS_SERVER       = 1 << 0,
+        HS_PUSH_PROMISE = 1 << 1,
+        HS_REGULAR      = 1 << 2,   /* Seen regular header */
+    }                            hs_flags;
+    unsigned                     hs_pseh_mask;
+};
+
+
+static void *
+hset_create (void *ctx, int is_push_promise)
+{
+    const struct http1x_ctor_ctx *hcc = ctx;
+    struct lsquic_hset *hset;
+
+    hset = calloc(1, sizeof(*hset));
+    if (!hset)
+        return NULL;
+
+    if (hcc->is_server)
+        hset->hs_flags |= HS_SERVER;
+    if (is_push_promise)
+        hset->hs_flags |= HS_PUSH_PROMISE;
+    hset->hs_max_list_size = hcc->max_headers_sz;
+    hset->hs_cid = hcc->cid;
+    return hset;
+}
+
+
+/* Return pseudo-header or -1 if the name is not known */
+static int
+find_pseudo_header (unsigned name_idx, const char *name, unsigned name_len)
+{
+    if (name_idx >= 1 && name_idx <= LAST_PSEH_IDX)
+        return idx2pseh[name_idx];
+
+    switch (name_len)
+    {
+    case 5:
+        if (0 == memcmp(name, ":path", 5))
+            return PSEH_PATH;
+        break;
+    case 7:
+        switch (name[2])
+        {
+        case 'c':
+            if (0 == memcmp(name, ":scheme", 7))
+                return PSEH_SCHEME;
+            break;
+        case 'e':
+            if (0 == memcmp(name, ":method", 7))
+                return PSEH_METHOD;
+            break;
+        case 't':
+            if (0 == memcmp(name, ":status", 7))
+                return PSEH_STATUS;
+            break;
+        }
+        break;
+    case 10:
+        if (0 == memcmp(name, ":authority", 10))
+            return PSEH_AUTHORITY;
+        break;
+    }
+
+    return -1;
+}
+
+
+static enum lsquic_header_status
+check_pseudo_headers (struct lsquic_hset *hset)
+{
+    /* We are *reading* the message.  Thus, a server expects a request, and a
+     * client expects a response.  Unless we receive a push promise from the
+     * server, in which case this should also be a request.
+     */
+    if (hset->hs_flags & (HS_SERVER|HS_PUSH_PROMISE))
+    {
+        if ((hset->hs_pseh_mask & REQUIRED_REQUEST_PSEH)
+                                                != REQUIRED_REQUEST_PSEH)
+        {
+            LSQ_INFO("not all request pseudo-headers are specified");
+            return LSQUIC_HDR_ERR_INCOMPL_REQ_PSDO_HDR;
+        }
+        if (hset->hs_pseh_mask & ALL_SERVER_PSEH)
+        {
+            LSQ_INFO("request pseudo-headers contain response-only headers");
+            return LSQUIC_HDR_ERR_UNNEC_RESP_PSDO_HDR;
+        }
+    }
+    else
+    {
+        if ((hset->hs_pseh_mask & REQUIRED_SERVER_PSEH)
+                                                != REQUIRED_SERVER_PSEH)
+        {
+            LSQ_INFO("not all response pseudo-headers are specified");
+            return LSQUIC_HDR_ERR_INCOMPL_RESP_PSDO_HDR;
+        }
+        if (hset->hs_pseh_mask & ALL_REQUEST_PSEH)
+        {
+            LSQ_INFO("response pseudo-headers contain request-only headers");
+            return LSQUIC_HDR_ERR_UNNEC_REQ_PSDO_HDR;
+        }
+    }
+
+    return LSQUIC_HDR_OK;
+}
+
+
+static int
+has_uppercase (const char *name, unsigned name_len)
+{
+    unsigned i;
+
+    for (i = 0; i < name_len; ++i)
+        if (name[i] >= 'A' && name[i] <= 'Z')
+            return 1;
+
+    return 0;
+}
+
+
+static enum lsquic_header_status
+add_header (struct lsquic_hset *hset, unsigned name_idx, const char *name,
+            unsigned name_len, const char *value, unsigned value_len)
+{
+    struct lsquic_hset_header *header;
+    enum lsquic_header_status st;
+    unsigned nalloc, buf_sz;
+    int ph;
+    void *p;
+
+    LSQ_DEBUG("Got header '%.*s': '%.*s'", name_len, name, value_len, value);
+
+    /* The decoder sets name_idx to the dynamic table index if the name
+     * is not in the static table.
+     */
+    if (name_idx > N_STATIC_ENTRIES)
+        name_idx = 0;
+
+    if (name_len > 0 && ':' == name[0])
+    {
+        if (hset->hs_flags & HS_REGULAR)
+        {
+            LSQ_INFO("unexpected colon");
+            return LSQUIC_HDR_ERR_MISPLACED_PSDO_HDR;
+        }
+        ph = find_pseudo_header(name_idx, name, name_len);
+        if (ph < 0)
+        {
+            LSQ_INFO("unknown pseudo-header `%.*s'", name_len, name);
+            return LSQUIC_HDR_ERR_UNKNOWN_PSDO_HDR;
+        }
+        if (hset->hs_pseh_mask & BIT(ph))
+        {
+            LSQ_INFO("header %d is already present", ph);
+            return LSQUIC_HDR_ERR_DUPLICATE_PSDO_HDR;
+        }
+        hset->hs_pseh_mask |= BIT(ph);
+        name_idx = pseh2idx[ph];
+    }
+    else
+    {
+        if (!(hset->hs_flags & HS_REGULAR))
+        {
+            st = check_pseudo_headers(hset);
+            if (st != LSQUIC_HDR_OK)
+                return st;
+            hset->hs_flags |= HS_REGULAR;
+        }
+        if (name_idx == 0 && has_uppercase(name, name_len))
+        {
+            LSQ_INFO("Header name `%.*s' contains uppercase letters",
+                name_len, name);
+            return LSQUIC_HDR_ERR_UPPERCASE_HEADER;
+        }
+    }
+
+    /* RFC 7540, Section 6.5.2 */
+    hset->hs_list_size += 32 + name_len + value_len;
+    if (hset->hs_max_list_size && hset->hs_list_size > hset->hs_max_list_size)
+    {
+        LSQ_INFO("headers too large");
+        return LSQUIC_HDR_ERR_HEADERS_TOO_LARGE;
+    }
+
+    if (hset->hs_count >= hset->hs_nalloc)
+    {
+        nalloc = hset->hs_nalloc ? hset->hs_nalloc * 2 : MIN_HEADERS;
+        p = realloc(hset->hs_headers, nalloc * sizeof(hset->hs_headers[0]));
+        if (!p)
+            return LSQUIC_HDR_ERR_NOMEM;
+        hset->hs_headers = p;
+        hset->hs_nalloc = nalloc;
+    }
+
+    if (hset->hs_buf_off + name_len + value_len > hset->hs_buf_sz)
+    {
+        buf_sz = hset->hs_buf_sz ? hset->hs_buf_sz : MIN_BUF_SZ;
+        while (buf_sz < hset->hs_buf_off + name_len + value_len)
+            buf_sz *= 2;
+        p = realloc(hset->hs_buf, buf_sz);
+        if (!p)
+            return LSQUIC_HDR_ERR_NOMEM;
+        hset->hs_buf = p;
+        hset->hs_buf_sz = buf_sz;
+    }
+
+    /* Pointers are set when the header set is complete */
+    header = &hset->hs_headers[ hset->hs_count++ ];
+    header->name = (const char *) (uintptr_t) hset->hs_buf_off;
+    header->name_len = name_len;
+    memcpy(hset->hs_buf + hset->hs_buf_off, name, name_len);
+    hset->hs_buf_off += name_len;
+    header->value = (const char *) (uintptr_t) hset->hs_buf_off;
+    header->value_len = value_len;
+    memcpy(hset->hs_buf + hset->hs_buf_off, value, value_len);
+    hset->hs_buf_off += value_len;
+    header->name_idx = name_idx;
+
+    return LSQUIC_HDR_OK;
+}
+
+
+static enum lsquic_header_status
+finish_hset (struct lsquic_hset *hset)
+{
+    struct lsquic_hset_header *header;
+    enum lsquic_header_status st;
+
+    if (!(hset->hs_flags & HS_REGULAR))
+    {
+        st = check_pseudo_headers(hset);
+        if (st != LSQUIC_HDR_OK)
+            return st;
+    }
+
+    for (header = hset->hs_headers; header < hset->hs_headers
+                                                + hset->hs_count; ++header)
+    {
+        header->name = hset->hs_buf + (uintptr_t) header->name;
+        header->value = hset->hs_buf + (uintptr_t) header->value;
+    }
+
+    return LSQUIC_HDR_OK;
+}
+
+
+static enum lsquic_header_status
+hset_process_header (void *hset_p, unsigned name_idx,
+                    const char *name, unsigned name_len,
+                    const char *value, unsigned value_len)
+{
+    struct lsquic_hset *const hset = hset_p;
+    if (name)
+        return add_header(hset, name_idx, name, name_len, value, value_len);
+    else
+        return finish_hset(hset);
+}
+
+
+void
+lsquic_hset_destroy (struct lsquic_hset *hset)
+{
+    free(hset->hs_headers);
+    free(hset->hs_buf);
+    free(hset);
+}
+
+
+static void
+hset_discard (void *hset)
+{
+    lsquic_hset_destroy(hset);
+}
+
+
+unsigned
+lsquic_hset_count (const struct lsquic_hset *hset)
+{
+    return hset->hs_count;
+}
+
+
+const struct lsquic_hset_header *
+lsquic_hset_first (const struct lsquic_hset *hset)
+{
+    if (hset->hs_count > 0)
+        return &hset->hs_headers[0];
+    else
+        return NULL;
+}
+
+
+const struct lsquic_hset_header *
+lsquic_hset_next (const struct lsquic_hset *hset,
+                                    const struct lsquic_hset_header *header)
+{
+    if (header + 1 < hset->hs_headers + hset->hs_count)
+        return header + 1;
+    else
+        return NULL;
+}
+
+
+const struct lsquic_hset_header *
+lsquic_hset_find (const struct lsquic_hset *hset,
+                  const struct lsquic_hset_header *after,
+                  const char *name, unsigned name_len)
+{
+    const struct lsquic_hset_header *header;
+
+    header = after ? after + 1 : hset->hs_headers;
+    for ( ; header < hset->hs_headers + hset->hs_count; ++header)
+        if (header->name_len == name_len
+                            && 0 == memcmp(header->name, name, name_len))
+            return header;
+
+    return NULL;
+}
+
+
+static const struct lsquic_hset_if native_if =
+{
+    .hsi_create_header_set  = hset_create,
+    .hsi_process_header     = hset_process_header,
+    .hsi_discard_header_set = hset_discard,
+};
+
+const struct lsquic_hset_if *const lsquic_hset_native_if = &native_if;
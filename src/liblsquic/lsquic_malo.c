@@ -38,6 +38,8 @@
  *  2. 4 KB pages are not freed until the malo allocator is destroyed.
  *     This is something to keep in mind.
  *
+ * Pages can come from the heap or from an arena (see lsquic_arena.h).
+ *
  * P.S. In Russian, "malo" (мало) means "little" or "few".  Thus, the
  *      malo allocator aims to perform its job in as few CPU cycles as
  *      possible.
@@ -53,6 +55,7 @@
 #endif
 
 #include "fiu-local.h"
+#include "lsquic_arena.h"
 #include "lsquic_malo.h"
 
 /* 64 slots in a 4KB page means that the smallest object is 64 bytes.
@@ -84,14 +87,50 @@ struct malo {
     struct malo_page        page_header;
     SLIST_HEAD(, malo_page) all_pages;
     LIST_HEAD(, malo_page)  free_pages;
+    struct lsquic_arena    *arena;      /* May be NULL */
     struct {
         struct malo_page   *cur_page;
         unsigned            next_slot;
     }                       iter;
 };
 
+static void *
+get_page (struct lsquic_arena *arena)
+{
+    void *page;
+
+    if (arena)
+        return lsquic_arena_get_page(arena);
+    else if (0 == posix_memalign(&page, 0x1000, 0x1000))
+        return page;
+    else
+        return NULL;
+}
+
+
+static void
+put_page (struct lsquic_arena *arena, void *page)
+{
+    if (arena)
+        lsquic_arena_put_page(arena, page);
+    else
+#ifndef WIN32
+        free(page);
+#else
+        _aligned_free(page);
+#endif
+}
+
+
 struct malo *
 lsquic_malo_create (size_t obj_size)
+{
+    return lsquic_malo_create_arena(obj_size, NULL);
+}
+
+
+struct malo *
+lsquic_malo_create_arena (size_t obj_size, struct lsquic_arena *arena)
 {
     unsigned nbits = size_in_bits(obj_size);
     if (nbits < MALO_MIN_NBITS)
@@ -102,12 +141,13 @@ lsquic_malo_create (size_t obj_size)
         return NULL;
     }
 
-    struct malo *malo;
-    if (0 != posix_memalign((void **) &malo, 0x1000, 0x1000))
+    struct malo *malo = get_page(arena);
+    if (!malo)
         return NULL;
 
     SLIST_INIT(&malo->all_pages);
     LIST_INIT(&malo->free_pages);
+    malo->arena = arena;
     malo->iter.cur_page = &malo->page_header;
     malo->iter.next_slot = 0;
 
@@ -133,8 +173,8 @@ lsquic_malo_create (size_t obj_size)
 static struct malo_page *
 allocate_page (struct malo *malo)
 {
-    struct malo_page *page;
-    if (0 != posix_memalign((void **) &page, 0x1000, 0x1000))
+    struct malo_page *page = get_page(malo->arena);
+    if (!page)
         return NULL;
     SLIST_INSERT_HEAD(&malo->all_pages, page, next_page);
     LIST_INSERT_HEAD(&malo->free_pages, page, next_free_page);
@@ -185,23 +225,16 @@ lsquic_malo_put (void *obj)
 void
 lsquic_malo_destroy (struct malo *malo)
 {
+    struct lsquic_arena *const arena = malo->arena;
     struct malo_page *page, *next;
     page = SLIST_FIRST(&malo->all_pages);
     while (page != &malo->page_header)
     {
         next = SLIST_NEXT(page, next_page);
-#ifndef WIN32
-        free(page);
-#else
-        _aligned_free(page);
-#endif
+        put_page(arena, page);
         page = next;
     }
-#ifndef WIN32
-    free(page);
-#else
-        _aligned_free(page);
-#endif
+    put_page(arena, page);
 }
 
 
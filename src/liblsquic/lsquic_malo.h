@@ -7,11 +7,19 @@
 #define LSQUIC_MALO_H 1
 
 struct malo;
+struct lsquic_arena;
 
 /* Create a malo allocator for objects of size `obj_size'. */
 struct malo *
 lsquic_malo_create (size_t obj_size);
 
+/* Same as above, but pages are taken from -- and returned to -- the arena
+ * instead of the heap.  If `arena' is NULL, this is the same as
+ * lsquic_malo_create().
+ */
+struct malo *
+lsquic_malo_create_arena (size_t obj_size, struct lsquic_arena *arena);
+
 /* Get a new object. */
 void *
 lsquic_malo_get (struct malo *);
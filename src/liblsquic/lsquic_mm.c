@@ -5,6 +5,10 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
@@ -15,8 +19,12 @@
 #include "lsquic.h"
 #include "lsquic_int_types.h"
 #include "lsquic_malo.h"
+#include "lsquic_arena.h"
 #include "lsquic_conn.h"
 #include "lsquic_rtt.h"
+#include "lsquic_conn_flow.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
 #include "lsquic_packet_common.h"
 #include "lsquic_packet_in.h"
 #include "lsquic_packet_out.h"
@@ -26,46 +34,152 @@
 
 #define FAIL_NOMEM do { errno = ENOMEM; return NULL; } while (0)
 
+/* How often cached buffers that are not in use are released: */
+#define MM_TRIM_PERIOD 1000000
 
-struct payload_buf
+
+struct mm_buf
 {
-    SLIST_ENTRY(payload_buf)  next_pb;
+    SLIST_ENTRY(mm_buf)     next_mmb;
 };
 
-struct packet_out_buf
-{
-    SLIST_ENTRY(packet_out_buf) next_pob;
+
+/* Based on commonly used MTUs, ordered from small to large: */
+enum {
+    PACKET_OUT_PAYLOAD_0 = 1280                    - QUIC_MIN_PACKET_OVERHEAD,
+    PACKET_OUT_PAYLOAD_1 = QUIC_MAX_IPv6_PACKET_SZ - QUIC_MIN_PACKET_OVERHEAD,
+    PACKET_OUT_PAYLOAD_2 = QUIC_MAX_IPv4_PACKET_SZ - QUIC_MIN_PACKET_OVERHEAD,
 };
 
-struct four_k_page
+
+static const unsigned pool_buf_sizes[N_MM_POOLS] =
 {
-    SLIST_ENTRY(four_k_page)  next_fkp;
+    [MM_POOL_PACKET_OUT_0]  = PACKET_OUT_PAYLOAD_0,
+    [MM_POOL_PACKET_OUT_1]  = PACKET_OUT_PAYLOAD_1,
+    [MM_POOL_PACKET_OUT_2]  = PACKET_OUT_PAYLOAD_2,
+    [MM_POOL_1370]          = 1370,
+    [MM_POOL_4K]            = 0x1000,
+    [MM_POOL_16K]           = 0x4000,
 };
 
-struct sixteen_k_page
+
+/* The high watermarks are set to about 1.5 MB per pool */
+static const struct {
+    unsigned    low, high;
+} default_watermarks[N_MM_POOLS] =
 {
-    SLIST_ENTRY(sixteen_k_page)  next_skp;
+    [MM_POOL_PACKET_OUT_0]  = {  32, 1024, },
+    [MM_POOL_PACKET_OUT_1]  = {  32, 1024, },
+    [MM_POOL_PACKET_OUT_2]  = {  32, 1024, },
+    [MM_POOL_1370]          = {  32, 1024, },
+    [MM_POOL_4K]            = {   8,  384, },
+    [MM_POOL_16K]           = {   2,   96, },
 };
 
 
-int
-lsquic_mm_init (struct lsquic_mm *mm)
+static void *
+pool_get (struct lsquic_mm *mm, enum mm_pool_idx idx)
+{
+    struct mm_pool *const pool = &mm->pools[idx];
+    struct mm_buf *buf;
+
+    buf = SLIST_FIRST(&pool->mmp_free);
+    if (buf)
+    {
+        SLIST_REMOVE_HEAD(&pool->mmp_free, next_mmb);
+        --pool->mmp_stats.mps_cached;
+        if (pool->mmp_stats.mps_cached < pool->mmp_min_cached)
+            pool->mmp_min_cached = pool->mmp_stats.mps_cached;
+    }
+    else
+    {
+        if (mm->arena)
+            buf = lsquic_arena_alloc(mm->arena, pool_buf_sizes[idx]);
+        else
+            buf = malloc(pool_buf_sizes[idx]);
+        if (!buf)
+            return NULL;
+        if (pool->mmp_stats.mps_in_use + pool->mmp_stats.mps_cached
+                                            >= pool->mmp_stats.mps_peak)
+            pool->mmp_stats.mps_peak = pool->mmp_stats.mps_in_use
+                                            + pool->mmp_stats.mps_cached + 1;
+    }
+
+    ++pool->mmp_stats.mps_in_use;
+    return buf;
+}
+
+
+static void
+pool_put (struct lsquic_mm *mm, enum mm_pool_idx idx, void *mem)
+{
+    struct mm_pool *const pool = &mm->pools[idx];
+    struct mm_buf *const buf = mem;
+
+    assert(pool->mmp_stats.mps_in_use > 0);
+    --pool->mmp_stats.mps_in_use;
+    if (pool->mmp_stats.mps_cached < pool->mmp_high || mm->arena)
+    {
+        SLIST_INSERT_HEAD(&pool->mmp_free, buf, next_mmb);
+        ++pool->mmp_stats.mps_cached;
+    }
+    else
+        free(buf);
+}
+
+
+/* Free up to `count' cached buffers.  Returns number of bytes freed. */
+static size_t
+pool_release (struct lsquic_mm *mm, enum mm_pool_idx idx, unsigned count)
 {
-    int i;
+    struct mm_pool *const pool = &mm->pools[idx];
+    struct mm_buf *buf;
+    unsigned n;
+
+    if (mm->arena)
+        return 0;
+
+    for (n = 0; n < count && (buf = SLIST_FIRST(&pool->mmp_free)); ++n)
+    {
+        SLIST_REMOVE_HEAD(&pool->mmp_free, next_mmb);
+        free(buf);
+    }
+    pool->mmp_stats.mps_cached -= n;
+    if (pool->mmp_min_cached > pool->mmp_stats.mps_cached)
+        pool->mmp_min_cached = pool->mmp_stats.mps_cached;
 
+    return (size_t) n * pool_buf_sizes[idx];
+}
+
+
+static int
+mm_init (struct lsquic_mm *mm, struct lsquic_arena *arena)
+{
+    enum mm_pool_idx idx;
+
+    mm->arena = arena;
     mm->acki = malloc(sizeof(*mm->acki));
-    mm->malo.stream_frame = lsquic_malo_create(sizeof(struct stream_frame));
-    mm->malo.stream_rec_arr = lsquic_malo_create(sizeof(struct stream_rec_arr));
-    mm->malo.packet_in = lsquic_malo_create(sizeof(struct lsquic_packet_in));
-    mm->malo.packet_out = lsquic_malo_create(sizeof(struct lsquic_packet_out));
+    mm->malo.stream_frame = lsquic_mm_malo_create(mm,
+                                                sizeof(struct stream_frame));
+    mm->malo.stream_rec_arr = lsquic_mm_malo_create(mm,
+                                                sizeof(struct stream_rec_arr));
+    mm->malo.packet_in = lsquic_mm_malo_create(mm,
+                                            sizeof(struct lsquic_packet_in));
+    mm->malo.packet_out = lsquic_mm_malo_create(mm,
+                                            sizeof(struct lsquic_packet_out));
+    mm->malo.stream = lsquic_mm_malo_create(mm, sizeof(struct lsquic_stream));
     TAILQ_INIT(&mm->free_packets_in);
-    for (i = 0; i < MM_N_OUT_BUCKETS; ++i)
-        SLIST_INIT(&mm->packet_out_bufs[i]);
-    SLIST_INIT(&mm->payload_bufs);
-    SLIST_INIT(&mm->four_k_pages);
-    SLIST_INIT(&mm->sixteen_k_pages);
+    for (idx = 0; idx < N_MM_POOLS; ++idx)
+    {
+        SLIST_INIT(&mm->pools[idx].mmp_free);
+        memset(&mm->pools[idx].mmp_stats, 0, sizeof(mm->pools[idx].mmp_stats));
+        mm->pools[idx].mmp_low = default_watermarks[idx].low;
+        mm->pools[idx].mmp_high = default_watermarks[idx].high;
+        mm->pools[idx].mmp_min_cached = 0;
+    }
+    mm->next_trim = 0;
     if (mm->acki && mm->malo.stream_frame && mm->malo.stream_rec_arr &&
-                              mm->malo.packet_in)
+                              mm->malo.packet_in && mm->malo.stream)
     {
         return 0;
     }
@@ -74,45 +188,126 @@ lsquic_mm_init (struct lsquic_mm *mm)
 }
 
 
+int
+lsquic_mm_init (struct lsquic_mm *mm)
+{
+    return mm_init(mm, NULL);
+}
+
+
+int
+lsquic_mm_init_arena (struct lsquic_mm *mm)
+{
+    struct lsquic_arena *arena;
+
+    arena = lsquic_arena_new();
+    if (!arena)
+        return -1;
+
+    if (0 == mm_init(mm, arena))
+        return 0;
+
+    free(mm->acki);
+    lsquic_arena_destroy(arena);
+    return -1;
+}
+
+
+struct malo *
+lsquic_mm_malo_create (struct lsquic_mm *mm, size_t obj_size)
+{
+    return lsquic_malo_create_arena(obj_size, mm->arena);
+}
+
+
 void
 lsquic_mm_cleanup (struct lsquic_mm *mm)
 {
-    int i;
-    struct packet_out_buf *pob;
-    struct payload_buf *pb;
-    struct four_k_page *fkp;
-    struct sixteen_k_page *skp;
+    enum mm_pool_idx idx;
 
     free(mm->acki);
     lsquic_malo_destroy(mm->malo.packet_in);
     lsquic_malo_destroy(mm->malo.packet_out);
     lsquic_malo_destroy(mm->malo.stream_frame);
     lsquic_malo_destroy(mm->malo.stream_rec_arr);
+    lsquic_malo_destroy(mm->malo.stream);
 
-    for (i = 0; i < MM_N_OUT_BUCKETS; ++i)
-        while ((pob = SLIST_FIRST(&mm->packet_out_bufs[i])))
-        {
-            SLIST_REMOVE_HEAD(&mm->packet_out_bufs[i], next_pob);
-            free(pob);
-        }
+    for (idx = 0; idx < N_MM_POOLS; ++idx)
+        (void) pool_release(mm, idx, UINT_MAX);
 
-    while ((pb = SLIST_FIRST(&mm->payload_bufs)))
-    {
-        SLIST_REMOVE_HEAD(&mm->payload_bufs, next_pb);
-        free(pb);
-    }
+    if (mm->arena)
+        lsquic_arena_destroy(mm->arena);
+}
 
-    while ((fkp = SLIST_FIRST(&mm->four_k_pages)))
+
+void
+lsquic_mm_set_watermarks (struct lsquic_mm *mm, enum mm_pool_idx idx,
+                                                unsigned low, unsigned high)
+{
+    struct mm_pool *const pool = &mm->pools[idx];
+
+    if (low > high)
+        low = high;
+    pool->mmp_low = low;
+    pool->mmp_high = high;
+    if (pool->mmp_stats.mps_cached > high)
+        (void) pool_release(mm, idx, pool->mmp_stats.mps_cached - high);
+}
+
+
+size_t
+lsquic_mm_maybe_trim (struct lsquic_mm *mm, lsquic_time_t now)
+{
+    struct mm_pool *pool;
+    enum mm_pool_idx idx;
+    unsigned count;
+    size_t freed;
+
+    if (now < mm->next_trim)
+        return 0;
+    mm->next_trim = now + MM_TRIM_PERIOD;
+
+    freed = 0;
+    for (idx = 0; idx < N_MM_POOLS; ++idx)
     {
-        SLIST_REMOVE_HEAD(&mm->four_k_pages, next_fkp);
-        free(fkp);
+        pool = &mm->pools[idx];
+        if (pool->mmp_stats.mps_cached > pool->mmp_low)
+        {
+            count = pool->mmp_stats.mps_cached - pool->mmp_low;
+            if (count > pool->mmp_min_cached)
+                count = pool->mmp_min_cached;
+            freed += pool_release(mm, idx, count);
+        }
+        pool->mmp_min_cached = pool->mmp_stats.mps_cached;
     }
 
-    while ((skp = SLIST_FIRST(&mm->sixteen_k_pages)))
+    return freed;
+}
+
+
+size_t
+lsquic_mm_trim (struct lsquic_mm *mm)
+{
+    struct mm_pool *pool;
+    enum mm_pool_idx idx;
+    size_t freed;
+
+    freed = 0;
+    for (idx = 0; idx < N_MM_POOLS; ++idx)
     {
-        SLIST_REMOVE_HEAD(&mm->sixteen_k_pages, next_skp);
-        free(skp);
+        pool = &mm->pools[idx];
+        if (pool->mmp_stats.mps_cached > pool->mmp_low)
+            freed += pool_release(mm, idx,
+                                pool->mmp_stats.mps_cached - pool->mmp_low);
     }
+
+#ifdef __GLIBC__
+    /* Hand the freed memory back to the OS */
+    if (freed)
+        (void) malloc_trim(0);
+#endif
+
+    return freed;
 }
 
 
@@ -139,21 +334,6 @@ lsquic_mm_get_packet_in (struct lsquic_mm *mm)
 }
 
 
-/* Based on commonly used MTUs, ordered from small to large: */
-enum {
-    PACKET_OUT_PAYLOAD_0 = 1280                    - QUIC_MIN_PACKET_OVERHEAD,
-    PACKET_OUT_PAYLOAD_1 = QUIC_MAX_IPv6_PACKET_SZ - QUIC_MIN_PACKET_OVERHEAD,
-    PACKET_OUT_PAYLOAD_2 = QUIC_MAX_IPv4_PACKET_SZ - QUIC_MIN_PACKET_OVERHEAD,
-};
-
-
-static const unsigned packet_out_sizes[] = {
-    PACKET_OUT_PAYLOAD_0,
-    PACKET_OUT_PAYLOAD_1,
-    PACKET_OUT_PAYLOAD_2,
-};
-
-
 static unsigned
 packet_out_index (unsigned size)
 {
@@ -167,13 +347,10 @@ void
 lsquic_mm_put_packet_out (struct lsquic_mm *mm,
                           struct lsquic_packet_out *packet_out)
 {
-    struct packet_out_buf *pob;
-    unsigned idx;
-
     assert(packet_out->po_data);
-    pob = (struct packet_out_buf *) packet_out->po_data;
-    idx = packet_out_index(packet_out->po_n_alloc);
-    SLIST_INSERT_HEAD(&mm->packet_out_bufs[idx], pob, next_pob);
+    pool_put(mm, MM_POOL_PACKET_OUT_0
+                        + packet_out_index(packet_out->po_n_alloc),
+                                                        packet_out->po_data);
     lsquic_malo_put(packet_out);
 }
 
@@ -183,8 +360,7 @@ lsquic_mm_get_packet_out (struct lsquic_mm *mm, struct malo *malo,
                           unsigned short size)
 {
     struct lsquic_packet_out *packet_out;
-    struct packet_out_buf *pob;
-    unsigned idx;
+    void *buf;
 
     assert(size <= QUIC_MAX_PAYLOAD_SZ);
 
@@ -194,23 +370,16 @@ lsquic_mm_get_packet_out (struct lsquic_mm *mm, struct malo *malo,
     if (!packet_out)
         return NULL;
 
-    idx = packet_out_index(size);
-    pob = SLIST_FIRST(&mm->packet_out_bufs[idx]);
-    if (pob)
-        SLIST_REMOVE_HEAD(&mm->packet_out_bufs[idx], next_pob);
-    else
+    buf = pool_get(mm, MM_POOL_PACKET_OUT_0 + packet_out_index(size));
+    if (!buf)
     {
-        pob = malloc(packet_out_sizes[idx]);
-        if (!pob)
-        {
-            lsquic_malo_put(packet_out);
-            return NULL;
-        }
+        lsquic_malo_put(packet_out);
+        return NULL;
     }
 
     memset(packet_out, 0, sizeof(*packet_out));
     packet_out->po_n_alloc = size;
-    packet_out->po_data = (unsigned char *) pob;
+    packet_out->po_data = buf;
 
     return packet_out;
 }
@@ -219,63 +388,45 @@ lsquic_mm_get_packet_out (struct lsquic_mm *mm, struct malo *malo,
 void *
 lsquic_mm_get_1370 (struct lsquic_mm *mm)
 {
-    struct payload_buf *pb = SLIST_FIRST(&mm->payload_bufs);
     fiu_do_on("mm/1370", FAIL_NOMEM);
-    if (pb)
-        SLIST_REMOVE_HEAD(&mm->payload_bufs, next_pb);
-    else
-        pb = malloc(1370);
-    return pb;
+    return pool_get(mm, MM_POOL_1370);
 }
 
 
 void
 lsquic_mm_put_1370 (struct lsquic_mm *mm, void *mem)
 {
-    struct payload_buf *pb = mem;
-    SLIST_INSERT_HEAD(&mm->payload_bufs, pb, next_pb);
+    pool_put(mm, MM_POOL_1370, mem);
 }
 
 
 void *
 lsquic_mm_get_4k (struct lsquic_mm *mm)
 {
-    struct four_k_page *fkp = SLIST_FIRST(&mm->four_k_pages);
     fiu_do_on("mm/4k", FAIL_NOMEM);
-    if (fkp)
-        SLIST_REMOVE_HEAD(&mm->four_k_pages, next_fkp);
-    else
-        fkp = malloc(0x1000);
-    return fkp;
+    return pool_get(mm, MM_POOL_4K);
 }
 
 
 void
 lsquic_mm_put_4k (struct lsquic_mm *mm, void *mem)
 {
-    struct four_k_page *fkp = mem;
-    SLIST_INSERT_HEAD(&mm->four_k_pages, fkp, next_fkp);
+    pool_put(mm, MM_POOL_4K, mem);
 }
 
 
 void *
 lsquic_mm_get_16k (struct lsquic_mm *mm)
 {
-    struct sixteen_k_page *skp = SLIST_FIRST(&mm->sixteen_k_pages);
     fiu_do_on("mm/16k", FAIL_NOMEM);
-    if (skp)
-        SLIST_REMOVE_HEAD(&mm->sixteen_k_pages, next_skp);
-    else
-        skp = malloc(16 * 1024);
-    return skp;
+    return pool_get(mm, MM_POOL_16K);
 }
 
 
 void
 lsquic_mm_put_16k (struct lsquic_mm *mm, void *mem)
 {
-    struct sixteen_k_page *skp = mem;
-    SLIST_INSERT_HEAD(&mm->sixteen_k_pages, skp, next_skp);
+    pool_put(mm, MM_POOL_16K, mem);
 }
 
 
@@ -293,32 +444,24 @@ lsquic_mm_put_packet_in (struct lsquic_mm *mm,
 size_t
 lsquic_mm_mem_used (const struct lsquic_mm *mm)
 {
-    const struct packet_out_buf *pob;
-    const struct payload_buf *pb;
-    const struct four_k_page *fkp;
-    const struct sixteen_k_page *skp;
-    unsigned i;
+    enum mm_pool_idx idx;
     size_t size;
 
     size = sizeof(*mm);
     size += sizeof(*mm->acki);
+    if (mm->arena)
+        /* Malo pages and buffers are all inside the arena */
+        return size + lsquic_arena_mem_used(mm->arena);
+
     size += lsquic_malo_mem_used(mm->malo.stream_frame);
     size += lsquic_malo_mem_used(mm->malo.stream_rec_arr);
     size += lsquic_malo_mem_used(mm->malo.packet_in);
     size += lsquic_malo_mem_used(mm->malo.packet_out);
+    size += lsquic_malo_mem_used(mm->malo.stream);
 
-    for (i = 0; i < MM_N_OUT_BUCKETS; ++i)
-        SLIST_FOREACH(pob, &mm->packet_out_bufs[i], next_pob)
-            size += packet_out_sizes[i];
-
-    SLIST_FOREACH(pb, &mm->payload_bufs, next_pb)
-        size += 1370;
-
-    SLIST_FOREACH(fkp, &mm->four_k_pages, next_fkp)
-        size += 0x1000;
-
-    SLIST_FOREACH(skp, &mm->sixteen_k_pages, next_skp)
-        size += 0x4000;
+    for (idx = 0; idx < N_MM_POOLS; ++idx)
+        size += (size_t) mm->pools[idx].mmp_stats.mps_cached
+                                                    * pool_buf_sizes[idx];
 
     return size;
 }
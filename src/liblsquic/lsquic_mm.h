@@ -9,14 +9,52 @@
 #ifndef LSQUIC_MM_H
 #define LSQUIC_MM_H 1
 
+#include "lsquic_int_types.h"
+
 struct lsquic_engine_public;
 struct lsquic_packet_in;
 struct lsquic_packet_out;
 struct ack_info;
 struct malo;
+struct lsquic_arena;
 
 #define MM_N_OUT_BUCKETS 3
 
+/* Pools of buffers that are cached on free lists.  Objects allocated using
+ * malo (packets, stream frames, streams) are not counted here.
+ */
+enum mm_pool_idx {
+    MM_POOL_PACKET_OUT_0,       /* MM_N_OUT_BUCKETS pools for packet_out */
+    MM_POOL_PACKET_OUT_1,       /*   payload buffers, from smallest to */
+    MM_POOL_PACKET_OUT_2,       /*   largest. */
+    MM_POOL_1370,               /* Also used for stream send buffers */
+    MM_POOL_4K,
+    MM_POOL_16K,
+    N_MM_POOLS
+};
+
+struct mm_pool_stats
+{
+    unsigned            mps_in_use;     /* Handed out */
+    unsigned            mps_cached;     /* Sitting on the free list */
+    unsigned            mps_peak;       /* Largest in_use + cached */
+};
+
+struct mm_pool
+{
+    SLIST_HEAD(, mm_buf)    mmp_free;
+    struct mm_pool_stats    mmp_stats;
+    /* Free list never grows above the high watermark: buffers are freed
+     * instead.  Periodic trimming does not shrink it below the low
+     * watermark.
+     */
+    unsigned                mmp_low, mmp_high;
+    /* Smallest size of the free list since last periodic trim.  This many
+     * buffers were not needed during the last period.
+     */
+    unsigned                mmp_min_cached;
+};
+
 struct lsquic_mm {
     struct ack_info     *acki;
     struct {
@@ -24,17 +62,32 @@ struct lsquic_mm {
         struct malo     *stream_rec_arr;/* For struct stream_rec_arr */
         struct malo     *packet_in;     /* For struct lsquic_packet_in */
         struct malo     *packet_out;    /* For struct lsquic_packet_out */
+        struct malo     *stream;        /* For struct lsquic_stream */
     }                    malo;
     TAILQ_HEAD(, lsquic_packet_in)  free_packets_in;
-    SLIST_HEAD(, packet_out_buf)    packet_out_bufs[MM_N_OUT_BUCKETS];
-    SLIST_HEAD(, payload_buf)       payload_bufs;
-    SLIST_HEAD(, four_k_page)       four_k_pages;
-    SLIST_HEAD(, sixteen_k_page)    sixteen_k_pages;
+    struct mm_pool                  pools[N_MM_POOLS];
+    lsquic_time_t                   next_trim;
+    /* If set, malo pages and buffers come from the arena.  Buffers cannot
+     * be returned to the arena, so the pools are not bounded or trimmed.
+     */
+    struct lsquic_arena            *arena;
 };
 
 int
 lsquic_mm_init (struct lsquic_mm *);
 
+/* Same as lsquic_mm_init(), but carve memory out of an arena which the
+ * memory manager creates and owns.
+ */
+int
+lsquic_mm_init_arena (struct lsquic_mm *);
+
+/* Create a malo allocator that uses the same backend as the memory
+ * manager.
+ */
+struct malo *
+lsquic_mm_malo_create (struct lsquic_mm *, size_t obj_size);
+
 void
 lsquic_mm_cleanup (struct lsquic_mm *);
 
@@ -78,4 +131,23 @@ lsquic_mm_put_16k (struct lsquic_mm *, void *);
 size_t
 lsquic_mm_mem_used (const struct lsquic_mm *mm);
 
+void
+lsquic_mm_set_watermarks (struct lsquic_mm *, enum mm_pool_idx,
+                                                unsigned low, unsigned high);
+
+#define lsquic_mm_pool_stats(mm, pool) (&(mm)->pools[pool].mmp_stats)
+
+/* Release cached buffers that were not needed during the last trim period,
+ * but keep at least the low watermark of each pool.  This is called from
+ * the engine tick.  Returns number of bytes freed.
+ */
+size_t
+lsquic_mm_maybe_trim (struct lsquic_mm *, lsquic_time_t now);
+
+/* Release all cached buffers above the low watermarks right away.  Returns
+ * number of bytes freed.
+ */
+size_t
+lsquic_mm_trim (struct lsquic_mm *);
+
 #endif
@@ -57,6 +57,10 @@ typedef struct lsquic_packet_in
         PI_DECRYPTED    = (1 << 0),
         PI_OWN_DATA     = (1 << 1),                /* We own pi_data */
         PI_CONN_ID      = (1 << 2),                /* pi_conn_id is set */
+        PI_FRAME_COPIES = (1 << 3),                /* Holds copies of stream
+                                                    * frames, see
+                                                    * lsquic_di_nocopy.c
+                                                    */
 #define PIBIT_ENC_LEV_SHIFT 5
         PI_ENC_LEV_BIT_0= (1 << 5),                /* Encodes encryption level */
         PI_ENC_LEV_BIT_1= (1 << 6),                /*  (see enum enc_level). */
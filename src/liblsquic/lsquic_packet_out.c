@@ -5,6 +5,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/queue.h>
@@ -27,6 +28,24 @@
 typedef char _stream_rec_arr_is_at_most_64bytes[
                                 (sizeof(struct stream_rec_arr) <= 64)? 1: - 1];
 
+/* See the comment above struct lsquic_packet_out */
+#define PO_FIELD_END(field) (offsetof(struct lsquic_packet_out, field) \
+                        + sizeof(((struct lsquic_packet_out *) 0)->field))
+typedef char _packet_out_queue_walk_fields_in_32_bytes[
+    (PO_FIELD_END(po_next) <= 32 && PO_FIELD_END(po_packno) <= 32
+                                 && PO_FIELD_END(po_sent) <= 32) ? 1 : - 1];
+typedef char _packet_out_ack_fields_in_first_cache_line[
+    (PO_FIELD_END(po_flags) <= 64 && PO_FIELD_END(po_data_sz) <= 64
+        && PO_FIELD_END(po_sent_sz) <= 64 && PO_FIELD_END(po_ack2ed) <= 64
+        && PO_FIELD_END(po_data) <= 64 && PO_FIELD_END(po_n_alloc) <= 64)
+                                                                ? 1 : - 1];
+/* po_frame_types is a bit field, so it is checked indirectly: */
+typedef char _packet_out_frame_types_before_data_sz[
+    (offsetof(struct lsquic_packet_out, po_flags)
+        < offsetof(struct lsquic_packet_out, po_data_sz)) ? 1 : - 1];
+typedef char _packet_out_fits_in_128_byte_slot[
+                    (sizeof(struct lsquic_packet_out) <= 128) ? 1 : - 1];
+
 static struct stream_rec *
 srec_one_posi_first (struct packet_out_srec_iter *posi,
                      struct lsquic_packet_out *packet_out)
@@ -54,6 +54,20 @@ struct stream_rec_arr {
 
 TAILQ_HEAD(stream_rec_arr_tailq, stream_rec_arr);
 
+/* The layout of this struct is driven by ACK processing and loss
+ * detection, which walk long queues of unacked packets.
+ *
+ * The first 32 bytes hold what is needed to walk the queue and to match
+ * packets against ACK ranges and loss timers.  The rest of the first
+ * cache line holds everything else read when a packet is acknowledged.
+ * Packet objects are allocated in 128-byte malo slots, which start on a
+ * cache line boundary, so this is a single line.
+ *
+ * The fields after that are only used when the packet is filled in,
+ * encrypted, or sent.
+ *
+ * The layout is verified at compile time in lsquic_packet_out.c.
+ */
 typedef struct lsquic_packet_out
 {
     /* `po_next' is used for packets_out, unacked_packets and expired_packets
@@ -61,8 +75,8 @@ typedef struct lsquic_packet_out
      */
     TAILQ_ENTRY(lsquic_packet_out)
                        po_next;
-    lsquic_time_t      po_sent;       /* Time sent */
     lsquic_packno_t    po_packno;
+    lsquic_time_t      po_sent;       /* Time sent */
 
     enum packet_out_flags {
         PO_HELLO    = (1 << 1),         /* Packet contains SHLO or CHLO data */
@@ -96,19 +110,20 @@ typedef struct lsquic_packet_out
     }                  po_flags;
     enum quic_ft_bit   po_frame_types:16; /* Bitmask of QUIC_FRAME_* */
     unsigned short     po_data_sz;      /* Number of usable bytes in data */
-    unsigned short     po_enc_data_sz;  /* Number of usable bytes in data */
     unsigned short     po_sent_sz;      /* If PO_SENT_SZ is set, real size of sent buffer. */
     unsigned short     po_regen_sz;     /* Number of bytes at the beginning
                                          * of data containing bytes that are
                                          * not to be retransmitted, e.g. ACK
                                          * frames.
                                          */
+    unsigned short     po_enc_data_sz;  /* Number of usable bytes in data */
     unsigned short     po_n_alloc;      /* Total number of bytes allocated in po_data */
-    enum header_type   po_header_type:8;
-    unsigned char     *po_data;
     lsquic_packno_t    po_ack2ed;       /* If packet has ACK frame, value of
                                          * largest acked in it.
                                          */
+    unsigned char     *po_data;
+
+    /* Cold fields follow */
 
     /* A lot of packets contain data belonging to only one stream.  Thus,
      * `one' is used first.  If this is not enough, any number of
@@ -125,14 +140,14 @@ typedef struct lsquic_packet_out
      */
     unsigned char     *po_enc_data;
 
-    lsquic_ver_tag_t   po_ver_tag;      /* Set if PO_VERSION is set */
     unsigned char     *po_nonce;        /* Use to generate header if PO_NONCE is set */
+    lsquic_ver_tag_t   po_ver_tag;      /* Set if PO_VERSION is set */
+    enum header_type   po_header_type:8;
 } lsquic_packet_out_t;
 
-/* The size of lsquic_packet_out_t could be further reduced:
- *
- * po_ver_tag could be encoded as a few bits representing enum lsquic_version
- * in po_flags.  The cost is a bit of complexity.  This will save us four bytes.
+/* po_ver_tag could be encoded as a few bits representing enum lsquic_version
+ * in po_flags.  As it shares the last eight bytes with po_header_type, this
+ * would not make the struct smaller.
  */
 
 #define lsquic_packet_out_avail(p) ((unsigned short) \
@@ -1433,6 +1433,26 @@ lsquic_send_ctl_have_delayed_packets (const lsquic_send_ctl_t *ctl)
 }
 
 
+int
+lsquic_send_ctl_is_idle (const lsquic_send_ctl_t *ctl)
+{
+    return ctl->sc_n_in_flight_retx == 0
+        && TAILQ_EMPTY(&ctl->sc_scheduled_packets)
+        && TAILQ_EMPTY(&ctl->sc_lost_packets)
+        && !lsquic_send_ctl_has_buffered(ctl);
+}
+
+
+int
+lsquic_send_ctl_is_empty (const lsquic_send_ctl_t *ctl)
+{
+    return TAILQ_EMPTY(&ctl->sc_scheduled_packets)
+        && TAILQ_EMPTY(&ctl->sc_unacked_packets)
+        && TAILQ_EMPTY(&ctl->sc_lost_packets)
+        && !lsquic_send_ctl_has_buffered(ctl);
+}
+
+
 #ifndef NDEBUG
 static void
 send_ctl_log_packet_q (const lsquic_send_ctl_t *ctl, const char *prefix,
@@ -196,6 +196,19 @@ lsquic_send_ctl_squeeze_sched (lsquic_send_ctl_t *);
 int
 lsquic_send_ctl_have_delayed_packets (const lsquic_send_ctl_t *ctl);
 
+/* Returns true if there is nothing to send and no retransmittable packets
+ * are in flight.  Packets without retransmittable frames (e.g. ACK-only
+ * packets) may still be waiting to be acknowledged.
+ */
+int
+lsquic_send_ctl_is_idle (const lsquic_send_ctl_t *ctl);
+
+/* Returns true if the controller holds no packets at all: none scheduled,
+ * buffered, unacknowledged, or lost.
+ */
+int
+lsquic_send_ctl_is_empty (const lsquic_send_ctl_t *ctl);
+
 void
 lsquic_send_ctl_reset_packnos (lsquic_send_ctl_t *);
 
@@ -189,6 +189,13 @@ lsquic_set32_has (const struct lsquic_set32 *set, uint32_t value)
 }
 
 
+size_t
+lsquic_set32_mem_used (const struct lsquic_set32 *set)
+{
+    return sizeof(*set) + sizeof(set->elems[0]) * set->n_alloc;
+}
+
+
 /* ******* ******* ******** *******
  *
  * The following code is a set of two replacements:
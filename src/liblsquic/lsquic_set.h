@@ -9,6 +9,7 @@
 #ifndef LSQUIC_SET_H
 #define LSQUIC_SET_H 1
 
+#include <stddef.h>
 #include <stdint.h>
 
 struct lsquic_set32_elem;
@@ -32,6 +33,9 @@ lsquic_set32_add (struct lsquic_set32 *, uint32_t value);
 int
 lsquic_set32_has (const struct lsquic_set32 *, uint32_t value);
 
+size_t
+lsquic_set32_mem_used (const struct lsquic_set32 *);
+
 struct lsquic_set64_elem;
 
 typedef struct lsquic_set64 {
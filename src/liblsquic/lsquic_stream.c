@@ -59,6 +59,9 @@
 
 #define SM_BUF_SIZE QUIC_MAX_PACKET_SZ
 
+/* Stream send buffers come from the 1370-byte pool in the memory manager */
+typedef char _sm_buf_fits_1370_pool[SM_BUF_SIZE <= 1370 ? 1 : - 1];
+
 static void
 drop_frames_in (lsquic_stream_t *stream);
 
@@ -236,9 +239,10 @@ lsquic_stream_new_ext (uint32_t id, struct lsquic_conn_public *conn_pub,
     lsquic_cfcw_t *cfcw;
     lsquic_stream_t *stream;
 
-    stream = calloc(1, sizeof(*stream));
+    stream = lsquic_malo_get(conn_pub->mm->malo.stream);
     if (!stream)
         return NULL;
+    memset(stream, 0, sizeof(*stream));
 
     stream->stream_if = stream_if;
     stream->id        = id;
@@ -358,10 +362,11 @@ lsquic_stream_destroy (lsquic_stream_t *stream)
         free(stream->push_req);
     }
     destroy_uh(stream);
-    free(stream->sm_buf);
+    if (stream->sm_buf)
+        lsquic_mm_put_1370(stream->conn_pub->mm, stream->sm_buf);
     LSQ_DEBUG("destroyed stream %u @%p", stream->id, stream);
     SM_HISTORY_DUMP_REMAINING(stream);
-    free(stream);
+    lsquic_malo_put(stream);
 }
 
 
@@ -1763,7 +1768,7 @@ save_to_buffer (lsquic_stream_t *stream, struct lsquic_reader *reader,
 
     if (!stream->sm_buf)
     {
-        stream->sm_buf = malloc(SM_BUF_SIZE);
+        stream->sm_buf = lsquic_mm_get_1370(stream->conn_pub->mm);
         if (!stream->sm_buf)
             return -1;
     }
@@ -1888,15 +1893,22 @@ lsquic_stream_writef (lsquic_stream_t *stream, struct lsquic_reader *reader)
 }
 
 
-int
-lsquic_stream_send_headers (lsquic_stream_t *stream,
+/* If `tmpl' is not NULL, `headers' are the varying headers */
+static int
+send_headers (lsquic_stream_t *stream, struct lsquic_hdr_tmpl *tmpl,
                             const lsquic_http_headers_t *headers, int eos)
 {
     if ((stream->stream_flags & (STREAM_USE_HEADERS|STREAM_HEADERS_SENT|
                                                      STREAM_U_WRITE_DONE))
                 == STREAM_USE_HEADERS)
     {
-        int s = lsquic_headers_stream_send_headers(stream->conn_pub->hs,
+        int s;
+        if (tmpl)
+            s = lsquic_headers_stream_send_headers_tmpl(stream->conn_pub->hs,
+                    stream->id, tmpl, headers, eos,
+                    lsquic_stream_priority(stream));
+        else
+            s = lsquic_headers_stream_send_headers(stream->conn_pub->hs,
                     stream->id, headers, eos, lsquic_stream_priority(stream));
         if (0 == s)
         {
@@ -1919,6 +1931,23 @@ lsquic_stream_send_headers (lsquic_stream_t *stream,
 }
 
 
+int
+lsquic_stream_send_headers (lsquic_stream_t *stream,
+                            const lsquic_http_headers_t *headers, int eos)
+{
+    return send_headers(stream, NULL, headers, eos);
+}
+
+
+int
+lsquic_stream_send_headers_tmpl (lsquic_stream_t *stream,
+                            struct lsquic_hdr_tmpl *tmpl,
+                            const lsquic_http_headers_t *headers, int eos)
+{
+    return send_headers(stream, tmpl, headers, eos);
+}
+
+
 void
 lsquic_stream_window_update (lsquic_stream_t *stream, uint64_t offset)
 {
@@ -2192,7 +2221,7 @@ lsquic_stream_mem_used (const struct lsquic_stream *stream)
 {
     size_t size;
 
-    size = sizeof(stream);
+    size = sizeof(*stream);
     if (stream->sm_buf)
         size += SM_BUF_SIZE;
     if (stream->data_in)
@@ -2202,6 +2231,17 @@ lsquic_stream_mem_used (const struct lsquic_stream *stream)
 }
 
 
+void
+lsquic_stream_compact (struct lsquic_stream *stream)
+{
+    if (stream->sm_buf && 0 == stream->sm_n_buffered)
+    {
+        lsquic_mm_put_1370(stream->conn_pub->mm, stream->sm_buf);
+        stream->sm_buf = NULL;
+    }
+}
+
+
 lsquic_cid_t
 lsquic_stream_cid (const struct lsquic_stream *stream)
 {
@@ -16,7 +16,7 @@ struct uncompressed_headers;
 TAILQ_HEAD(lsquic_streams_tailq, lsquic_stream);
 
 #ifndef LSQUIC_KEEP_STREAM_HISTORY
-#   ifdef NDEBUG
+#   if defined(NDEBUG) || LSQUIC_COMPACT
 #       define LSQUIC_KEEP_STREAM_HISTORY 0
 #   else
 #       define LSQUIC_KEEP_STREAM_HISTORY 1
@@ -283,6 +283,10 @@ struct stream_read_prog_status
 size_t
 lsquic_stream_mem_used (const struct lsquic_stream *);
 
+/* Free write buffer if it is empty.  It is allocated again when needed. */
+void
+lsquic_stream_compact (struct lsquic_stream *);
+
 lsquic_cid_t
 lsquic_stream_cid (const struct lsquic_stream *);
 
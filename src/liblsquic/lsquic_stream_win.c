@@ -0,0 +1,181 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_stream_win.c -- Sliding window of streams indexed by stream ID.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lsquic_stream_win.h"
+
+#define SLOT(win, off) (win)->sw_slots[ ((win)->sw_head + (off))            \
+                                                & ((win)->sw_n_slots - 1) ]
+
+
+void
+lsquic_stream_win_init (struct lsquic_stream_win *win)
+{
+    memset(win, 0, sizeof(*win));
+}
+
+
+void
+lsquic_stream_win_cleanup (struct lsquic_stream_win *win)
+{
+    free(win->sw_slots);
+    memset(win, 0, sizeof(*win));
+}
+
+
+/* Grow the window so that it has at least `n_needed' slots.  The ring is
+ * unwrapped: logical slot 0 becomes physical slot 0.
+ */
+static int
+grow (struct lsquic_stream_win *win, unsigned n_needed)
+{
+    struct lsquic_stream **slots;
+    unsigned n_slots, off;
+
+    n_slots = win->sw_n_slots ? win->sw_n_slots : SW_MIN_SLOTS;
+    while (n_slots < n_needed)
+        n_slots <<= 1;
+    if (n_slots > SW_MAX_SLOTS)
+        return -1;
+
+    slots = calloc(n_slots, sizeof(slots[0]));
+    if (!slots)
+        return -1;
+
+    for (off = 0; off < win->sw_n_slots; ++off)
+        slots[off] = SLOT(win, off);
+    free(win->sw_slots);
+    win->sw_slots = slots;
+    win->sw_n_slots = n_slots;
+    win->sw_head = 0;
+    return 0;
+}
+
+
+/* Move the base of the window down to `stream_id' if the slots at the top
+ * of the window are free.
+ */
+static int
+slide_down (struct lsquic_stream_win *win, uint32_t stream_id)
+{
+    unsigned delta, off;
+
+    delta = (win->sw_base - stream_id) >> 1;
+    if (delta >= win->sw_n_slots)
+        return -1;
+
+    for (off = win->sw_n_slots - delta; off < win->sw_n_slots; ++off)
+        if (SLOT(win, off))
+            return -1;
+
+    win->sw_head = (win->sw_head - delta) & (win->sw_n_slots - 1);
+    win->sw_base = stream_id;
+    return 0;
+}
+
+
+/* Move the base of the window up to `stream_id', dropping the streams
+ * below it, and then on to the first stream that is still in the window.
+ */
+static void
+slide_up (struct lsquic_stream_win *win, uint32_t stream_id)
+{
+    unsigned delta, off;
+
+    delta = (stream_id - win->sw_base) >> 1;
+    if (delta >= win->sw_n_slots)
+    {
+        memset(win->sw_slots, 0, win->sw_n_slots * sizeof(win->sw_slots[0]));
+        win->sw_count = 0;
+        return;
+    }
+
+    for (off = 0; off < delta; ++off)
+        if (SLOT(win, off))
+        {
+            SLOT(win, off) = NULL;
+            --win->sw_count;
+        }
+    win->sw_head = (win->sw_head + delta) & (win->sw_n_slots - 1);
+    win->sw_base = stream_id;
+
+    if (win->sw_count > 0)
+        while (!SLOT(win, 0))
+        {
+            win->sw_head = (win->sw_head + 1) & (win->sw_n_slots - 1);
+            win->sw_base += 2;
+        }
+}
+
+
+int
+lsquic_stream_win_insert (struct lsquic_stream_win *win, uint32_t stream_id,
+                                                struct lsquic_stream *stream)
+{
+    unsigned off;
+
+    /* A long-lived stream at the bottom of the window must not keep the
+     * window from sliding: when the new stream is beyond the largest
+     * window, the streams at the bottom are dropped.
+     */
+    if (win->sw_count > 0 && stream_id > win->sw_base
+                && ((stream_id - win->sw_base) >> 1) >= SW_MAX_SLOTS)
+        slide_up(win, stream_id - 2 * (SW_MAX_SLOTS - 1));
+
+    if (win->sw_count == 0)
+    {
+        win->sw_base = stream_id;
+        win->sw_head = 0;
+    }
+    else if (stream_id < win->sw_base)
+    {
+        assert(0 == ((win->sw_base - stream_id) & 1));
+        if (0 != slide_down(win, stream_id))
+            return -1;
+    }
+
+    assert(0 == ((stream_id - win->sw_base) & 1));
+    off = (stream_id - win->sw_base) >> 1;
+    if (off >= win->sw_n_slots && 0 != grow(win, off + 1))
+        return -1;
+
+    assert(!SLOT(win, off));
+    SLOT(win, off) = stream;
+    ++win->sw_count;
+    return 0;
+}
+
+
+void
+lsquic_stream_win_remove (struct lsquic_stream_win *win, uint32_t stream_id,
+                                            const struct lsquic_stream *stream)
+{
+    unsigned off;
+
+    off = (uint32_t) (stream_id - win->sw_base) >> 1;
+    if (off >= win->sw_n_slots || SLOT(win, off) != stream)
+        return;
+
+    SLOT(win, off) = NULL;
+    --win->sw_count;
+
+    /* Slide the window forward, so that logical slot 0 is always in use */
+    if (off == 0 && win->sw_count > 0)
+        while (!SLOT(win, 0))
+        {
+            win->sw_head = (win->sw_head + 1) & (win->sw_n_slots - 1);
+            win->sw_base += 2;
+        }
+}
+
+
+size_t
+lsquic_stream_win_mem_used (const struct lsquic_stream_win *win)
+{
+    return sizeof(*win) + win->sw_n_slots * sizeof(win->sw_slots[0]);
+}
@@ -0,0 +1,73 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lsquic_stream_win.h -- Sliding window of streams indexed by stream ID.
+ *
+ * Stream IDs of one parity (client- or server-initiated) are allocated
+ * sequentially, so live streams tend to occupy a narrow range of IDs.
+ * The window is a ring buffer of stream pointers: stream with ID `id' is
+ * kept in logical slot (id - base) / 2.  Looking up a stream is a bounds
+ * check and an index.
+ *
+ * The base of the window slides forward as streams at the bottom of the
+ * window are removed.  The window grows up to SW_MAX_SLOTS slots.  When a
+ * new stream is beyond that, the streams at the bottom of the window are
+ * dropped from it to make room.  The caller should keep all streams
+ * elsewhere as well: a stream may be dropped from the window or not fit
+ * into it in the first place.
+ */
+
+#ifndef LSQUIC_STREAM_WIN_H
+#define LSQUIC_STREAM_WIN_H 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct lsquic_stream;
+
+#define SW_MIN_SLOTS 16
+#define SW_MAX_SLOTS 1024
+
+struct lsquic_stream_win
+{
+    struct lsquic_stream  **sw_slots;
+    uint32_t                sw_base;    /* Stream ID in logical slot 0 */
+    unsigned                sw_head,    /* Physical index of logical slot 0 */
+                            sw_n_slots, /* Zero or power of two */
+                            sw_count;   /* Number of streams in the window */
+};
+
+void
+lsquic_stream_win_init (struct lsquic_stream_win *);
+
+void
+lsquic_stream_win_cleanup (struct lsquic_stream_win *);
+
+/* Returns 0 if the stream was inserted and -1 if it does not fit into the
+ * window -- it is too far below the base -- or memory allocation failed.
+ * Inserting a stream may drop streams at the bottom of the window.  All
+ * stream IDs inserted into the same window must have the same parity.
+ */
+int
+lsquic_stream_win_insert (struct lsquic_stream_win *, uint32_t stream_id,
+                                                struct lsquic_stream *);
+
+/* It is OK to call this function for a stream that is not in the window */
+void
+lsquic_stream_win_remove (struct lsquic_stream_win *, uint32_t stream_id,
+                                                const struct lsquic_stream *);
+
+/* Evaluates to the stream or NULL if stream is not in the window */
+#define lsquic_stream_win_find(win, stream_id) (                        \
+    (((uint32_t) ((stream_id) - (win)->sw_base)) >> 1) < (win)->sw_n_slots \
+    ? (win)->sw_slots[ ((win)->sw_head                                  \
+                + (((uint32_t) ((stream_id) - (win)->sw_base)) >> 1))   \
+                                            & ((win)->sw_n_slots - 1) ] \
+    : NULL                                                              \
+)
+
+#define lsquic_stream_win_count(win) (+(win)->sw_count)
+
+size_t
+lsquic_stream_win_mem_used (const struct lsquic_stream_win *);
+
+#endif
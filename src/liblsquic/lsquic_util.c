@@ -18,6 +18,13 @@
 #if !(defined(_POSIX_TIMERS) && _POSIX_TIMERS > 0) && defined(__APPLE__)
 #include <mach/mach_time.h>
 #endif
+#if LSQUIC_CONN_STATS
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
 
 #include "lsquic_int_types.h"
 #include "lsquic_util.h"
@@ -42,9 +49,29 @@ lsquic_init_timers (void)
 }
 
 
+#ifndef NDEBUG
+static lsquic_time_t (*s_clock) (void *);
+static void *s_clock_ctx;
+
+
+void
+lsquic_time_set_clock (lsquic_time_t (*clock) (void *), void *clock_ctx)
+{
+    s_clock = clock;
+    s_clock_ctx = clock_ctx;
+}
+
+
+#endif
+
+
 lsquic_time_t
 lsquic_time_now (void)
 {
+#ifndef NDEBUG
+    if (s_clock)
+        return s_clock(s_clock_ctx);
+#endif
 #if defined(_POSIX_TIMERS) && _POSIX_TIMERS > 0
     struct timespec ts;
     (void) clock_gettime(CLOCK_MONOTONIC, &ts);
@@ -72,6 +99,24 @@ lsquic_time_now (void)
 }
 
 
+#if LSQUIC_CONN_STATS
+uint64_t
+lsquic_cycles (void)
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) \
+                                                    || defined(_M_IX86)
+    return __rdtsc();
+#elif defined(_POSIX_TIMERS) && _POSIX_TIMERS > 0
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+    return lsquic_time_now() * 1000;
+#endif
+}
+#endif
+
+
 int
 lsquic_is_zero (const void *pbuf, size_t bufsz)
 {
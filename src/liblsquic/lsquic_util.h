@@ -13,9 +13,27 @@ extern "C" {
 lsquic_time_t
 lsquic_time_now (void);
 
+#ifndef NDEBUG
+/* Make lsquic_time_now() return what `clock' returns.  This is used by tests
+ * that run on virtual time.  Passing NULL restores the system clock.  Not
+ * thread-safe; not available in release builds.
+ */
+void
+lsquic_time_set_clock (lsquic_time_t (*clock) (void *), void *clock_ctx);
+#endif
+
 void
 lsquic_init_timers (void);
 
+#if LSQUIC_CONN_STATS
+/* Counter for timing operations that take less than the microsecond
+ * resolution of lsquic_time_now(), such as decrypting a packet.  Counts
+ * CPU cycles where there is a cycle counter and nanoseconds otherwise.
+ */
+uint64_t
+lsquic_cycles (void);
+#endif
+
 /* Returns 1 if `buf' contains only zero bytes, 0 otherwise.
  */
 int
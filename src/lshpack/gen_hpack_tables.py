@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+#
+# Generate lookup tables used by lshpack.c.
+#
+# Usage: gen_hpack_tables.py huff-dec|huff-enc|static [path/to/lshpack.c]
+#
+# The Huffman code is read from encode_table[] and the static table from
+# static_table[] in lshpack.c.  The output is C code that is pasted into
+# lshpack.c in place of the existing tables.
+
+import os
+import re
+import sys
+
+HDEC_PEEK_BITS = 12
+
+
+def read_encode_table(path):
+    src = open(path).read()
+    body = src[src.index('encode_table[257]'):]
+    body = body[:body.index('};')]
+    codes = [(int(code, 16), int(bits))
+             for code, bits in re.findall(r'\{\s*(0x[0-9a-f]+),\s*(\d+)\}',
+                                          body)]
+    assert len(codes) == 257
+    return codes
+
+
+def check_canonical(codes):
+    """Codes must be assigned in order of length, then symbol value"""
+    order = sorted(range(257), key=lambda sym: (codes[sym][1], sym))
+    code = 0
+    prev_len = codes[order[0]][1]
+    for sym in order:
+        length = codes[sym][1]
+        code <<= length - prev_len
+        prev_len = length
+        assert codes[sym][0] == code, 'code is not canonical'
+        code += 1
+    return order
+
+
+def decode_prefix(codes, value, n_bits):
+    """Return (symbol, length) of the code at the top of `value', which is
+    `n_bits' long, or None if the code is longer than `n_bits'.
+    """
+    for sym, (code, length) in enumerate(codes):
+        if length <= n_bits and value >> (n_bits - length) == code:
+            return sym, length
+    return None
+
+
+def gen_huff_dec(codes):
+    order = check_canonical(codes)
+
+    print('/* Generated by gen_hpack_tables.py: entry N describes the')
+    print(' * codes at the top of %d-bit value N.  Zero len1 means that the'
+          % HDEC_PEEK_BITS)
+    print(' * first code is longer than %d bits; zero len2 means that there'
+          % HDEC_PEEK_BITS)
+    print(' * is no second code.')
+    print(' */')
+    print('static const struct hdec_el hdec_table[1 << HDEC_PEEK_BITS] =')
+    print('{')
+    entries = []
+    for value in range(1 << HDEC_PEEK_BITS):
+        first = decode_prefix(codes, value, HDEC_PEEK_BITS)
+        if first is None or first[0] == 256:
+            entries.append((0, 0, 0, 0))
+            continue
+        sym1, len1 = first
+        rest_bits = HDEC_PEEK_BITS - len1
+        rest = value & ((1 << rest_bits) - 1)
+        second = decode_prefix(codes, rest, rest_bits)
+        if second is None or second[0] == 256:
+            entries.append((len1, 0, sym1, 0))
+        else:
+            entries.append((len1, second[1], sym1, second[0]))
+    for n in range(0, len(entries), 4):
+        print('    ' + ' '.join('{%2u,%2u,%3u,%3u},' % e
+                                 for e in entries[n:n + 4]))
+    print('};')
+    print('')
+
+    # Canonical decoding of codes longer than HDEC_PEEK_BITS bits:
+    max_len = max(length for _, length in codes)
+    first_code = []
+    first_idx = []
+    code = 0
+    idx = 0
+    for length in range(max_len + 2):
+        syms = [sym for sym in order if codes[sym][1] == length]
+        first_code.append(code)
+        first_idx.append(idx)
+        code = (code + len(syms)) << 1
+        idx += len(syms)
+    print('/* Canonical decoding of long codes: the first code of each length')
+    print(' * and the index of its symbol in hdec_syms[].  Codes of length L')
+    print(' * are smaller than hdec_first_code[L + 1] / 2.')
+    print(' */')
+    print('static const uint32_t hdec_first_code[%u] =' % (max_len + 2))
+    print('{')
+    for n in range(0, max_len + 2, 4):
+        print('    ' + ' '.join('0x%08x,' % c
+                                 for c in first_code[n:n + 4]))
+    print('};')
+    print('')
+    print('static const uint16_t hdec_first_idx[%u] =' % (max_len + 1))
+    print('{')
+    first_idx = first_idx[:max_len + 1]
+    for n in range(0, max_len + 1, 8):
+        print('    ' + ' '.join('%3u,' % i for i in first_idx[n:n + 8]))
+    print('};')
+    print('')
+    print('/* Symbols in order of code length, then value */')
+    print('static const uint16_t hdec_syms[257] =')
+    print('{')
+    for n in range(0, 257, 8):
+        print('    ' + ' '.join('%3u,' % s for s in order[n:n + 8]))
+    print('};')
+
+
+def gen_huff_enc(codes):
+    print('/* Generated by gen_hpack_tables.py: length of Huffman code')
+    print(' * of each octet in bits.')
+    print(' */')
+    print('static const uint8_t henc_code_len[256] =')
+    print('{')
+    for n in range(0, 256, 16):
+        print('    ' + ' '.join('%2u,' % length
+                                 for _, length in codes[n:n + 16]))
+    print('};')
+
+
+def read_static_table(path):
+    src = open(path).read()
+    body = src[src.index('static_table[HPACK_STATIC_TABLE_SIZE]'):]
+    body = body[:body.index('};')]
+    entries = re.findall(r'NAME_VAL\("([^"]*)",\s*"([^"]*)"\)', body)
+    assert len(entries) == 61
+    return [(name.encode(), val.encode()) for name, val in entries]
+
+
+# This function must match hstatic_hash() in lshpack.c
+
+def hstatic_hash(seed, s):
+    n = len(s)
+    x = n | s[0] << 8 | s[n // 2] << 16 | s[n - 1] << 24
+    return ((x ^ seed) * 0x9E3779B1) & 0xFFFFFFFF
+
+
+HSTATIC_SLOT_BITS = 8
+
+
+def find_seed(names):
+    """Find seed that maps names to distinct slots."""
+    for seed in range(1, 1 << 20):
+        slots = [hstatic_hash(seed, name) >> (32 - HSTATIC_SLOT_BITS)
+                 for name in names]
+        if len(set(slots)) == len(slots):
+            return seed, slots
+    raise Exception('cannot find seed')
+
+
+def print_array(ctype, name, size, values, per_line):
+    print('static const %s %s[%s] =' % (ctype, name, size))
+    print('{')
+    for n in range(0, len(values), per_line):
+        print('    ' + ' '.join('%2u,' % v for v in values[n:n + per_line]))
+    print('};')
+
+
+def gen_static(entries):
+    # Entries with the same name are adjacent in the static table.  Each
+    # name maps to its first entry; values are compared within the run.
+    all_names = [name for name, _ in entries]
+    names = []
+    for name in all_names:
+        if name not in names:
+            names.append(name)
+    for name in names:
+        first = all_names.index(name)
+        count = all_names.count(name)
+        assert all_names[first:first + count] == [name] * count
+
+    seed, slots = find_seed(names)
+
+    name_idx = [0] * (1 << HSTATIC_SLOT_BITS)
+    for name, slot in zip(names, slots):
+        name_idx[slot] = 1 + all_names.index(name)
+    run_len = [all_names.count(name) if all_names.index(name) == n else 0
+               for n, name in enumerate(all_names)]
+
+    print('/* Generated by gen_hpack_tables.py: perfect hash of static table')
+    print(' * names.  The top HSTATIC_SLOT_BITS bits of the hash select a slot,')
+    print(' * which contains one-based index of the first static table entry')
+    print(' * with that name or zero.  hstatic_run_len[] is the number of')
+    print(' * entries that share the name, starting with that first entry.')
+    print(' */')
+    print('#define HSTATIC_SLOT_BITS %u' % HSTATIC_SLOT_BITS)
+    print('#define HSTATIC_SEED 0x%X' % seed)
+    print('#define HSTATIC_MIN_NAME_LEN %u' % min(len(name) for name in names))
+    print('#define HSTATIC_MAX_NAME_LEN %u' % max(len(name) for name in names))
+    print('')
+    print_array('uint8_t', 'hstatic_name_idx', '1 << HSTATIC_SLOT_BITS',
+                name_idx, 16)
+    print('')
+    print_array('uint8_t', 'hstatic_run_len', 'HPACK_STATIC_TABLE_SIZE',
+                run_len, 16)
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.stderr.write('usage: %s huff-dec|huff-enc|static [lshpack.c]\n'
+                         % sys.argv[0])
+        sys.exit(1)
+    path = sys.argv[2] if len(sys.argv) > 2 else \
+        os.path.join(os.path.dirname(os.path.abspath(__file__)), 'lshpack.c')
+    if sys.argv[1] == 'huff-dec':
+        gen_huff_dec(read_encode_table(path))
+    elif sys.argv[1] == 'huff-enc':
+        gen_huff_enc(read_encode_table(path))
+    elif sys.argv[1] == 'static':
+        gen_static(read_static_table(path))
+    else:
+        sys.stderr.write('unknown table: %s\n' % sys.argv[1])
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -124,8 +124,9 @@ enum lshpack_static_hdr_idx
 
 
 /**
- * Initialization routine allocates memory.  -1 is returned if memory
- * could not be allocated.  0 is returned on success.
+ * Initialize HPACK encoder.  Memory for the dynamic table is allocated
+ * when the first entry is added to it.  0 is returned on success, -1 on
+ * failure.
  */
 int
 lshpack_enc_init (struct lshpack_enc *);
@@ -179,6 +180,21 @@ lshpack_enc_encode (struct lshpack_enc *henc, unsigned char *dst,
 void
 lshpack_enc_set_max_capacity (struct lshpack_enc *, unsigned);
 
+/**
+ * Return number of bytes used by the encoder, including dynamic table.
+ */
+size_t
+lshpack_enc_mem_used (const struct lshpack_enc *);
+
+/**
+ * Return a value that changes whenever an entry is added to or evicted
+ * from the dynamic table.  As long as the value stays the same, the table
+ * contents are the same and a previously encoded header block that did
+ * not add any entries can be sent again as is.
+ */
+uint64_t
+lshpack_enc_table_gen (const struct lshpack_enc *);
+
 /**
  * Initialize HPACK decoder structure.
  */
@@ -191,6 +207,12 @@ lshpack_dec_init (struct lshpack_dec *);
 void
 lshpack_dec_cleanup (struct lshpack_dec *);
 
+/**
+ * Return number of bytes used by the decoder, including dynamic table.
+ */
+size_t
+lshpack_dec_mem_used (const struct lshpack_dec *);
+
 /*
  * Returns 0 on success, a negative value on failure.
  *
@@ -203,6 +225,32 @@ lshpack_dec_decode (struct lshpack_dec *dec,
     char *dst, char *const dst_end, lshpack_strlen_t *name_len,
     lshpack_strlen_t *val_len, uint32_t *name_idx);
 
+/*
+ * Same as lshpack_dec_decode(), except that name and value are not copied
+ * unless they are Huffman-encoded.  `name' and `value' are set to point
+ * into the static table, into a dynamic table entry, into the header
+ * block, or into `dst'.  Pointers into the dynamic table are valid until
+ * the next call to the decoder.
+ */
+int
+lshpack_dec_decode_ref (struct lshpack_dec *dec,
+    const unsigned char **src, const unsigned char *src_end,
+    char *dst, char *const dst_end, const char **name,
+    lshpack_strlen_t *name_len, const char **value,
+    lshpack_strlen_t *val_len, uint32_t *name_idx);
+
+/*
+ * Returns the number of bytes taken up by the next header field
+ * representation in the input buffer, including dynamic table size
+ * updates that precede it.  0 is returned if the buffer ends before the
+ * field does, -1 if the field cannot be decoded.  Only integer prefixes and
+ * string lengths are parsed; the decoder is not needed.  This lets the
+ * caller decode a header block one field at a time as it arrives.
+ */
+int
+lshpack_dec_field_len (const unsigned char *src,
+                                            const unsigned char *src_end);
+
 void
 lshpack_dec_set_max_capacity (struct lshpack_dec *, unsigned);
 
@@ -210,13 +258,17 @@ lshpack_dec_set_max_capacity (struct lshpack_dec *, unsigned);
  * These structures are not very complicated.
  */
 
-#include <sys/queue.h>
+/* Dynamic tables are rings of fixed-size entry descriptors.  Names and
+ * values are kept back to back in a circular buffer, in the order the
+ * entries were added, so that evicting the oldest entry frees the bytes
+ * at the start of the used region.  A name/value pair never wraps around
+ * the end of the buffer.  The descriptors, the buffer, and -- in the
+ * encoder -- the hash chain heads share a single allocation sized to the
+ * maximum table capacity.
+ */
 
 struct lshpack_enc_table_entry;
 
-STAILQ_HEAD(lshpack_enc_head, lshpack_enc_table_entry);
-struct lshpack_double_enc_head;
-
 struct lshpack_enc
 {
     unsigned            hpe_cur_capacity;
@@ -224,36 +276,41 @@ struct lshpack_enc
 
     /* Each new dynamic table entry gets the next number.  It is used to
      * calculate the entry's position in the decoder table without having
-     * to maintain an actual array.
+     * to maintain an actual array.  The entry with ID `id' is stored at
+     * index `id' modulo the size of the entry ring.
      */
     unsigned            hpe_next_id;
 
-    /* Dynamic table entries (struct enc_table_entry) live in two hash
-     * tables: name/value hash table and name hash table.  These tables
-     * are the same size.
-     */
     unsigned            hpe_nelem;
-    unsigned            hpe_nbits;
-    struct lshpack_enc_head
-                        hpe_all_entries;
-    struct lshpack_double_enc_head
-                       *hpe_buckets;
+    unsigned            hpe_nbits;      /* Log2 of ring and bucket count */
+    unsigned            hpe_buf_size;
+    unsigned            hpe_buf_off;    /* Where next entry's bytes go */
+    struct lshpack_enc_table_entry
+                       *hpe_entries;
+    /* Entries that hash to the same bucket are chained newest first by
+     * entry ID.  The chains are not unlinked on eviction: a walk stops at
+     * the first ID that is no longer in the table.
+     */
+    unsigned           *hpe_name_buckets;
+    unsigned           *hpe_nameval_buckets;
+    char               *hpe_buf;
 };
 
-struct lshpack_arr
-{
-    unsigned        nalloc,
-                    nelem,
-                    off;
-    uintptr_t      *els;
-};
+struct lshpack_dec_table_entry;
 
 struct lshpack_dec
 {
     unsigned           hpd_max_capacity;       /* Maximum set by caller */
     unsigned           hpd_cur_max_capacity;   /* Adjusted at runtime */
     unsigned           hpd_cur_capacity;
-    struct lshpack_arr hpd_dyn_table;
+    unsigned           hpd_first;              /* Index of oldest entry */
+    unsigned           hpd_nelem;
+    unsigned           hpd_nbits;              /* Log2 of ring size */
+    unsigned           hpd_buf_size;
+    unsigned           hpd_buf_off;            /* Where next entry goes */
+    struct lshpack_dec_table_entry
+                      *hpd_entries;
+    char              *hpd_buf;
 };
 
 unsigned
@@ -0,0 +1,665 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * conn_pool.c -- client connection pool
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <netinet/in.h>
+#include <sys/socket.h>
+#else
+#include <WinSock2.h>
+#include <ws2tcpip.h>
+#endif
+
+#include <lsquic.h>
+
+#include "../src/liblsquic/lsquic_logger.h"
+
+#include "conn_pool.h"
+
+/* Stop reconnecting to the origin after this many connections in a row
+ * failed to complete the handshake:
+ */
+#define MAX_CONN_FAILURES 3
+
+
+struct cpool_req
+{
+    TAILQ_ENTRY(cpool_req)          cr_next;
+    void                           *cr_ctx;
+};
+
+TAILQ_HEAD(cpool_reqs, cpool_req);
+
+
+struct cpool_conn
+{
+    TAILQ_ENTRY(cpool_conn)         cc_next;
+    struct cpool_origin            *cc_origin;
+    lsquic_conn_t                  *cc_conn;
+    /* Requests for which lsquic_conn_make_stream() has been called, but
+     * which have not been given a stream yet:
+     */
+    struct cpool_reqs               cc_reqs;
+    unsigned                        cc_n_waiting;
+    unsigned                        cc_n_active;    /* Open streams */
+    enum {
+        CC_DRAINING     = (1 << 0), /* No new requests */
+        CC_HSK_OK       = (1 << 1),
+    }                               cc_flags;
+};
+
+
+struct cpool_origin
+{
+    TAILQ_ENTRY(cpool_origin)       co_next;
+    TAILQ_HEAD(, cpool_conn)        co_conns;
+    /* Requests waiting for a connection: */
+    struct cpool_reqs               co_reqs;
+    struct conn_pool               *co_pool;
+    unsigned                        co_n_queued;
+    unsigned                        co_n_conns;     /* Not draining */
+    unsigned                        co_n_failures;  /* In a row */
+    union {
+        struct sockaddr         sa;
+        struct sockaddr_in      sin;
+        struct sockaddr_in6     sin6;
+    }                               co_peer;
+    char                            co_hostname[0];
+};
+
+
+static int
+sockaddr_eq (const struct sockaddr *a, const struct sockaddr *b)
+{
+    if (a->sa_family != b->sa_family)
+        return 0;
+    if (a->sa_family == AF_INET)
+        return ((struct sockaddr_in *) a)->sin_port
+                                    == ((struct sockaddr_in *) b)->sin_port
+            && 0 == memcmp(&((struct sockaddr_in *) a)->sin_addr,
+                           &((struct sockaddr_in *) b)->sin_addr,
+                           sizeof(((struct sockaddr_in *) a)->sin_addr));
+    else
+        return ((struct sockaddr_in6 *) a)->sin6_port
+                                    == ((struct sockaddr_in6 *) b)->sin6_port
+            && 0 == memcmp(&((struct sockaddr_in6 *) a)->sin6_addr,
+                           &((struct sockaddr_in6 *) b)->sin6_addr,
+                           sizeof(((struct sockaddr_in6 *) a)->sin6_addr));
+}
+
+
+void
+cpool_init (struct conn_pool *pool, const struct cpool_if *cpi, void *cpi_ctx,
+                                    unsigned max_conns, unsigned max_streams)
+{
+    memset(pool, 0, sizeof(*pool));
+    TAILQ_INIT(&pool->cp_origins);
+    pool->cp_if          = cpi;
+    pool->cp_if_ctx      = cpi_ctx;
+    pool->cp_max_conns   = max_conns ? max_conns : 1;
+    pool->cp_max_streams = max_streams;
+}
+
+
+static void
+free_reqs (struct cpool_reqs *reqs)
+{
+    struct cpool_req *req;
+
+    while ((req = TAILQ_FIRST(reqs)))
+    {
+        TAILQ_REMOVE(reqs, req, cr_next);
+        free(req);
+    }
+}
+
+
+void
+cpool_cleanup (struct conn_pool *pool)
+{
+    struct cpool_origin *origin;
+    struct cpool_conn *cconn;
+
+    while ((origin = TAILQ_FIRST(&pool->cp_origins)))
+    {
+        TAILQ_REMOVE(&pool->cp_origins, origin, co_next);
+        while ((cconn = TAILQ_FIRST(&origin->co_conns)))
+        {
+            TAILQ_REMOVE(&origin->co_conns, cconn, cc_next);
+            lsquic_conn_set_ctx(cconn->cc_conn, NULL);
+            free_reqs(&cconn->cc_reqs);
+            free(cconn);
+        }
+        free_reqs(&origin->co_reqs);
+        free(origin);
+    }
+}
+
+
+static struct cpool_origin *
+find_or_add_origin (struct conn_pool *pool, const char *hostname,
+                                            const struct sockaddr *peer_sa)
+{
+    struct cpool_origin *origin;
+    size_t len;
+
+    TAILQ_FOREACH(origin, &pool->cp_origins, co_next)
+        if (0 == strcmp(hostname, origin->co_hostname)
+                                && sockaddr_eq(peer_sa, &origin->co_peer.sa))
+            return origin;
+
+    len = strlen(hostname);
+    origin = calloc(1, sizeof(*origin) + len + 1);
+    if (!origin)
+        return NULL;
+    TAILQ_INIT(&origin->co_conns);
+    TAILQ_INIT(&origin->co_reqs);
+    origin->co_pool = pool;
+    memcpy(&origin->co_peer, peer_sa, peer_sa->sa_family == AF_INET ?
+                sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6));
+    memcpy(origin->co_hostname, hostname, len + 1);
+    TAILQ_INSERT_TAIL(&pool->cp_origins, origin, co_next);
+    LSQ_DEBUG("pool: new origin %s", hostname);
+    return origin;
+}
+
+
+static int
+cconn_usable (const struct cpool_conn *cconn)
+{
+    if (cconn->cc_flags & CC_DRAINING)
+        return 0;
+    switch (lsquic_conn_status(cconn->cc_conn, NULL, 0))
+    {
+    case LSCONN_ST_HSK_IN_PROGRESS:
+    case LSCONN_ST_CONNECTED:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+
+/* Return number of requests the connection can take right now */
+static unsigned
+cconn_capacity (const struct conn_pool *pool, const struct cpool_conn *cconn)
+{
+    unsigned in_use, avail, pending;
+
+    in_use = cconn->cc_n_active + cconn->cc_n_waiting;
+    if (pool->cp_max_streams && in_use >= pool->cp_max_streams)
+        return 0;
+
+    /* Streams whose creation is delayed are not counted by the library as
+     * used up:
+     */
+    avail = lsquic_conn_n_avail_streams(cconn->cc_conn);
+    pending = lsquic_conn_n_pending_streams(cconn->cc_conn);
+    if (avail <= pending)
+        return 0;
+    avail -= pending;
+
+    if (pool->cp_max_streams && pool->cp_max_streams - in_use < avail)
+        avail = pool->cp_max_streams - in_use;
+    return avail;
+}
+
+
+/* The least loaded usable connection that can take another request */
+static struct cpool_conn *
+pick_conn (const struct conn_pool *pool, const struct cpool_origin *origin)
+{
+    struct cpool_conn *cconn, *best;
+    unsigned load, best_load;
+
+    best = NULL;
+    best_load = UINT_MAX;
+    TAILQ_FOREACH(cconn, &origin->co_conns, cc_next)
+        if (cconn_usable(cconn) && cconn_capacity(pool, cconn) > 0)
+        {
+            load = cconn->cc_n_active + cconn->cc_n_waiting;
+            if (load < best_load)
+            {
+                best = cconn;
+                best_load = load;
+            }
+        }
+
+    return best;
+}
+
+
+static void
+fail_queued_reqs (struct conn_pool *pool, struct cpool_origin *origin)
+{
+    struct cpool_req *req;
+
+    while ((req = TAILQ_FIRST(&origin->co_reqs)))
+    {
+        TAILQ_REMOVE(&origin->co_reqs, req, cr_next);
+        --origin->co_n_queued;
+        ++pool->cp_stats.reqs_failed;
+        LSQ_NOTICE("pool: request to %s failed", origin->co_hostname);
+        pool->cp_if->cpi_on_req_failed(req->cr_ctx);
+        free(req);
+    }
+}
+
+
+static int
+open_conn (struct conn_pool *pool, struct cpool_origin *origin)
+{
+    int s;
+
+    assert(!pool->cp_connecting);
+    pool->cp_connecting = origin;
+    s = pool->cp_if->cpi_connect(pool->cp_if_ctx, origin->co_hostname,
+                                                        &origin->co_peer.sa);
+    pool->cp_connecting = NULL;
+    if (s != 0)
+        LSQ_WARN("pool: could not connect to %s", origin->co_hostname);
+    return s;
+}
+
+
+static void
+dispatch (struct conn_pool *pool, struct cpool_origin *origin)
+{
+    struct cpool_req *req;
+    struct cpool_conn *cconn;
+
+    while ((req = TAILQ_FIRST(&origin->co_reqs)))
+    {
+        cconn = pick_conn(pool, origin);
+        if (!cconn)
+        {
+            if (origin->co_n_failures >= MAX_CONN_FAILURES)
+            {
+                if (0 == origin->co_n_conns)
+                    fail_queued_reqs(pool, origin);
+                break;
+            }
+            if (origin->co_n_conns >= pool->cp_max_conns
+                                        || (pool->cp_flags & CP_RETIRING))
+                break;
+            if (pool->cp_in_callback)
+            {
+                if (!(pool->cp_flags & CP_SCHEDULED))
+                {
+                    pool->cp_flags |= CP_SCHEDULED;
+                    pool->cp_if->cpi_schedule(pool->cp_if_ctx);
+                }
+                break;
+            }
+            if (0 != open_conn(pool, origin))
+            {
+                ++origin->co_n_failures;
+                continue;
+            }
+            continue;   /* New connection is picked on next iteration */
+        }
+
+        TAILQ_REMOVE(&origin->co_reqs, req, cr_next);
+        --origin->co_n_queued;
+        TAILQ_INSERT_TAIL(&cconn->cc_reqs, req, cr_next);
+        ++cconn->cc_n_waiting;
+        pool->cp_making = cconn;
+        lsquic_conn_make_stream(cconn->cc_conn);
+        pool->cp_making = NULL;
+    }
+}
+
+
+int
+cpool_submit (struct conn_pool *pool, const char *hostname,
+                            const struct sockaddr *peer_sa, void *req_ctx)
+{
+    struct cpool_origin *origin;
+    struct cpool_req *req;
+
+    origin = find_or_add_origin(pool, hostname, peer_sa);
+    if (!origin)
+        return -1;
+
+    req = malloc(sizeof(*req));
+    if (!req)
+        return -1;
+    req->cr_ctx = req_ctx;
+    TAILQ_INSERT_TAIL(&origin->co_reqs, req, cr_next);
+    ++origin->co_n_queued;
+    ++pool->cp_stats.reqs_submitted;
+
+    dispatch(pool, origin);
+
+    if (origin->co_n_queued)
+    {
+        ++pool->cp_stats.reqs_queued;
+        if (origin->co_n_queued > pool->cp_stats.max_queue)
+            pool->cp_stats.max_queue = origin->co_n_queued;
+    }
+    return 0;
+}
+
+
+void
+cpool_process (struct conn_pool *pool)
+{
+    struct cpool_origin *origin;
+
+    assert(!pool->cp_in_callback);
+    pool->cp_flags &= ~CP_SCHEDULED;
+    TAILQ_FOREACH(origin, &pool->cp_origins, co_next)
+        if (!TAILQ_EMPTY(&origin->co_reqs))
+            dispatch(pool, origin);
+}
+
+
+/* Move requests that were not given a stream back to the origin queue,
+ * preserving their order.
+ */
+static void
+requeue_waiting (struct cpool_conn *cconn)
+{
+    struct cpool_origin *const origin = cconn->cc_origin;
+    struct cpool_req *req;
+
+    while ((req = TAILQ_LAST(&cconn->cc_reqs, cpool_reqs)))
+    {
+        TAILQ_REMOVE(&cconn->cc_reqs, req, cr_next);
+        TAILQ_INSERT_HEAD(&origin->co_reqs, req, cr_next);
+        ++origin->co_n_queued;
+    }
+    cconn->cc_n_waiting = 0;
+}
+
+
+static void
+start_draining (struct conn_pool *pool, struct cpool_conn *cconn)
+{
+    if (cconn->cc_flags & CC_DRAINING)
+        return;
+    cconn->cc_flags |= CC_DRAINING;
+    --cconn->cc_origin->co_n_conns;
+    ++pool->cp_stats.conns_retired;
+    LSQ_DEBUG("pool: retire connection %"PRIu64" to %s",
+                lsquic_conn_id(cconn->cc_conn), cconn->cc_origin->co_hostname);
+    if (cconn->cc_n_waiting)
+    {
+        (void) lsquic_conn_cancel_pending_streams(cconn->cc_conn,
+                                                        cconn->cc_n_waiting);
+        requeue_waiting(cconn);
+    }
+    if (0 == cconn->cc_n_active)
+        lsquic_conn_close(cconn->cc_conn);
+}
+
+
+void
+cpool_retire (struct conn_pool *pool)
+{
+    struct cpool_origin *origin;
+    struct cpool_conn *cconn, *next;
+
+    pool->cp_flags |= CP_RETIRING;
+    TAILQ_FOREACH(origin, &pool->cp_origins, co_next)
+        for (cconn = TAILQ_FIRST(&origin->co_conns); cconn; cconn = next)
+        {
+            next = TAILQ_NEXT(cconn, cc_next);
+            start_draining(pool, cconn);
+        }
+}
+
+
+static lsquic_conn_ctx_t *
+cpool_on_new_conn (void *stream_if_ctx, lsquic_conn_t *conn)
+{
+    struct conn_pool *const pool = stream_if_ctx;
+    struct cpool_origin *const origin = pool->cp_connecting;
+    struct cpool_conn *cconn;
+
+    assert(origin);     /* Only the pool opens connections */
+    cconn = calloc(1, sizeof(*cconn));
+    if (!cconn)
+    {
+        /* The connection is counted as failed, otherwise dispatch() would
+         * keep opening new ones.
+         */
+        LSQ_ERROR("pool: cannot allocate connection");
+        ++origin->co_n_failures;
+        ++pool->cp_stats.conns_failed;
+        lsquic_conn_close(conn);
+        return NULL;
+    }
+    cconn->cc_origin = origin;
+    cconn->cc_conn = conn;
+    TAILQ_INIT(&cconn->cc_reqs);
+    TAILQ_INSERT_TAIL(&origin->co_conns, cconn, cc_next);
+    ++origin->co_n_conns;
+    ++pool->cp_n_conns;
+    ++pool->cp_stats.conns_opened;
+    LSQ_DEBUG("pool: new connection %"PRIu64" to %s; origin has %u "
+        "connections", lsquic_conn_id(conn), origin->co_hostname,
+        origin->co_n_conns);
+    return (lsquic_conn_ctx_t *) cconn;
+}
+
+
+static void
+cpool_on_hsk_done (lsquic_conn_t *conn, int ok)
+{
+    struct cpool_conn *const cconn = (void *) lsquic_conn_get_ctx(conn);
+    struct conn_pool *pool;
+
+    if (!cconn)
+        return;
+    pool = cconn->cc_origin->co_pool;
+    if (ok)
+    {
+        cconn->cc_flags |= CC_HSK_OK;
+        cconn->cc_origin->co_n_failures = 0;
+    }
+    if (pool->cp_if->cpi_on_hsk_done)
+    {
+        ++pool->cp_in_callback;
+        pool->cp_if->cpi_on_hsk_done(conn, ok);
+        --pool->cp_in_callback;
+    }
+}
+
+
+static void
+cpool_on_goaway_received (lsquic_conn_t *conn)
+{
+    struct cpool_conn *const cconn = (void *) lsquic_conn_get_ctx(conn);
+    struct conn_pool *pool;
+
+    if (!cconn)
+        return;
+    pool = cconn->cc_origin->co_pool;
+    LSQ_DEBUG("pool: GOAWAY received on connection %"PRIu64,
+                                                    lsquic_conn_id(conn));
+    ++pool->cp_in_callback;
+    start_draining(pool, cconn);
+    dispatch(pool, cconn->cc_origin);
+    --pool->cp_in_callback;
+}
+
+
+static void
+cpool_on_conn_closed (lsquic_conn_t *conn)
+{
+    struct cpool_conn *const cconn = (void *) lsquic_conn_get_ctx(conn);
+    struct cpool_origin *origin;
+    struct conn_pool *pool;
+
+    if (!cconn)
+        return;
+    origin = cconn->cc_origin;
+    pool = origin->co_pool;
+    lsquic_conn_set_ctx(conn, NULL);
+
+    requeue_waiting(cconn);
+    if (!(cconn->cc_flags & CC_DRAINING))
+        --origin->co_n_conns;
+    if (!(cconn->cc_flags & CC_HSK_OK))
+    {
+        ++origin->co_n_failures;
+        ++pool->cp_stats.conns_failed;
+    }
+    TAILQ_REMOVE(&origin->co_conns, cconn, cc_next);
+    --pool->cp_n_conns;
+    free(cconn);
+    LSQ_DEBUG("pool: connection %"PRIu64" to %s closed; %u queued requests",
+        lsquic_conn_id(conn), origin->co_hostname, origin->co_n_queued);
+
+    ++pool->cp_in_callback;
+    dispatch(pool, origin);
+    if (pool->cp_if->cpi_on_conn_closed)
+        pool->cp_if->cpi_on_conn_closed(pool->cp_if_ctx, conn);
+    --pool->cp_in_callback;
+}
+
+
+static lsquic_stream_ctx_t *
+cpool_on_new_stream (void *stream_if_ctx, lsquic_stream_t *stream)
+{
+    struct conn_pool *const pool = stream_if_ctx;
+    struct cpool_conn *cconn;
+    struct cpool_req *req;
+    lsquic_stream_ctx_t *st_h;
+
+    if (stream && lsquic_stream_is_pushed(stream))
+    {
+        LSQ_INFO("pool: not accepting server push");
+        lsquic_stream_refuse_push(stream);
+        return NULL;
+    }
+
+    /* The library calls on_new_stream with NULL stream from inside
+     * lsquic_conn_make_stream() when connection is going away.
+     */
+    if (stream)
+        cconn = (void *) lsquic_conn_get_ctx(lsquic_stream_conn(stream));
+    else
+        cconn = pool->cp_making;
+    if (!cconn || !(req = TAILQ_FIRST(&cconn->cc_reqs)))
+    {
+        LSQ_WARN("pool: stream without request");
+        if (stream)
+        {
+            if (cconn)
+                ++cconn->cc_n_active;   /* Decremented in on_close */
+            lsquic_stream_close(stream);
+        }
+        return NULL;
+    }
+
+    TAILQ_REMOVE(&cconn->cc_reqs, req, cr_next);
+    --cconn->cc_n_waiting;
+    if (!stream)
+    {
+        TAILQ_INSERT_HEAD(&cconn->cc_origin->co_reqs, req, cr_next);
+        ++cconn->cc_origin->co_n_queued;
+        start_draining(pool, cconn);
+        return NULL;
+    }
+
+    ++cconn->cc_n_active;
+    ++pool->cp_in_callback;
+    st_h = pool->cp_if->cpi_on_new_stream(req->cr_ctx, stream);
+    --pool->cp_in_callback;
+    free(req);
+    return st_h;
+}
+
+
+static struct conn_pool *
+stream_pool (lsquic_stream_t *stream)
+{
+    struct cpool_conn *const cconn
+                = (void *) lsquic_conn_get_ctx(lsquic_stream_conn(stream));
+    return cconn->cc_origin->co_pool;
+}
+
+
+static void
+cpool_on_read (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
+{
+    struct conn_pool *const pool = stream_pool(stream);
+    ++pool->cp_in_callback;
+    pool->cp_if->cpi_on_read(stream, st_h);
+    --pool->cp_in_callback;
+}
+
+
+static void
+cpool_on_write (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
+{
+    struct conn_pool *const pool = stream_pool(stream);
+    ++pool->cp_in_callback;
+    pool->cp_if->cpi_on_write(stream, st_h);
+    --pool->cp_in_callback;
+}
+
+
+static void
+cpool_on_close (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
+{
+    struct cpool_conn *cconn;
+    struct conn_pool *pool;
+
+    if (lsquic_stream_is_pushed(stream))
+        return;
+
+    cconn = (void *) lsquic_conn_get_ctx(lsquic_stream_conn(stream));
+    if (!cconn)
+        return;
+    pool = cconn->cc_origin->co_pool;
+    ++pool->cp_in_callback;
+    /* The stream is active even if the user returned no context for it */
+    if (st_h)
+        pool->cp_if->cpi_on_close(stream, st_h);
+    assert(cconn->cc_n_active > 0);
+    --cconn->cc_n_active;
+    if (cconn->cc_flags & CC_DRAINING)
+    {
+        if (0 == cconn->cc_n_active)
+            lsquic_conn_close(cconn->cc_conn);
+    }
+    else
+        dispatch(pool, cconn->cc_origin);
+    --pool->cp_in_callback;
+}
+
+
+const struct lsquic_stream_if cpool_stream_if = {
+    .on_new_conn            = cpool_on_new_conn,
+    .on_goaway_received     = cpool_on_goaway_received,
+    .on_conn_closed         = cpool_on_conn_closed,
+    .on_new_stream          = cpool_on_new_stream,
+    .on_read                = cpool_on_read,
+    .on_write               = cpool_on_write,
+    .on_close               = cpool_on_close,
+    .on_hsk_done            = cpool_on_hsk_done,
+};
+
+
+void
+cpool_print_stats (const struct conn_pool *pool, FILE *out)
+{
+    fprintf(out, "connection pool: %lu connections opened, %lu retired, "
+        "%lu failed\n", pool->cp_stats.conns_opened,
+        pool->cp_stats.conns_retired, pool->cp_stats.conns_failed);
+    fprintf(out, "connection pool: %lu requests submitted, %lu queued, "
+        "%lu failed; max queue length: %u\n", pool->cp_stats.reqs_submitted,
+        pool->cp_stats.reqs_queued, pool->cp_stats.reqs_failed,
+        pool->cp_stats.max_queue);
+}
@@ -0,0 +1,130 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * conn_pool.h -- client connection pool
+ *
+ * The pool takes care of the connections so that the user code only deals
+ * with requests.  Requests are submitted to the pool together with the
+ * origin -- hostname and peer address -- they are to be sent to.  The pool
+ * spreads the requests among the connections to the origin, opens more
+ * connections when all streams are used up, queues the requests that cannot
+ * be sent yet, and retires the connections whose peer sent GOAWAY.
+ *
+ * To use the pool, register `cpool_stream_if' with the engine and pass the
+ * pool as the stream_if context.  The pool calls back into the user code
+ * via `struct cpool_if'.
+ */
+
+#ifndef CONN_POOL_H
+#define CONN_POOL_H 1
+
+#include <stdio.h>
+#include <sys/queue.h>
+
+#include "lsquic.h"
+
+struct sockaddr;
+struct cpool_origin;
+struct cpool_conn;
+
+struct cpool_if
+{
+    /* Open a new connection to the origin using lsquic_engine_connect().
+     * The pool never calls this function from inside engine callbacks.
+     * Return 0 on success and -1 on failure.
+     */
+    int
+    (*cpi_connect) (void *cpi_ctx, const char *hostname,
+                                            const struct sockaddr *peer_sa);
+
+    /* Some connections need to be opened, but the pool is inside an engine
+     * callback.  The user code is to call cpool_process() once control
+     * returns from the engine.
+     */
+    void
+    (*cpi_schedule) (void *cpi_ctx);
+
+    /* The request has been given a stream.  `req_ctx' is the pointer that
+     * was passed to cpool_submit().
+     */
+    lsquic_stream_ctx_t *
+    (*cpi_on_new_stream) (void *req_ctx, lsquic_stream_t *);
+
+    void (*cpi_on_read)     (lsquic_stream_t *, lsquic_stream_ctx_t *);
+    void (*cpi_on_write)    (lsquic_stream_t *, lsquic_stream_ctx_t *);
+    void (*cpi_on_close)    (lsquic_stream_t *, lsquic_stream_ctx_t *);
+
+    /* The request cannot be sent: connections to the origin keep failing. */
+    void
+    (*cpi_on_req_failed) (void *req_ctx);
+
+    /* Optional */
+    void
+    (*cpi_on_hsk_done) (lsquic_conn_t *, int ok);
+
+    /* Optional.  Called after the pool forgets about the connection. */
+    void
+    (*cpi_on_conn_closed) (void *cpi_ctx, lsquic_conn_t *);
+};
+
+struct conn_pool
+{
+    TAILQ_HEAD(, cpool_origin)      cp_origins;
+    const struct cpool_if          *cp_if;
+    void                           *cp_if_ctx;
+    /* Set while cpi_connect() is running, so that on_new_conn knows which
+     * origin the connection belongs to:
+     */
+    struct cpool_origin            *cp_connecting;
+    /* Set while lsquic_conn_make_stream() is running: */
+    struct cpool_conn              *cp_making;
+    unsigned                        cp_in_callback;
+    unsigned                        cp_max_conns;   /* Per origin */
+    unsigned                        cp_max_streams; /* Per connection; 0 means
+                                                     * as many as peer allows.
+                                                     */
+    unsigned                        cp_n_conns;
+    enum {
+        CP_SCHEDULED    = (1 << 0),     /* cpi_schedule() has been called */
+        CP_RETIRING     = (1 << 1),     /* cpool_retire() has been called */
+    }                               cp_flags;
+    struct {
+        unsigned long   conns_opened,
+                        conns_retired,  /* After GOAWAY or cpool_retire() */
+                        conns_failed,   /* Closed before handshake succeeded */
+                        reqs_submitted,
+                        reqs_queued,    /* Had to wait for a connection */
+                        reqs_failed;
+        unsigned        max_queue;
+    }                               cp_stats;
+};
+
+extern const struct lsquic_stream_if cpool_stream_if;
+
+void
+cpool_init (struct conn_pool *, const struct cpool_if *, void *cpi_ctx,
+                                unsigned max_conns, unsigned max_streams);
+
+void
+cpool_cleanup (struct conn_pool *);
+
+/* Returns 0 on success and -1 if memory could not be allocated. */
+int
+cpool_submit (struct conn_pool *, const char *hostname,
+                            const struct sockaddr *peer_sa, void *req_ctx);
+
+/* Open connections that could not be opened from inside engine callbacks.
+ * See cpi_schedule.
+ */
+void
+cpool_process (struct conn_pool *);
+
+/* Close connections as soon as they become idle and do not open new ones. */
+void
+cpool_retire (struct conn_pool *);
+
+#define cpool_n_conns(pool_) (+(pool_)->cp_n_conns)
+
+void
+cpool_print_stats (const struct conn_pool *, FILE *);
+
+#endif
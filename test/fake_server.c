@@ -0,0 +1,630 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * fake_server.c -- fake gQUIC server for client connection tests
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <netinet/in.h>
+#include <sys/socket.h>
+#else
+#include <Windows.h>
+#include <WinSock2.h>
+#include <ws2ipdef.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_int_types.h"
+#include "lsquic_types.h"
+#include "lsquic_packet_common.h"
+#include "lsquic_parse.h"
+#include "lsquic_str.h"
+#include "lsquic_handshake.h"
+#include "lsquic_qtags.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
+#include "lsquic_util.h"
+#include "fake_server.h"
+
+#ifdef NDEBUG
+#error fake_server.c needs the crypto session functions to be writable
+#endif
+
+
+#define GQUIC_CID_SZ 8
+
+/* The tag takes the place of the real AEAD tag, which is the same size */
+static const unsigned char s_tag[12] = {
+    'f', 'a', 'k', 'e', '-', 's', 'e', 'a', 'l', 'e', 'd', '!',
+};
+
+static const unsigned char s_chlo[] = { 'C', 'H', 'L', 'O', };
+static const unsigned char s_shlo[] = { 'S', 'H', 'L', 'O', };
+
+
+struct fsrv_session
+{
+    lsquic_cid_t                fss_cid;
+    enum {
+        FSS_HSK_DONE    = 1 << 0,
+        FSS_COMPACT     = 1 << 1,
+    }                           fss_flags;
+};
+
+
+struct fsrv_conn
+{
+    TAILQ_ENTRY(fsrv_conn)      fsc_next;
+    lsquic_cid_t                fsc_cid;
+    void                       *fsc_peer_ctx;
+    struct sockaddr_storage     fsc_client_sa,
+                                fsc_server_sa;
+    /* Packets received from the client */
+    struct lsquic_packno_range  fsc_recvd;
+    lsquic_time_t               fsc_largest_recvd_time;
+    unsigned                    fsc_n_packets_in;
+    lsquic_packno_t             fsc_next_packno;
+    enum {
+        FSC_SHLO_SENT   = 1 << 0,
+        FSC_ACK_DUE     = 1 << 1,
+    }                           fsc_flags;
+};
+
+
+struct fsrv
+{
+    TAILQ_HEAD(, fsrv_conn)     fs_conns;
+    struct lsquic_engine       *fs_engine;
+};
+
+
+/* Fake crypto session.  All of its functions are only called by the
+ * client connection.
+ */
+
+static lsquic_cid_t s_next_cid = 0x1122334455660000ULL;
+
+
+static lsquic_cid_t
+fss_generate_cid (void)
+{
+    return ++s_next_cid;
+}
+
+
+static lsquic_enc_session_t *
+fss_create_client (const char *domain, lsquic_cid_t cid,
+                                    const struct lsquic_engine_public *enpub)
+{
+    struct fsrv_session *fss;
+
+    fss = calloc(1, sizeof(*fss));
+    if (!fss)
+        return NULL;
+    fss->fss_cid = cid;
+    return (lsquic_enc_session_t *) fss;
+}
+
+
+static void
+fss_destroy (lsquic_enc_session_t *enc_session)
+{
+    free(enc_session);
+}
+
+
+static int
+fss_is_hsk_done (lsquic_enc_session_t *enc_session)
+{
+    const struct fsrv_session *const fss = (void *) enc_session;
+    return !!(fss->fss_flags & FSS_HSK_DONE);
+}
+
+
+static enum enc_level
+fss_encrypt (lsquic_enc_session_t *enc_session, enum lsquic_version version,
+             uint8_t path_id, uint64_t packno,
+             const unsigned char *header, size_t header_len,
+             const unsigned char *data, size_t data_len,
+             unsigned char *buf_out, size_t max_out_len, size_t *out_len,
+             int is_hello)
+{
+    const struct fsrv_session *const fss = (void *) enc_session;
+
+    if (header_len + data_len + sizeof(s_tag) > max_out_len)
+        return (enum enc_level) -1;
+
+    memcpy(buf_out, header, header_len);
+    memcpy(buf_out + header_len, data, data_len);
+    memcpy(buf_out + header_len + data_len, s_tag, sizeof(s_tag));
+    *out_len = header_len + data_len + sizeof(s_tag);
+    if (fss->fss_flags & FSS_HSK_DONE)
+        return ENC_LEV_FORW;
+    else
+        return ENC_LEV_CLEAR;
+}
+
+
+static enum enc_level
+fss_decrypt (lsquic_enc_session_t *enc_session, enum lsquic_version version,
+             uint8_t path_id, uint64_t packno, unsigned char *buf,
+             size_t *header_len, size_t data_len,
+             unsigned char *diversification_nonce,
+             unsigned char *buf_out, size_t max_out_len, size_t *out_len)
+{
+    const struct fsrv_session *const fss = (void *) enc_session;
+
+    if (data_len < sizeof(s_tag)
+            || 0 != memcmp(buf + *header_len + data_len - sizeof(s_tag),
+                                                    s_tag, sizeof(s_tag))
+            || *header_len + data_len - sizeof(s_tag) > max_out_len)
+        return (enum enc_level) -1;
+
+    memcpy(buf_out, buf, *header_len + data_len - sizeof(s_tag));
+    *out_len = data_len - sizeof(s_tag);
+    if (fss->fss_flags & FSS_HSK_DONE)
+        return ENC_LEV_FORW;
+    else
+        return ENC_LEV_CLEAR;
+}
+
+
+static int
+fss_get_peer_setting (const lsquic_enc_session_t *enc_session, uint32_t tag,
+                                                                uint32_t *val)
+{
+    switch (tag)
+    {
+    case QTAG_CFCW:
+        *val = FSRV_CFCW;
+        return 0;
+    case QTAG_SFCW:
+        *val = FSRV_SFCW;
+        return 0;
+    case QTAG_MIDS:
+        *val = FSRV_MIDS;
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+
+static int
+fss_get_peer_option (const lsquic_enc_session_t *enc_session, uint32_t tag)
+{
+    return 0;
+}
+
+
+static int
+fss_gen_chlo (lsquic_enc_session_t *enc_session, enum lsquic_version version,
+                                                    uint8_t *buf, size_t *len)
+{
+    if (*len < sizeof(s_chlo))
+        return -1;
+    memcpy(buf, s_chlo, sizeof(s_chlo));
+    *len = sizeof(s_chlo);
+    return 0;
+}
+
+
+static int
+fss_handle_chlo_reply (lsquic_enc_session_t *enc_session,
+                                                const uint8_t *data, int len)
+{
+    struct fsrv_session *const fss = (void *) enc_session;
+
+    if ((size_t) len < sizeof(s_shlo))
+        return DATA_NOT_ENOUGH;
+    if (0 != memcmp(data, s_shlo, sizeof(s_shlo)))
+        return DATA_FORMAT_ERROR;
+    fss->fss_flags |= FSS_HSK_DONE;
+    return DATA_NO_ERROR;
+}
+
+
+static size_t
+fss_mem_used (lsquic_enc_session_t *enc_session)
+{
+    const struct fsrv_session *const fss = (void *) enc_session;
+
+    if (fss->fss_flags & FSS_COMPACT)
+        return FSRV_HSK_MEM_COMPACT;
+    else
+        return FSRV_HSK_MEM_FULL;
+}
+
+
+static void
+fss_compact (lsquic_enc_session_t *enc_session)
+{
+    struct fsrv_session *const fss = (void *) enc_session;
+    fss->fss_flags |= FSS_COMPACT;
+}
+
+
+static int
+fss_verify_reset_token (lsquic_enc_session_t *enc_session,
+                                    const unsigned char *token, size_t sz)
+{
+    return -1;
+}
+
+
+static struct stack_st_X509 *
+fss_get_server_cert_chain (lsquic_enc_session_t *enc_session)
+{
+    return NULL;
+}
+
+
+void
+fsrv_install (void)
+{
+    struct enc_session_funcs *const esf = &lsquic_enc_session_gquic_1;
+
+    esf->esf_generate_cid          = fss_generate_cid;
+    esf->esf_create_client         = fss_create_client;
+    esf->esf_destroy               = fss_destroy;
+    esf->esf_is_hsk_done           = fss_is_hsk_done;
+    esf->esf_encrypt               = fss_encrypt;
+    esf->esf_decrypt               = fss_decrypt;
+    esf->esf_get_peer_setting      = fss_get_peer_setting;
+    esf->esf_get_peer_option       = fss_get_peer_option;
+    esf->esf_gen_chlo              = fss_gen_chlo;
+    esf->esf_handle_chlo_reply     = fss_handle_chlo_reply;
+    esf->esf_mem_used              = fss_mem_used;
+    esf->esf_compact               = fss_compact;
+    esf->esf_verify_reset_token    = fss_verify_reset_token;
+    esf->esf_get_server_cert_chain = fss_get_server_cert_chain;
+}
+
+
+/* The server */
+
+struct fsrv *
+fsrv_new (void)
+{
+    struct fsrv *srv;
+
+    srv = calloc(1, sizeof(*srv));
+    if (!srv)
+        return NULL;
+    TAILQ_INIT(&srv->fs_conns);
+    return srv;
+}
+
+
+void
+fsrv_set_engine (struct fsrv *srv, struct lsquic_engine *engine)
+{
+    srv->fs_engine = engine;
+}
+
+
+void
+fsrv_destroy (struct fsrv *srv)
+{
+    struct fsrv_conn *conn;
+
+    while ((conn = TAILQ_FIRST(&srv->fs_conns)))
+    {
+        TAILQ_REMOVE(&srv->fs_conns, conn, fsc_next);
+        free(conn);
+    }
+    free(srv);
+}
+
+
+static struct fsrv_conn *
+find_conn (const struct fsrv *srv, lsquic_cid_t cid)
+{
+    struct fsrv_conn *conn;
+
+    TAILQ_FOREACH(conn, &srv->fs_conns, fsc_next)
+        if (conn->fsc_cid == cid)
+            return conn;
+
+    return NULL;
+}
+
+
+static void
+copy_sa (struct sockaddr_storage *dst, const struct sockaddr *src)
+{
+    if (AF_INET == src->sa_family)
+        memcpy(dst, src, sizeof(struct sockaddr_in));
+    else
+        memcpy(dst, src, sizeof(struct sockaddr_in6));
+}
+
+
+/* Client packet header: flags, connection ID (client always sends it),
+ * optional version, and packet number.
+ */
+static int
+parse_client_packet (const unsigned char *buf, size_t sz, lsquic_cid_t *cid,
+                                                    lsquic_packno_t *packno)
+{
+    const unsigned char *p = buf, *const end = buf + sz;
+    unsigned char flags;
+    unsigned packno_len;
+
+    if (sz < 1 + GQUIC_CID_SZ)
+        return -1;
+
+    flags = *p++;
+    if (!(flags & 0x08))
+        return -1;
+    memcpy(cid, p, GQUIC_CID_SZ);
+    p += GQUIC_CID_SZ;
+    if (flags & 0x01)
+        p += 4;     /* Version */
+    packno_len = packno_bits2len((flags >> 4) & 3);
+    if (p + packno_len > end)
+        return -1;
+    for (*packno = 0; packno_len > 0; --packno_len)
+        *packno = (*packno << 8) | *p++;
+
+    return 0;
+}
+
+
+int
+fsrv_packets_out (void *ctx, const struct lsquic_out_spec *specs,
+                                                                unsigned count)
+{
+    struct fsrv *const srv = ctx;
+    struct fsrv_conn *conn;
+    lsquic_cid_t cid;
+    lsquic_packno_t packno;
+    unsigned n;
+
+    for (n = 0; n < count; ++n)
+    {
+        if (0 != parse_client_packet(specs[n].buf, specs[n].sz, &cid, &packno))
+            continue;
+        conn = find_conn(srv, cid);
+        if (!conn)
+        {
+            conn = calloc(1, sizeof(*conn));
+            if (!conn)
+                break;
+            conn->fsc_cid = cid;
+            conn->fsc_next_packno = 1;
+            conn->fsc_recvd.low = packno;
+            TAILQ_INSERT_TAIL(&srv->fs_conns, conn, fsc_next);
+        }
+        conn->fsc_peer_ctx = specs[n].peer_ctx;
+        copy_sa(&conn->fsc_client_sa, specs[n].local_sa);
+        copy_sa(&conn->fsc_server_sa, specs[n].dest_sa);
+        if (packno < conn->fsc_recvd.low)
+            conn->fsc_recvd.low = packno;
+        if (packno > conn->fsc_recvd.high)
+        {
+            conn->fsc_recvd.high = packno;
+            conn->fsc_largest_recvd_time = lsquic_time_now();
+        }
+        ++conn->fsc_n_packets_in;
+        conn->fsc_flags |= FSC_ACK_DUE;
+    }
+
+    return n > 0 ? (int) n : -1;
+}
+
+
+unsigned
+fsrv_n_packets_in (const struct fsrv *srv, lsquic_cid_t cid)
+{
+    const struct fsrv_conn *conn;
+
+    conn = find_conn(srv, cid);
+    if (conn)
+        return conn->fsc_n_packets_in;
+    else
+        return 0;
+}
+
+
+struct frame_src
+{
+    const unsigned char *fs_data;
+    size_t               fs_sz;
+    int                  fs_fin;
+};
+
+
+static size_t
+frame_src_read (void *ctx, void *buf, size_t len, int *fin)
+{
+    struct frame_src *const src = ctx;
+
+    if (len > src->fs_sz)
+        len = src->fs_sz;
+    memcpy(buf, src->fs_data, len);
+    src->fs_data += len;
+    src->fs_sz   -= len;
+    *fin = src->fs_fin && 0 == src->fs_sz;
+    return len;
+}
+
+
+int
+fsrv_gen_stream_frame (unsigned char *buf, size_t bufsz, uint32_t stream_id,
+            uint64_t offset, int fin, const void *data, size_t data_sz)
+{
+    struct frame_src src = { data, data_sz, fin, };
+    int len;
+
+    /* The generator only takes `fin' to mean an empty frame with FIN set;
+     * otherwise, FIN is set by the read function.
+     */
+    len = lsquic_parse_funcs_gquic_Q039.pf_gen_stream_frame(buf, bufsz,
+                    stream_id, offset, fin && 0 == data_sz, data_sz,
+                    frame_src_read, &src);
+    if (len < 0 || src.fs_sz > 0)
+        return -1;
+    return len;
+}
+
+
+int
+fsrv_gen_ping_frame (unsigned char *buf, size_t bufsz)
+{
+    return lsquic_parse_funcs_gquic_Q039.pf_gen_ping_frame(buf, (int) bufsz);
+}
+
+
+int
+fsrv_gen_goaway_frame (unsigned char *buf, size_t bufsz,
+                                            uint32_t last_good_stream_id)
+{
+    return lsquic_parse_funcs_gquic_Q039.pf_gen_goaway_frame(buf, bufsz, 0,
+                                            last_good_stream_id, NULL, 0);
+}
+
+
+struct ack_src
+{
+    const struct fsrv_conn  *as_conn;
+};
+
+
+static const struct lsquic_packno_range *
+ack_src_first (void *ctx)
+{
+    const struct ack_src *const src = ctx;
+    return &src->as_conn->fsc_recvd;
+}
+
+
+static const struct lsquic_packno_range *
+ack_src_next (void *ctx)
+{
+    return NULL;
+}
+
+
+static lsquic_time_t
+ack_src_largest_recv (void *ctx)
+{
+    const struct ack_src *const src = ctx;
+    return src->as_conn->fsc_largest_recvd_time;
+}
+
+
+int
+fsrv_gen_ack_frame (struct fsrv *srv, lsquic_cid_t cid, unsigned char *buf,
+                                                                size_t bufsz)
+{
+    struct fsrv_conn *conn;
+    struct ack_src src;
+    lsquic_packno_t largest;
+    int has_missing;
+
+    conn = find_conn(srv, cid);
+    if (!conn || 0 == conn->fsc_recvd.high)
+        return -1;
+
+    src.as_conn = conn;
+    return lsquic_parse_funcs_gquic_Q039.pf_gen_ack_frame(buf, bufsz,
+                ack_src_first, ack_src_next, ack_src_largest_recv, &src,
+                lsquic_time_now(), &has_missing, &largest);
+}
+
+
+int
+fsrv_gen_packet (struct fsrv *srv, lsquic_cid_t cid, lsquic_packno_t packno,
+                 const unsigned char *frames, size_t frames_sz,
+                 int decryptable, unsigned char *buf, size_t bufsz)
+{
+    struct fsrv_conn *conn;
+    unsigned char *p;
+    unsigned n;
+
+    conn = find_conn(srv, cid);
+    if (!conn)
+        return -1;
+    if (1 + GQUIC_CID_SZ + 4 + frames_sz + sizeof(s_tag) > bufsz)
+        return -1;
+
+    if (0 == packno)
+        packno = conn->fsc_next_packno;
+    if (packno >= conn->fsc_next_packno)
+        conn->fsc_next_packno = packno + 1;
+
+    p = buf;
+    *p++ = 0x08 | (PACKNO_LEN_4 << 4);
+    memcpy(p, &cid, GQUIC_CID_SZ);
+    p += GQUIC_CID_SZ;
+    for (n = 4; n > 0; --n)
+        *p++ = (unsigned char) (packno >> ((n - 1) * 8));
+    memcpy(p, frames, frames_sz);
+    p += frames_sz;
+    memcpy(p, s_tag, sizeof(s_tag));
+    if (!decryptable)
+        *p ^= 0xFF;
+    p += sizeof(s_tag);
+
+    return (int) (p - buf);
+}
+
+
+int
+fsrv_deliver (struct fsrv *srv, lsquic_cid_t cid, const unsigned char *buf,
+                                                                    size_t sz)
+{
+    const struct fsrv_conn *conn;
+
+    conn = find_conn(srv, cid);
+    if (!conn)
+        return -1;
+
+    return lsquic_engine_packet_in(srv->fs_engine, buf, sz,
+                (struct sockaddr *) &conn->fsc_client_sa,
+                (struct sockaddr *) &conn->fsc_server_sa, conn->fsc_peer_ctx);
+}
+
+
+unsigned
+fsrv_respond (struct fsrv *srv)
+{
+    struct fsrv_conn *conn;
+    unsigned char frames[0x100], packet[0x200];
+    int len, sz;
+    unsigned n_delivered;
+
+    n_delivered = 0;
+    TAILQ_FOREACH(conn, &srv->fs_conns, fsc_next)
+    {
+        if (!(conn->fsc_flags & FSC_ACK_DUE))
+            continue;
+        len = 0;
+        if (!(conn->fsc_flags & FSC_SHLO_SENT))
+        {
+            sz = fsrv_gen_stream_frame(frames, sizeof(frames),
+                    LSQUIC_STREAM_HANDSHAKE, 0, 0, s_shlo, sizeof(s_shlo));
+            assert(sz > 0);
+            len += sz;
+            conn->fsc_flags |= FSC_SHLO_SENT;
+        }
+        sz = fsrv_gen_ack_frame(srv, conn->fsc_cid, frames + len,
+                                                    sizeof(frames) - len);
+        assert(sz > 0);
+        len += sz;
+        conn->fsc_flags &= ~FSC_ACK_DUE;
+        sz = fsrv_gen_packet(srv, conn->fsc_cid, 0, frames, len, 1, packet,
+                                                            sizeof(packet));
+        assert(sz > 0);
+        if (fsrv_deliver(srv, conn->fsc_cid, packet, sz) >= 0)
+            ++n_delivered;
+    }
+
+    return n_delivered;
+}
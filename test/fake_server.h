@@ -0,0 +1,104 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * fake_server.h -- fake gQUIC server for client connection tests
+ *
+ * The real handshake needs a server with certificates.  Instead, the
+ * functions of the gQUIC crypto session -- which are not const in debug
+ * builds -- are replaced with ones that exchange fixed CHLO and SHLO
+ * messages and that "seal" packets by appending a fixed tag.  Call
+ * fsrv_install() before creating the engine.
+ *
+ * The server keeps track of the client connections it receives packets
+ * from.  fsrv_respond() sends SHLO to connections waiting for it and
+ * acknowledges everything the clients sent.  To test other things,
+ * packets with arbitrary frames can be built using fsrv_gen_packet() and
+ * delivered using fsrv_deliver() in any order.
+ *
+ * The engine is to use version Q039:
+ *
+ *      settings.es_versions          = 1 << LSQVER_039;
+ *      engine_api.ea_packets_out     = fsrv_packets_out;
+ *      engine_api.ea_packets_out_ctx = server;
+ *
+ * lsquic_int_types.h must be included before this file.
+ */
+
+#ifndef FAKE_SERVER_H
+#define FAKE_SERVER_H 1
+
+struct lsquic_engine;
+struct lsquic_out_spec;
+struct fsrv;
+
+/* Values the fake session reports as the server's settings */
+#define FSRV_CFCW (1536 * 1024)
+#define FSRV_SFCW (1024 * 1024)
+#define FSRV_MIDS 100
+
+/* Size of crypto state the fake session reports before and after
+ * it is compacted.
+ */
+#define FSRV_HSK_MEM_FULL    4096
+#define FSRV_HSK_MEM_COMPACT  256
+
+void
+fsrv_install (void);
+
+struct fsrv *
+fsrv_new (void);
+
+void
+fsrv_set_engine (struct fsrv *, struct lsquic_engine *);
+
+void
+fsrv_destroy (struct fsrv *);
+
+/* Can be used as `ea_packets_out' with the server as `ea_packets_out_ctx' */
+int
+fsrv_packets_out (void *srv, const struct lsquic_out_spec *specs,
+                                                            unsigned count);
+
+/* Send SHLO where due and ACK what has been received.  Returns number of
+ * packets delivered to the engine.
+ */
+unsigned
+fsrv_respond (struct fsrv *);
+
+/* Number of packets received from the client connection */
+unsigned
+fsrv_n_packets_in (const struct fsrv *, lsquic_cid_t);
+
+/* Frame generators.  They return the number of bytes written or -1 if
+ * the buffer is too small.
+ */
+int
+fsrv_gen_stream_frame (unsigned char *buf, size_t bufsz, uint32_t stream_id,
+            uint64_t offset, int fin, const void *data, size_t data_sz);
+
+int
+fsrv_gen_ping_frame (unsigned char *buf, size_t bufsz);
+
+int
+fsrv_gen_goaway_frame (unsigned char *buf, size_t bufsz,
+                                            uint32_t last_good_stream_id);
+
+/* ACK packets received from the client connection so far */
+int
+fsrv_gen_ack_frame (struct fsrv *, lsquic_cid_t, unsigned char *buf,
+                                                                size_t bufsz);
+
+/* Wrap frames into a server packet for the connection.  If `packno' is
+ * zero, next packet number is used.  If `decryptable' is false, the tag
+ * is corrupted.  Returns packet size or -1.
+ */
+int
+fsrv_gen_packet (struct fsrv *, lsquic_cid_t, lsquic_packno_t packno,
+                 const unsigned char *frames, size_t frames_sz,
+                 int decryptable, unsigned char *buf, size_t bufsz);
+
+/* Pass packet to the engine as if it came from the server */
+int
+fsrv_deliver (struct fsrv *, lsquic_cid_t, const unsigned char *buf,
+                                                                size_t sz);
+
+#endif
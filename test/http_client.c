@@ -43,6 +43,8 @@
 #include "lsquic.h"
 #include "test_common.h"
 #include "prog.h"
+#include "conn_pool.h"
+#include "lat_hist.h"
 
 #include "../src/liblsquic/lsquic_logger.h"
 #include "../src/liblsquic/lsquic_int_types.h"
@@ -82,6 +84,11 @@ static struct sample_stats  s_stat_to_conn,     /* Time to connect */
 static unsigned s_stat_conns_ok, s_stat_conns_failed;
 static unsigned long s_stat_downloaded_bytes;
 
+/* Per-request latency distributions, from the time the request was due:
+ * time to first byte and time until the whole response has been read.
+ */
+static struct lat_hist      s_hist_ttfb, s_hist_total;
+
 static void
 update_sample_stats (struct sample_stats *stats, unsigned long val)
 {
@@ -163,8 +170,24 @@ struct http_client_ctx {
     enum {
         HCC_SEEN_FIN            = (1 << 1),
         HCC_ABORT_ON_INCOMPLETE = (1 << 2),
+        HCC_USE_POOL            = (1 << 3),
     }                            hcc_flags;
     struct prog                 *prog;
+
+    /* Used in pool mode (-g).  The pool manages the connections and
+     * the requests are counted here.
+     */
+    struct conn_pool             hcc_pool;
+    struct event                *hcc_pool_ev;
+    unsigned                     hcc_n_reqs_done;
+
+    /* Load generator (-q): requests are submitted to the pool at a fixed
+     * rate, whether or not earlier requests have completed.
+     */
+    double                       hcc_rate;      /* Requests per second */
+    struct event                *hcc_rate_ev;
+    lsquic_time_t                hcc_rate_start;
+    unsigned                     hcc_n_reqs_submitted;
 };
 
 struct lsquic_conn_ctx {
@@ -540,6 +563,7 @@ http_client_on_read (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
     unsigned old_prio, new_prio;
     unsigned char buf[0x200];
     unsigned nreads = 0;
+    lsquic_time_t now;
 #ifdef WIN32
 	srand(GetTickCount());
 #endif
@@ -556,6 +580,7 @@ http_client_on_read (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
             }
             st_h->sh_ttfb = lsquic_time_now();
             update_sample_stats(&s_stat_ttfb, st_h->sh_ttfb - st_h->sh_created);
+            lhist_record(&s_hist_ttfb, st_h->sh_ttfb - st_h->sh_created);
             if (s_discard_response)
                 LSQ_DEBUG("discard response: do not dump headers");
             else
@@ -572,6 +597,7 @@ http_client_on_read (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
                 st_h->sh_ttfb = lsquic_time_now();
                 update_sample_stats(&s_stat_ttfb,
                                     st_h->sh_ttfb - st_h->sh_created);
+                lhist_record(&s_hist_ttfb, st_h->sh_ttfb - st_h->sh_created);
                 st_h->sh_flags |= PROCESSED_HEADERS;
             }
             if (!s_discard_response)
@@ -591,7 +617,9 @@ http_client_on_read (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
         }
         else if (0 == nread)
         {
-            update_sample_stats(&s_stat_req, lsquic_time_now() - st_h->sh_ttfb);
+            now = lsquic_time_now();
+            update_sample_stats(&s_stat_req, now - st_h->sh_ttfb);
+            lhist_record(&s_hist_total, now - st_h->sh_created);
             client_ctx->hcc_flags |= HCC_SEEN_FIN;
             lsquic_stream_shutdown(stream, 0);
             break;
@@ -612,6 +640,15 @@ http_client_on_read (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
 }
 
 
+static void
+destroy_stream_ctx (lsquic_stream_ctx_t *st_h)
+{
+    if (st_h->reader.lsqr_ctx)
+        destroy_lsquic_reader_ctx(st_h->reader.lsqr_ctx);
+    free(st_h);
+}
+
+
 static void
 http_client_on_close (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
 {
@@ -646,9 +683,7 @@ http_client_on_close (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
                 (client_ctx->hcc_cc_reqs_per_conn - conn_h->ch_n_cc_streams)));
         create_streams(client_ctx, conn_h);
     }
-    if (st_h->reader.lsqr_ctx)
-        destroy_lsquic_reader_ctx(st_h->reader.lsqr_ctx);
-    free(st_h);
+    destroy_stream_ctx(st_h);
 }
 
 
@@ -663,6 +698,256 @@ const struct lsquic_stream_if http_client_if = {
 };
 
 
+/* Pool mode: all -r requests are submitted to the connection pool at once.
+ * The pool spreads them over up to -n connections with up to -w requests
+ * in progress on each connection.
+ *
+ * In load generator mode (-q), the requests are submitted one by one at
+ * the given rate instead.  The latency of each request is measured from
+ * the time it was due, so that a server that falls behind is not hidden
+ * by requests waiting in the pool queue.
+ */
+
+struct pool_req
+{
+    struct http_client_ctx  *client_ctx;
+    lsquic_time_t            pr_due;
+};
+
+static int
+pool_connect (void *ctx, const char *hostname, const struct sockaddr *peer_sa)
+{
+    struct http_client_ctx *const client_ctx = ctx;
+    struct prog *const prog = client_ctx->prog;
+    struct service_port *sport;
+
+    sport = TAILQ_FIRST(prog->prog_sports);
+    if (NULL == lsquic_engine_connect(prog->prog_engine,
+                    (struct sockaddr *) &sport->sp_local_addr, peer_sa, sport,
+                    NULL, hostname, prog->prog_max_packet_size))
+        return -1;
+    return 0;
+}
+
+
+static void
+pool_process (evutil_socket_t sock, short events, void *ctx)
+{
+    struct http_client_ctx *const client_ctx = ctx;
+
+    cpool_process(&client_ctx->hcc_pool);
+    prog_process_conns(client_ctx->prog);
+}
+
+
+static void
+pool_schedule (void *ctx)
+{
+    struct http_client_ctx *const client_ctx = ctx;
+
+    if (0 != event_add(client_ctx->hcc_pool_ev, NULL))
+    {
+        LSQ_ERROR("cannot add pool event");
+        exit(1);
+    }
+    event_active(client_ctx->hcc_pool_ev, 0, 0);
+}
+
+
+static void
+pool_req_done (struct http_client_ctx *client_ctx)
+{
+    if (++client_ctx->hcc_n_reqs_done == client_ctx->hcc_total_n_reqs)
+    {
+        LSQ_INFO("all requests completed, retire connections");
+        cpool_retire(&client_ctx->hcc_pool);
+    }
+}
+
+
+static void
+pool_on_close (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
+{
+    struct http_client_ctx *const client_ctx = st_h->client_ctx;
+
+    LSQ_INFO("%s called", __func__);
+    destroy_stream_ctx(st_h);
+    pool_req_done(client_ctx);
+}
+
+
+static lsquic_stream_ctx_t *
+pool_on_new_stream (void *req_ctx, lsquic_stream_t *stream)
+{
+    struct pool_req *const req = req_ctx;
+    lsquic_stream_ctx_t *st_h;
+
+    st_h = http_client_on_new_stream(req->client_ctx, stream);
+    if (st_h && req->client_ctx->hcc_rate > 0)
+        st_h->sh_created = req->pr_due;
+    free(req);
+    return st_h;
+}
+
+
+static void
+pool_on_req_failed (void *req_ctx)
+{
+    struct pool_req *const req = req_ctx;
+    struct http_client_ctx *const client_ctx = req->client_ctx;
+
+    free(req);
+    pool_req_done(client_ctx);
+}
+
+
+static void
+pool_on_hsk_done (lsquic_conn_t *conn, int ok)
+{
+    LSQ_INFO("handshake %s", ok ? "completed successfully" : "failed");
+    if (ok)
+    {
+        if (s_display_cert_chain)
+            display_cert_chain(conn);
+        ++s_stat_conns_ok;
+    }
+    else
+        ++s_stat_conns_failed;
+}
+
+
+static void
+pool_on_conn_closed (void *ctx, lsquic_conn_t *conn)
+{
+    struct http_client_ctx *const client_ctx = ctx;
+
+    if (0 == cpool_n_conns(&client_ctx->hcc_pool)
+        && client_ctx->hcc_n_reqs_done == client_ctx->hcc_total_n_reqs)
+    {
+        LSQ_INFO("All connections are closed: stop engine");
+        prog_stop(client_ctx->prog);
+    }
+}
+
+
+static const struct cpool_if http_client_pool_if = {
+    .cpi_connect            = pool_connect,
+    .cpi_schedule           = pool_schedule,
+    .cpi_on_new_stream      = pool_on_new_stream,
+    .cpi_on_read            = http_client_on_read,
+    .cpi_on_write           = http_client_on_write,
+    .cpi_on_close           = pool_on_close,
+    .cpi_on_req_failed      = pool_on_req_failed,
+    .cpi_on_hsk_done        = pool_on_hsk_done,
+    .cpi_on_conn_closed     = pool_on_conn_closed,
+};
+
+
+static void
+pool_submit_one (struct http_client_ctx *client_ctx, lsquic_time_t due)
+{
+    struct prog *const prog = client_ctx->prog;
+    struct service_port *sport;
+    struct pool_req *req;
+    const char *hostname;
+
+    req = malloc(sizeof(*req));
+    if (!req)
+    {
+        LSQ_ERROR("cannot allocate request");
+        exit(EXIT_FAILURE);
+    }
+    req->client_ctx = client_ctx;
+    req->pr_due     = due;
+
+    sport = TAILQ_FIRST(prog->prog_sports);
+    hostname = prog->prog_hostname ? prog->prog_hostname : sport->host;
+    if (0 != cpool_submit(&client_ctx->hcc_pool, hostname,
+                                    (struct sockaddr *) &sport->sas, req))
+    {
+        LSQ_ERROR("cannot submit request");
+        exit(EXIT_FAILURE);
+    }
+    ++client_ctx->hcc_n_reqs_submitted;
+}
+
+
+/* Submit all requests that are due by now.  Request number N is due
+ * N / rate seconds after the start, no matter when the timer fires.
+ */
+static void
+pool_submit_due (evutil_socket_t sock, short events, void *ctx)
+{
+    struct http_client_ctx *const client_ctx = ctx;
+    lsquic_time_t now, due;
+
+    now = lsquic_time_now();
+    while (client_ctx->hcc_n_reqs_submitted < client_ctx->hcc_total_n_reqs)
+    {
+        due = client_ctx->hcc_rate_start + (lsquic_time_t)
+                    ((double) client_ctx->hcc_n_reqs_submitted * 1000000
+                                                    / client_ctx->hcc_rate);
+        if (due > now)
+            break;
+        pool_submit_one(client_ctx, due);
+    }
+
+    if (client_ctx->hcc_n_reqs_submitted == client_ctx->hcc_total_n_reqs)
+    {
+        LSQ_INFO("all %u requests have been submitted",
+                                            client_ctx->hcc_n_reqs_submitted);
+        event_del(client_ctx->hcc_rate_ev);
+    }
+
+    prog_process_conns(client_ctx->prog);
+}
+
+
+static void
+pool_submit_requests (struct http_client_ctx *client_ctx)
+{
+    struct prog *const prog = client_ctx->prog;
+    struct timeval tv;
+    lsquic_time_t interval;
+
+    client_ctx->hcc_pool_ev = event_new(prog_eb(prog), -1, 0, pool_process,
+                                                                client_ctx);
+    if (!client_ctx->hcc_pool_ev)
+    {
+        LSQ_ERROR("cannot allocate event");
+        exit(1);
+    }
+
+    if (client_ctx->hcc_rate > 0)
+    {
+        /* Timer granularity does not affect the measurements, as requests
+         * are timed from when they were due.  It only needs to be fine
+         * enough not to batch the requests up too much.
+         */
+        interval = (lsquic_time_t) (1000000 / client_ctx->hcc_rate);
+        if (interval < 1000)
+            interval = 1000;
+        tv.tv_sec  = interval / 1000000;
+        tv.tv_usec = interval % 1000000;
+        client_ctx->hcc_rate_ev = event_new(prog_eb(prog), -1, EV_PERSIST,
+                                                pool_submit_due, client_ctx);
+        if (!client_ctx->hcc_rate_ev
+                        || 0 != event_add(client_ctx->hcc_rate_ev, &tv))
+        {
+            LSQ_ERROR("cannot add rate event");
+            exit(1);
+        }
+        client_ctx->hcc_rate_start = lsquic_time_now();
+        pool_submit_due(-1, 0, client_ctx);
+        return;
+    }
+
+    while (client_ctx->hcc_n_reqs_submitted < client_ctx->hcc_total_n_reqs)
+        pool_submit_one(client_ctx, lsquic_time_now());
+    prog_process_conns(prog);
+}
+
+
 static void
 usage (const char *prog)
 {
@@ -680,6 +965,13 @@ usage (const char *prog)
 "                 connections will have fewer requests than this.\n"
 "   -w CONCUR   Number of concurrent requests per single connection.\n"
 "                 Defaults to 1.\n"
+"   -g          Pool mode: submit all requests to connection pool, which\n"
+"                 spreads them over up to CONNS connections, with up to\n"
+"                 CONCUR requests in progress on each.  -R is ignored.\n"
+"   -q RATE     Load generator: submit NREQS requests to connection pool\n"
+"                 at RATE requests per second, without waiting for the\n"
+"                 responses.  Implies -g.  Use -t to print latency\n"
+"                 percentiles and throughput.\n"
 "   -m METHOD   Method.  Defaults to GET.\n"
 "   -P PAYLOAD  Name of the file that contains payload to be used in the\n"
 "                 request.  This adds two more headers to the request:\n"
@@ -942,6 +1234,8 @@ main (int argc, char **argv)
     client_ctx.hcc_reqs_per_conn = 1;
     client_ctx.hcc_total_n_reqs = 1;
     client_ctx.prog = &prog;
+    lhist_init(&s_hist_ttfb);
+    lhist_init(&s_hist_total);
 #ifdef WIN32
     WSADATA wsd;
     WSAStartup(MAKEWORD(2, 2), &wsd);
@@ -949,7 +1243,7 @@ main (int argc, char **argv)
 
     prog_init(&prog, LSENG_HTTP, &sports, &http_client_if, &client_ctx);
 
-    while (-1 != (opt = getopt(argc, argv, PROG_OPTS "46Br:R:IKu:EP:M:n:w:H:p:h"
+    while (-1 != (opt = getopt(argc, argv, PROG_OPTS "46Bgq:r:R:IKu:EP:M:n:w:H:p:h"
 #ifndef WIN32
                                                                       "C:atT:"
 #endif
@@ -971,6 +1265,18 @@ main (int argc, char **argv)
         case 'I':
             client_ctx.hcc_flags |= HCC_ABORT_ON_INCOMPLETE;
             break;
+        case 'g':
+            client_ctx.hcc_flags |= HCC_USE_POOL;
+            break;
+        case 'q':
+            client_ctx.hcc_rate = atof(optarg);
+            if (!(client_ctx.hcc_rate > 0))
+            {
+                fprintf(stderr, "request rate must be positive\n");
+                exit(1);
+            }
+            client_ctx.hcc_flags |= HCC_USE_POOL;
+            break;
         case 'K':
             ++s_discard_response;
             break;
@@ -1063,6 +1369,14 @@ main (int argc, char **argv)
         exit(1);
     }
 
+    if (client_ctx.hcc_flags & HCC_USE_POOL)
+    {
+        cpool_init(&client_ctx.hcc_pool, &http_client_pool_if, &client_ctx,
+                client_ctx.hcc_concurrency, client_ctx.hcc_cc_reqs_per_conn);
+        prog.prog_api.ea_stream_if     = &cpool_stream_if;  /* Pokes into prog */
+        prog.prog_api.ea_stream_if_ctx = &client_ctx.hcc_pool;
+    }
+
     start_time = lsquic_time_now();
     if (0 != prog_prep(&prog))
     {
@@ -1070,7 +1384,10 @@ main (int argc, char **argv)
         exit(EXIT_FAILURE);
     }
 
-    create_connections(&client_ctx);
+    if (client_ctx.hcc_flags & HCC_USE_POOL)
+        pool_submit_requests(&client_ctx);
+    else
+        create_connections(&client_ctx);
 
     LSQ_DEBUG("entering event loop");
 
@@ -1088,9 +1405,24 @@ main (int argc, char **argv)
         fprintf(stats_fh, "%.2Lf reqs/sec; %.0Lf bytes/sec\n",
             (long double) s_stat_req.n / elapsed,
             (long double) s_stat_downloaded_bytes / elapsed);
+        if (client_ctx.hcc_rate > 0)
+            fprintf(stats_fh, "offered load: %.2f reqs/sec\n",
+                                                        client_ctx.hcc_rate);
+        lhist_print(&s_hist_ttfb, stats_fh, "time to 1st byte");
+        lhist_print(&s_hist_total, stats_fh, "total request time");
+        if (client_ctx.hcc_flags & HCC_USE_POOL)
+            cpool_print_stats(&client_ctx.hcc_pool, stats_fh);
     }
 
     prog_cleanup(&prog);
+    if (client_ctx.hcc_flags & HCC_USE_POOL)
+    {
+        if (client_ctx.hcc_pool_ev)
+            event_free(client_ctx.hcc_pool_ev);
+        if (client_ctx.hcc_rate_ev)
+            event_free(client_ctx.hcc_rate_ev);
+        cpool_cleanup(&client_ctx.hcc_pool);
+    }
     if (promise_fd >= 0)
         (void) close(promise_fd);
 
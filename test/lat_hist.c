@@ -0,0 +1,121 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lat_hist.c -- latency histogram
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "lat_hist.h"
+
+
+static unsigned
+msb (unsigned long long value)
+{
+    unsigned n;
+
+    for (n = 0; value >>= 1; ++n)
+        ;
+    return n;
+}
+
+
+static unsigned
+value2bucket (unsigned long long value)
+{
+    unsigned shift;
+
+    if (value < LH_N_SUB)
+        return value;
+
+    shift = msb(value) + 1 - LH_SUB_BITS;
+    return LH_N_SUB + (shift - 1) * (LH_N_SUB / 2)
+                                        + (value >> shift) - LH_N_SUB / 2;
+}
+
+
+/* Largest value that goes into this bucket */
+static unsigned long long
+bucket2value (unsigned bucket)
+{
+    unsigned shift, sub;
+
+    if (bucket < LH_N_SUB)
+        return bucket;
+
+    shift = 1 + (bucket - LH_N_SUB) / (LH_N_SUB / 2);
+    sub = LH_N_SUB / 2 + (bucket - LH_N_SUB) % (LH_N_SUB / 2);
+    return (((unsigned long long) sub + 1) << shift) - 1;
+}
+
+
+void
+lhist_init (struct lat_hist *hist)
+{
+    memset(hist, 0, sizeof(*hist));
+}
+
+
+void
+lhist_record (struct lat_hist *hist, unsigned long long value)
+{
+    if (value > LH_MAX_VALUE)
+        value = LH_MAX_VALUE;
+
+    ++hist->lh_counts[ value2bucket(value) ];
+    if (hist->lh_n)
+    {
+        if (value < hist->lh_min)
+            hist->lh_min = value;
+        if (value > hist->lh_max)
+            hist->lh_max = value;
+    }
+    else
+    {
+        hist->lh_min = value;
+        hist->lh_max = value;
+    }
+    ++hist->lh_n;
+}
+
+
+unsigned long long
+lhist_percentile (const struct lat_hist *hist, double pct)
+{
+    unsigned long long rank, count, value;
+    unsigned bucket;
+
+    if (0 == hist->lh_n)
+        return 0;
+
+    rank = (unsigned long long) (pct / 100 * hist->lh_n + 0.5);
+    if (rank < 1)
+        rank = 1;
+    if (rank > hist->lh_n)
+        rank = hist->lh_n;
+
+    count = 0;
+    for (bucket = 0; bucket < LH_N_BUCKETS; ++bucket)
+    {
+        count += hist->lh_counts[bucket];
+        if (count >= rank)
+        {
+            value = bucket2value(bucket);
+            return value < hist->lh_max ? value : hist->lh_max;
+        }
+    }
+
+    return hist->lh_max;
+}
+
+
+void
+lhist_print (const struct lat_hist *hist, FILE *out, const char *name)
+{
+    fprintf(out, "%s: n: %llu; p50: %.3f ms; p99: %.3f ms; p99.9: %.3f ms; "
+        "max: %.3f ms\n", name, hist->lh_n,
+        (double) lhist_percentile(hist, 50) / 1000,
+        (double) lhist_percentile(hist, 99) / 1000,
+        (double) lhist_percentile(hist, 99.9) / 1000,
+        (double) hist->lh_max / 1000);
+}
@@ -0,0 +1,47 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * lat_hist.h -- latency histogram
+ *
+ * The histogram is laid out the way HDR histograms are: values below
+ * LH_N_SUB are counted exactly; above that, each power-of-two range is split
+ * into LH_N_SUB / 2 equal buckets.  Recording a value is a few shifts and an
+ * increment, and any reported percentile is within 1% of the real value.
+ * Values are in microseconds; those above LH_MAX_VALUE are counted as
+ * LH_MAX_VALUE.
+ */
+
+#ifndef LAT_HIST_H
+#define LAT_HIST_H 1
+
+#include <stdio.h>
+
+#define LH_SUB_BITS 8
+#define LH_N_SUB (1u << LH_SUB_BITS)
+#define LH_MAX_SHIFT 32
+#define LH_MAX_VALUE ((1ull << (LH_SUB_BITS + LH_MAX_SHIFT)) - 1)
+#define LH_N_BUCKETS (LH_N_SUB + LH_MAX_SHIFT * (LH_N_SUB / 2))
+
+struct lat_hist
+{
+    unsigned long long  lh_counts[LH_N_BUCKETS];
+    unsigned long long  lh_n;
+    unsigned long long  lh_min, lh_max;
+};
+
+void
+lhist_init (struct lat_hist *);
+
+void
+lhist_record (struct lat_hist *, unsigned long long value);
+
+/* Returns the largest value that falls into the same bucket as the value
+ * at percentile `pct' (0 through 100).  Returns 0 if the histogram is empty.
+ */
+unsigned long long
+lhist_percentile (const struct lat_hist *, double pct);
+
+/* Print count, p50, p99, p99.9, and maximum in milliseconds on one line */
+void
+lhist_print (const struct lat_hist *, FILE *, const char *name);
+
+#endif
@@ -0,0 +1,367 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * netsim.c -- deterministic network simulator
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <netinet/in.h>
+#include <sys/socket.h>
+#else
+#include <Windows.h>
+#include <WinSock2.h>
+#include <ws2ipdef.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_int_types.h"
+#include "netsim.h"
+
+
+struct netsim_packet
+{
+    TAILQ_ENTRY(netsim_packet)  np_next;
+    struct netsim_link         *np_link;
+    lsquic_time_t               np_arrival;
+    enum {
+        NP_LOCAL_SA = 1 << 0,
+        NP_PEER_SA  = 1 << 1,
+    }                           np_flags;
+    struct sockaddr_storage     np_local_sa;
+    struct sockaddr_storage     np_peer_sa;
+    size_t                      np_sz;
+    unsigned char               np_buf[];
+};
+
+
+struct netsim_link
+{
+    TAILQ_ENTRY(netsim_link)    nl_next;
+    struct netsim              *nl_sim;
+    struct netsim_link_params   nl_params;
+    netsim_deliver_f            nl_deliver;
+    void                       *nl_deliver_ctx;
+    /* The bottleneck is busy sending packets until this time.  The queue
+     * backlog is derived from it.  Transmission time remainder is kept so
+     * that rounding does not add up.
+     */
+    lsquic_time_t               nl_busy_until;
+    unsigned long long          nl_tx_rem;
+    /* Jitter does not reorder packets: a packet does not arrive before the
+     * packet sent ahead of it, unless that packet was held back.
+     */
+    lsquic_time_t               nl_last_arrival;
+    uint64_t                    nl_rng;
+    unsigned long long          nl_count;
+    int                         nl_in_burst;
+    struct netsim_link_stats    nl_stats;
+};
+
+
+struct netsim
+{
+    lsquic_time_t                       ns_now;
+    /* Packets are sorted by arrival time.  Packets that arrive at the same
+     * time are delivered in the order they were sent.
+     */
+    TAILQ_HEAD(netsim_packets_head, netsim_packet)
+                                        ns_packets;
+    TAILQ_HEAD(, netsim_link)           ns_links;
+};
+
+
+struct netsim *
+netsim_new (void)
+{
+    struct netsim *sim;
+
+    sim = malloc(sizeof(*sim));
+    if (!sim)
+        return NULL;
+
+    sim->ns_now = NETSIM_EPOCH;
+    TAILQ_INIT(&sim->ns_packets);
+    TAILQ_INIT(&sim->ns_links);
+    return sim;
+}
+
+
+void
+netsim_destroy (struct netsim *sim)
+{
+    struct netsim_packet *packet;
+    struct netsim_link *link;
+
+    while ((packet = TAILQ_FIRST(&sim->ns_packets)))
+    {
+        TAILQ_REMOVE(&sim->ns_packets, packet, np_next);
+        free(packet);
+    }
+    while ((link = TAILQ_FIRST(&sim->ns_links)))
+    {
+        TAILQ_REMOVE(&sim->ns_links, link, nl_next);
+        free(link);
+    }
+    free(sim);
+}
+
+
+struct netsim_link *
+netsim_link_new (struct netsim *sim, const struct netsim_link_params *params,
+                                netsim_deliver_f deliver, void *deliver_ctx)
+{
+    struct netsim_link *link;
+
+    link = calloc(1, sizeof(*link));
+    if (!link)
+        return NULL;
+
+    link->nl_sim = sim;
+    link->nl_params = *params;
+    link->nl_deliver = deliver;
+    link->nl_deliver_ctx = deliver_ctx;
+    /* xorshift state must not be zero */
+    link->nl_rng = params->nlp_seed ^ 0x9E3779B97F4A7C15ull;
+    if (0 == link->nl_rng)
+        link->nl_rng = 1;
+    TAILQ_INSERT_TAIL(&sim->ns_links, link, nl_next);
+    return link;
+}
+
+
+/* xorshift64* */
+static uint64_t
+link_rand (struct netsim_link *link)
+{
+    link->nl_rng ^= link->nl_rng >> 12;
+    link->nl_rng ^= link->nl_rng << 25;
+    link->nl_rng ^= link->nl_rng >> 27;
+    return link->nl_rng * 0x2545F4914F6CDD1Dull;
+}
+
+
+static int
+link_chance (struct netsim_link *link, unsigned ppm)
+{
+    return ppm > 0 && link_rand(link) % 1000000 < ppm;
+}
+
+
+/* With bursts, the link is a two-state Markov chain that drops every packet
+ * in the bad state.  The transition probabilities are picked so that the
+ * average burst length is `nlp_loss_burst' and the overall loss rate is
+ * `nlp_loss_ppm'.
+ */
+static int
+link_lose (struct netsim_link *link)
+{
+    const struct netsim_link_params *const params = &link->nl_params;
+    unsigned long long to_bad;
+
+    if (params->nlp_loss_every && 0 == link->nl_count % params->nlp_loss_every)
+        return 1;
+
+    if (params->nlp_loss_burst <= 1 || params->nlp_loss_ppm >= 1000000)
+        return link_chance(link, params->nlp_loss_ppm);
+
+    if (link->nl_in_burst)
+    {
+        if (link_rand(link) % params->nlp_loss_burst == 0)
+            link->nl_in_burst = 0;
+    }
+    else
+    {
+        to_bad = (unsigned long long) params->nlp_loss_ppm * 1000000
+                / ((unsigned long long) params->nlp_loss_burst
+                                    * (1000000 - params->nlp_loss_ppm));
+        link->nl_in_burst = link_chance(link, (unsigned) to_bad);
+    }
+    return link->nl_in_burst;
+}
+
+
+static void
+copy_sa (struct sockaddr_storage *dst, const struct sockaddr *src)
+{
+    if (AF_INET == src->sa_family)
+        memcpy(dst, src, sizeof(struct sockaddr_in));
+    else
+        memcpy(dst, src, sizeof(struct sockaddr_in6));
+}
+
+
+static void
+sim_insert (struct netsim *sim, struct netsim_packet *packet)
+{
+    struct netsim_packet *prev;
+
+    /* Most packets go to the end, so search from there */
+    TAILQ_FOREACH_REVERSE(prev, &sim->ns_packets, netsim_packets_head, np_next)
+        if (prev->np_arrival <= packet->np_arrival)
+        {
+            TAILQ_INSERT_AFTER(&sim->ns_packets, prev, packet, np_next);
+            return;
+        }
+    TAILQ_INSERT_HEAD(&sim->ns_packets, packet, np_next);
+}
+
+
+int
+netsim_link_send (struct netsim_link *link, const unsigned char *buf,
+    size_t sz, const struct sockaddr *local_sa, const struct sockaddr *dest_sa)
+{
+    const struct netsim_link_params *const params = &link->nl_params;
+    struct netsim *const sim = link->nl_sim;
+    struct netsim_packet *packet;
+    unsigned long long backlog, tx;
+    lsquic_time_t start, arrival;
+
+    ++link->nl_stats.nls_sent;
+    ++link->nl_count;
+
+    if (params->nlp_bandwidth)
+    {
+        if (params->nlp_queue_size && link->nl_busy_until > sim->ns_now)
+        {
+            backlog = (link->nl_busy_until - sim->ns_now)
+                                        * params->nlp_bandwidth / 1000000;
+            if (backlog + sz > params->nlp_queue_size)
+            {
+                ++link->nl_stats.nls_dropped_queue;
+                return 0;
+            }
+        }
+        start = link->nl_busy_until > sim->ns_now
+              ? link->nl_busy_until : sim->ns_now;
+        tx = (unsigned long long) sz * 1000000 + link->nl_tx_rem;
+        link->nl_busy_until = start + tx / params->nlp_bandwidth;
+        link->nl_tx_rem = tx % params->nlp_bandwidth;
+    }
+    else
+        link->nl_busy_until = sim->ns_now;
+
+    /* Lost packets have gone through the bottleneck and used it up */
+    if (link_lose(link))
+    {
+        ++link->nl_stats.nls_dropped_loss;
+        return 0;
+    }
+
+    arrival = link->nl_busy_until + params->nlp_delay;
+    if (params->nlp_jitter)
+        arrival += link_rand(link) % (params->nlp_jitter + 1);
+    if (link_chance(link, params->nlp_reorder_ppm))
+    {
+        arrival += params->nlp_reorder_delay;
+        ++link->nl_stats.nls_reordered;
+    }
+    else
+    {
+        if (arrival < link->nl_last_arrival)
+            arrival = link->nl_last_arrival;
+        link->nl_last_arrival = arrival;
+    }
+
+    packet = malloc(sizeof(*packet) + sz);
+    if (!packet)
+        return -1;
+
+    packet->np_link = link;
+    packet->np_arrival = arrival;
+    packet->np_flags = 0;
+    if (dest_sa)
+    {
+        copy_sa(&packet->np_local_sa, dest_sa);
+        packet->np_flags |= NP_LOCAL_SA;
+    }
+    if (local_sa)
+    {
+        copy_sa(&packet->np_peer_sa, local_sa);
+        packet->np_flags |= NP_PEER_SA;
+    }
+    packet->np_sz = sz;
+    memcpy(packet->np_buf, buf, sz);
+    sim_insert(sim, packet);
+    return 0;
+}
+
+
+int
+netsim_packets_out (void *ctx, const struct lsquic_out_spec *specs,
+                                                                unsigned count)
+{
+    struct netsim_link *const link = ctx;
+    unsigned n;
+
+    for (n = 0; n < count; ++n)
+        if (0 != netsim_link_send(link, specs[n].buf, specs[n].sz,
+                                    specs[n].local_sa, specs[n].dest_sa))
+            break;
+
+    return n > 0 ? (int) n : -1;
+}
+
+
+const struct netsim_link_stats *
+netsim_link_stats (const struct netsim_link *link)
+{
+    return &link->nl_stats;
+}
+
+
+void
+netsim_advance (struct netsim *sim, lsquic_time_t until)
+{
+    struct netsim_packet *packet;
+    struct netsim_link *link;
+
+    while ((packet = TAILQ_FIRST(&sim->ns_packets))
+                                            && packet->np_arrival <= until)
+    {
+        TAILQ_REMOVE(&sim->ns_packets, packet, np_next);
+        if (packet->np_arrival > sim->ns_now)
+            sim->ns_now = packet->np_arrival;
+        link = packet->np_link;
+        ++link->nl_stats.nls_delivered;
+        link->nl_stats.nls_bytes_delivered += packet->np_sz;
+        link->nl_deliver(link->nl_deliver_ctx, packet->np_buf, packet->np_sz,
+            packet->np_flags & NP_LOCAL_SA
+                ? (struct sockaddr *) &packet->np_local_sa : NULL,
+            packet->np_flags & NP_PEER_SA
+                ? (struct sockaddr *) &packet->np_peer_sa : NULL);
+        free(packet);
+    }
+
+    if (until > sim->ns_now)
+        sim->ns_now = until;
+}
+
+
+lsquic_time_t
+netsim_next_delivery (const struct netsim *sim)
+{
+    const struct netsim_packet *packet;
+
+    packet = TAILQ_FIRST(&sim->ns_packets);
+    if (packet)
+        return packet->np_arrival;
+    else
+        return 0;
+}
+
+
+lsquic_time_t
+netsim_now (const struct netsim *sim)
+{
+    return sim->ns_now;
+}
+
+
+lsquic_time_t
+netsim_clock (void *sim)
+{
+    return netsim_now(sim);
+}
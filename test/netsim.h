@@ -0,0 +1,121 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * netsim.h -- deterministic network simulator
+ *
+ * The simulator carries datagrams over one-way links.  Each link is a
+ * bottleneck of given bandwidth with a tail-drop queue in front of it,
+ * followed by propagation delay with optional jitter.  Packets can be lost
+ * at random -- one at a time or in bursts -- or every Nth packet, and they
+ * can be held back to arrive out of order.
+ *
+ * Time is virtual: nothing happens until the caller advances the clock, and
+ * the clock jumps straight to the requested time, delivering packets on the
+ * way.  Each link has its own random number generator seeded from the link
+ * parameters, so that the same sequence of calls always produces the same
+ * result.  A whole transfer takes as long as the CPU work it involves.
+ *
+ * To run an engine over the simulator (lsquic_time_set_clock() is only
+ * there when the library is built without NDEBUG):
+ *
+ *      lsquic_time_set_clock(netsim_clock, sim);
+ *      engine_api.ea_packets_out     = netsim_packets_out;
+ *      engine_api.ea_packets_out_ctx = link_to_peer;
+ *
+ * and have the deliver callback of the link from the peer pass packets to
+ * lsquic_engine_packet_in().  The driver loop then processes connections,
+ * gets the earliest advisory tick time, and advances the simulator to that
+ * time or to netsim_next_delivery(), whichever comes first.
+ *
+ * lsquic_int_types.h must be included before this file.
+ */
+
+#ifndef NETSIM_H
+#define NETSIM_H 1
+
+struct lsquic_out_spec;
+struct sockaddr;
+struct netsim;
+struct netsim_link;
+
+/* The virtual clock starts at this value rather than at zero, as zero
+ * means "not set" to lsquic alarms and to the pacer.
+ */
+#define NETSIM_EPOCH 1000000
+
+struct netsim_link_params
+{
+    unsigned long long  nlp_bandwidth;      /* Bytes/second; 0: no limit */
+    lsquic_time_t       nlp_delay;          /* One-way delay, microseconds */
+    lsquic_time_t       nlp_jitter;         /* Up to this much extra delay */
+    unsigned            nlp_queue_size;     /* In bytes; 0: no limit */
+    unsigned            nlp_loss_ppm;       /* Random loss, per million */
+    unsigned            nlp_loss_burst;     /* Average loss burst length */
+    unsigned            nlp_loss_every;     /* Drop every Nth packet; 0: off */
+    unsigned            nlp_reorder_ppm;    /* Held back, per million */
+    lsquic_time_t       nlp_reorder_delay;  /* How long they are held back */
+    unsigned long long  nlp_seed;           /* Random number generator seed */
+};
+
+struct netsim_link_stats
+{
+    unsigned long long  nls_sent;
+    unsigned long long  nls_delivered;
+    unsigned long long  nls_bytes_delivered;
+    unsigned long long  nls_dropped_queue;  /* Tail drops */
+    unsigned long long  nls_dropped_loss;   /* Random and every-Nth loss */
+    unsigned long long  nls_reordered;
+};
+
+/* `local_sa' and `peer_sa' are from the receiver's point of view: they can
+ * be passed to lsquic_engine_packet_in() as they are.  They are NULL if the
+ * sender did not specify them.
+ */
+typedef void (*netsim_deliver_f) (void *deliver_ctx,
+            const unsigned char *buf, size_t sz,
+            const struct sockaddr *local_sa, const struct sockaddr *peer_sa);
+
+struct netsim *
+netsim_new (void);
+
+/* Frees the simulator, its links, and the packets still in flight */
+void
+netsim_destroy (struct netsim *);
+
+struct netsim_link *
+netsim_link_new (struct netsim *, const struct netsim_link_params *,
+                            netsim_deliver_f deliver, void *deliver_ctx);
+
+/* Always returns 0 unless out of memory: dropping a packet is not an
+ * error, just like with UDP.
+ */
+int
+netsim_link_send (struct netsim_link *, const unsigned char *buf, size_t sz,
+            const struct sockaddr *local_sa, const struct sockaddr *dest_sa);
+
+/* Can be used as `ea_packets_out' with the link as `ea_packets_out_ctx' */
+int
+netsim_packets_out (void *link, const struct lsquic_out_spec *specs,
+                                                            unsigned count);
+
+const struct netsim_link_stats *
+netsim_link_stats (const struct netsim_link *);
+
+/* Deliver packets that arrive at `until' or earlier, each at its time, and
+ * set the clock to `until'.  The clock never goes back.  The deliver
+ * callback may send more packets.
+ */
+void
+netsim_advance (struct netsim *, lsquic_time_t until);
+
+/* Returns arrival time of the next packet or 0 if no packets are in flight */
+lsquic_time_t
+netsim_next_delivery (const struct netsim *);
+
+lsquic_time_t
+netsim_now (const struct netsim *);
+
+/* Clock function for lsquic_time_set_clock(): the context is the simulator */
+lsquic_time_t
+netsim_clock (void *sim);
+
+#endif
@@ -1034,6 +1034,11 @@ set_engine_option (struct lsquic_engine_settings *settings,
             settings->es_rw_once = atoi(val);
             return 0;
         }
+        else if (0 == strncmp(name, "compact", 7))
+        {
+            settings->es_compact = atoi(val);
+            return 0;
+        }
         break;
     case 8:
         if (0 == strncmp(name, "max_cfcw", 8))
@@ -1047,6 +1052,13 @@ set_engine_option (struct lsquic_engine_settings *settings,
             return 0;
         }
         break;
+    case 9:
+        if (0 == strncmp(name, "mem_arena", 9))
+        {
+            settings->es_mem_arena = atoi(val);
+            return 0;
+        }
+        break;
     case 10:
         if (0 == strncmp(name, "honor_prst", 10))
         {
@@ -1094,6 +1106,18 @@ set_engine_option (struct lsquic_engine_settings *settings,
             settings->es_progress_check = atoi(val);
             return 0;
         }
+        if (0 == strncmp(name, "c255_pool_size", 14))
+        {
+            settings->es_c255_pool_size = atoi(val);
+            return 0;
+        }
+        break;
+    case 15:
+        if (0 == strncmp(name, "hibernate_after", 15))
+        {
+            settings->es_hibernate_after = atoi(val);
+            return 0;
+        }
         break;
     case 16:
         if (0 == strncmp(name, "proc_time_thresh", 16))
@@ -1102,6 +1126,13 @@ set_engine_option (struct lsquic_engine_settings *settings,
             return 0;
         }
         break;
+    case 17:
+        if (0 == strncmp(name, "preconn_keepalive", 17))
+        {
+            settings->es_preconn_keepalive = atoi(val);
+            return 0;
+        }
+        break;
     case 20:
         if (0 == strncmp(name, "max_header_list_size", 20))
         {
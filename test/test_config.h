@@ -0,0 +1,10 @@
+#ifndef LSQUIC_CONFIG_H
+#define LSQUIC_CONFIG_H
+
+/* #undef HAVE_IP_DONTFRAG */
+#define HAVE_IP_MTU_DISCOVER 1
+#define HAVE_REGEX 1
+
+#define LSQUIC_DONTFRAG_SUPPORTED (HAVE_IP_DONTFRAG || HAVE_IP_MTU_DISCOVER)
+
+#endif
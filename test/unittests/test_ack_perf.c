@@ -0,0 +1,230 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_ack_perf.c -- Benchmark ACK processing over large unacked queues.
+ *
+ * Each iteration sends a window of packets through the send controller
+ * and then acknowledges them using cumulative ACKs, each of which covers
+ * a few more packets, like a peer using delayed ACKs would.  The ACK path
+ * walks the unacked queue and touches each packet's header, which is why
+ * the layout of struct lsquic_packet_out matters here.
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <getopt.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_alarmset.h"
+#include "lsquic_packet_common.h"
+#include "lsquic_packet_out.h"
+#include "lsquic_parse.h"
+#include "lsquic_conn_flow.h"
+#include "lsquic_rtt.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
+#include "lsquic_malo.h"
+#include "lsquic_mm.h"
+#include "lsquic_conn_public.h"
+#include "lsquic_conn.h"
+#include "lsquic_engine_public.h"
+#include "lsquic_cubic.h"
+#include "lsquic_pacer.h"
+#include "lsquic_senhist.h"
+#include "lsquic_send_ctl.h"
+#include "lsquic_ver_neg.h"
+#include "lsquic_util.h"
+#include "test_cycles.h"
+
+
+struct test_objs {
+    struct lsquic_conn          lconn;
+    struct lsquic_engine_public eng_pub;
+    struct lsquic_conn_public   conn_pub;
+    struct lsquic_send_ctl      send_ctl;
+    struct lsquic_alarmset      alset;
+    struct ver_neg              ver_neg;
+};
+
+
+static int
+unit_test_doesnt_write_ack (struct lsquic_conn *lconn)
+{
+    return 0;
+}
+
+
+static const struct conn_iface our_conn_if =
+{
+    .ci_can_write_ack = unit_test_doesnt_write_ack,
+};
+
+
+static void
+init_test_objs (struct test_objs *tobjs)
+{
+    memset(tobjs, 0, sizeof(*tobjs));
+    tobjs->lconn.cn_pf = select_pf_by_ver(LSQVER_039);
+    tobjs->lconn.cn_pack_size = 1370;
+    tobjs->lconn.cn_if = &our_conn_if;
+    tobjs->lconn.cn_flags |= LSCONN_HANDSHAKE_DONE;
+    lsquic_mm_init(&tobjs->eng_pub.enp_mm);
+    lsquic_alarmset_init(&tobjs->alset, 0);
+    tobjs->conn_pub.mm = &tobjs->eng_pub.enp_mm;
+    tobjs->conn_pub.lconn = &tobjs->lconn;
+    tobjs->conn_pub.enpub = &tobjs->eng_pub;
+    tobjs->conn_pub.send_ctl = &tobjs->send_ctl;
+    tobjs->conn_pub.packet_out_malo =
+                        lsquic_malo_create(sizeof(struct lsquic_packet_out));
+    lsquic_send_ctl_init(&tobjs->send_ctl, &tobjs->alset, &tobjs->eng_pub,
+        &tobjs->ver_neg, &tobjs->conn_pub, tobjs->lconn.cn_pack_size);
+}
+
+
+static void
+deinit_test_objs (struct test_objs *tobjs)
+{
+    lsquic_send_ctl_cleanup(&tobjs->send_ctl);
+    lsquic_malo_destroy(tobjs->conn_pub.packet_out_malo);
+    lsquic_mm_cleanup(&tobjs->eng_pub.enp_mm);
+}
+
+
+/* Send `n_packets' packets carrying WINDOW_UPDATE frames.  These are
+ * retransmittable, so that the ACK path does not have to scan the whole
+ * queue looking for retransmittable packets.  Returns packet number of the
+ * first packet.
+ */
+static lsquic_packno_t
+send_packets (struct test_objs *tobjs, unsigned n_packets)
+{
+    struct lsquic_packet_out *packet_out;
+    lsquic_packno_t first = 0;
+    lsquic_time_t now;
+    unsigned i;
+
+    now = lsquic_time_now();
+    for (i = 0; i < n_packets; ++i)
+    {
+        packet_out = lsquic_send_ctl_new_packet_out(&tobjs->send_ctl, 0);
+        assert(packet_out);
+        memset(packet_out->po_data, 0, 13);
+        packet_out->po_data[0] = 0x04;      /* WINDOW_UPDATE */
+        packet_out->po_data_sz = 13;
+        packet_out->po_frame_types |= 1 << QUIC_FRAME_WINDOW_UPDATE;
+        lsquic_send_ctl_scheduled_one(&tobjs->send_ctl, packet_out);
+        packet_out = lsquic_send_ctl_next_packet_to_send(&tobjs->send_ctl);
+        assert(packet_out);
+        packet_out->po_sent = now;
+        lsquic_send_ctl_sent_packet(&tobjs->send_ctl, packet_out, 1);
+        if (i == 0)
+            first = packet_out->po_packno;
+    }
+
+    return first;
+}
+
+
+/* Acknowledge packets [first, first + n_packets) using cumulative ACKs,
+ * each of which acknowledges `batch' new packets.
+ */
+static uint64_t
+ack_packets (struct test_objs *tobjs, struct ack_info *acki,
+            lsquic_packno_t first, unsigned n_packets, unsigned batch)
+{
+    lsquic_packno_t high;
+    uint64_t start;
+    lsquic_time_t now;
+    int s;
+
+    now = lsquic_time_now();
+    acki->n_ranges = 1;
+    acki->lack_delta = 0;
+    acki->ranges[0].low = first;
+
+    start = get_cycles();
+    for (high = first + batch - 1; high < first + n_packets + batch - 1;
+                                                                high += batch)
+    {
+        if (high >= first + n_packets)
+            high = first + n_packets - 1;
+        acki->ranges[0].high = high;
+        s = lsquic_send_ctl_got_ack(&tobjs->send_ctl, acki, now);
+        assert(0 == s);
+        (void) s;
+    }
+
+    return get_cycles() - start;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int opt;
+    unsigned i, n_iters = 10, n_packets = 100000, batch = 2;
+    struct test_objs tobjs;
+    struct ack_info *acki;
+    lsquic_packno_t first;
+    uint64_t cycles;
+
+    while (-1 != (opt = getopt(argc, argv, "b:n:p:")))
+    {
+        switch (opt)
+        {
+        case 'b':                   /* Number of newly acked packets per ACK */
+            batch = atoi(optarg);
+            break;
+        case 'n':                   /* Number of iterations */
+            n_iters = atoi(optarg);
+            break;
+        case 'p':                   /* Number of packets in flight */
+            n_packets = atoi(optarg);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n iterations] [-p packets in flight] "
+                "[-b packets per ACK]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (n_packets < 1)
+        n_packets = 1;
+    if (batch < 1)
+        batch = 1;
+
+    acki = malloc(sizeof(*acki));
+    init_test_objs(&tobjs);
+
+    /* Warm up: this also populates malo pages and free lists */
+    first = send_packets(&tobjs, n_packets);
+    (void) ack_packets(&tobjs, acki, first, n_packets, batch);
+
+    cycles = 0;
+    for (i = 0; i < n_iters; ++i)
+    {
+        first = send_packets(&tobjs, n_packets);
+        cycles += ack_packets(&tobjs, acki, first, n_packets, batch);
+        assert(lsquic_send_ctl_is_empty(&tobjs.send_ctl));
+    }
+
+    printf("%u iterations, %u packets in flight, %u packets per ACK\n",
+                                                n_iters, n_packets, batch);
+    printf("%"PRIu64" %ss; %.1f %ss/packet\n", cycles, CYCLES_UNIT,
+                (double) cycles / (double) n_packets / (double) n_iters,
+                CYCLES_UNIT);
+
+    deinit_test_objs(&tobjs);
+    free(acki);
+    return 0;
+}
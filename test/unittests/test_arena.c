@@ -0,0 +1,123 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+
+#include "lsquic_int_types.h"
+#include "lsquic_arena.h"
+#include "lsquic_malo.h"
+#include "lsquic_mm.h"
+
+
+static void
+test_pages_and_bufs (void)
+{
+    struct lsquic_arena *arena;
+    void *pages[3], *page, *bufs[4];
+    unsigned i;
+
+    arena = lsquic_arena_new();
+    assert(arena);
+
+    for (i = 0; i < 3; ++i)
+    {
+        pages[i] = lsquic_arena_get_page(arena);
+        assert(pages[i]);
+        assert(0 == ((uintptr_t) pages[i] & 0xFFF));
+        memset(pages[i], 'P', 0x1000);
+    }
+
+    for (i = 0; i < 4; ++i)
+    {
+        bufs[i] = lsquic_arena_alloc(arena, 1350);
+        assert(bufs[i]);
+        assert(0 == ((uintptr_t) bufs[i] & 63));
+        memset(bufs[i], 'B', 1350);
+    }
+
+    /* Pages and buffers do not overlap */
+    for (i = 0; i < 3; ++i)
+        assert(((unsigned char *) pages[i])[0] == 'P'
+            && ((unsigned char *) pages[i])[0xFFF] == 'P');
+
+    /* Returned pages are reused */
+    lsquic_arena_put_page(arena, pages[1]);
+    page = lsquic_arena_get_page(arena);
+    assert(page == pages[1]);
+
+    /* Allocations larger than what is left go into a new region */
+    for (i = 0; i < 3; ++i)
+        assert(lsquic_arena_alloc(arena, ARENA_REGION_SZ / 2));
+    assert(lsquic_arena_mem_used(arena) >= 2 * ARENA_REGION_SZ);
+
+    lsquic_arena_destroy(arena);
+}
+
+
+static void
+test_malo_in_arena (void)
+{
+    struct lsquic_arena *arena;
+    struct malo *malo;
+    void *objs[1000];
+    unsigned i;
+
+    arena = lsquic_arena_new();
+    malo = lsquic_malo_create_arena(100, arena);
+    assert(malo);
+
+    for (i = 0; i < 1000; ++i)
+    {
+        objs[i] = lsquic_malo_get(malo);
+        assert(objs[i]);
+        memset(objs[i], 'O', 100);
+    }
+    for (i = 0; i < 1000; i += 2)
+        lsquic_malo_put(objs[i]);
+    for (i = 0; i < 1000; i += 2)
+        objs[i] = lsquic_malo_get(malo);
+
+    /* Pages go back to the arena */
+    lsquic_malo_destroy(malo);
+    malo = lsquic_malo_create_arena(100, arena);
+    assert(malo);
+    lsquic_malo_destroy(malo);
+
+    lsquic_arena_destroy(arena);
+}
+
+
+static void
+test_mm_in_arena (void)
+{
+    struct lsquic_mm mm;
+    void *bufs[20];
+    unsigned i;
+
+    assert(0 == lsquic_mm_init_arena(&mm));
+    lsquic_mm_set_watermarks(&mm, MM_POOL_4K, 0, 5);
+
+    for (i = 0; i < 20; ++i)
+        bufs[i] = lsquic_mm_get_4k(&mm);
+    for (i = 0; i < 20; ++i)
+        lsquic_mm_put_4k(&mm, bufs[i]);
+
+    /* Arena buffers cannot be freed: they are all kept */
+    assert(20 == lsquic_mm_pool_stats(&mm, MM_POOL_4K)->mps_cached);
+    assert(0 == lsquic_mm_trim(&mm));
+    assert(20 == lsquic_mm_pool_stats(&mm, MM_POOL_4K)->mps_cached);
+
+    lsquic_mm_cleanup(&mm);
+}
+
+
+int
+main (void)
+{
+    test_pages_and_bufs();
+    test_malo_in_arena();
+    test_mm_in_arena();
+    return 0;
+}
@@ -0,0 +1,51 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+#include <assert.h>
+#include <string.h>
+#include <openssl/ssl.h>
+
+#include "lsquic_crypto.h"
+#include "lsquic_c255_pool.h"
+
+
+int
+main (void)
+{
+    struct c255_pool pool;
+    unsigned char priv[4][32], pub[4][32], expected_pub[32];
+    unsigned n;
+    int s;
+
+    s = lsquic_c255_pool_init(&pool, 3);
+    assert(0 == s);
+    assert(0 == lsquic_c255_pool_count(&pool));
+
+    s = lsquic_c255_pool_get(&pool, priv[0], pub[0]);
+    assert(-1 == s);            /* Pool is empty */
+
+    n = lsquic_c255_pool_refill(&pool, 2);
+    assert(2 == n);
+    n = lsquic_c255_pool_refill(&pool, 10);
+    assert(1 == n);             /* Cannot go over capacity */
+    n = lsquic_c255_pool_refill(&pool, 10);
+    assert(0 == n);
+    assert(3 == lsquic_c255_pool_count(&pool));
+
+    for (n = 0; n < 3; ++n)
+    {
+        s = lsquic_c255_pool_get(&pool, priv[n], pub[n]);
+        assert(0 == s);
+        c255_get_pub_key(priv[n], expected_pub);
+        assert(0 == memcmp(expected_pub, pub[n], sizeof(expected_pub)));
+    }
+    assert(0 == lsquic_c255_pool_count(&pool));
+    s = lsquic_c255_pool_get(&pool, priv[3], pub[3]);
+    assert(-1 == s);
+
+    /* Each key pair is handed out once */
+    assert(0 != memcmp(priv[0], priv[1], sizeof(priv[0])));
+    assert(0 != memcmp(priv[1], priv[2], sizeof(priv[0])));
+    assert(0 != memcmp(priv[0], priv[2], sizeof(priv[0])));
+
+    lsquic_c255_pool_cleanup(&pool);
+    return 0;
+}
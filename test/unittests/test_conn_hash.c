@@ -1,12 +1,25 @@
 /* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_conn_hash.c -- Test the connection hash.
+ *
+ * With -b, measure lookups per second by connection ID.  Connections are
+ * looked up either in random order, as on a busy server, or in bursts of
+ * lookups of the same connection, as on a client.
+ */
+
 #include <assert.h>
+#include <inttypes.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/queue.h>
 #ifndef WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
 #include <unistd.h>
+#else
+#include <getopt.h>
 #endif
 
 #include "lsquic.h"
@@ -17,7 +30,9 @@
 #include "lsquic_mm.h"
 #include "lsquic_malo.h"
 #include "lsquic_logger.h"
+#include "lsquic_util.h"
 #include "lsquic.h"
+#include "test_cycles.h"
 
 
 static struct lsquic_conn *
@@ -30,23 +45,15 @@ get_new_lsquic_conn (struct malo *malo)
 }
 
 
-int
-main (int argc, char **argv)
+static void
+test_add_find_remove (unsigned nelems)
 {
     struct malo *malo;
     struct conn_hash conn_hash;
-    unsigned n, nelems;
+    unsigned n;
     struct lsquic_conn *lconn, *find_lsconn;
     int s;
 
-    if (argc > 1)
-        nelems = atoi(argv[1]);
-    else
-        nelems = 1000000;
-
-    lsquic_log_to_fstream(stderr, LLTS_HHMMSSMS);
-    lsquic_set_log_level("info");
-
     malo = lsquic_malo_create(sizeof(*lconn));
     s = conn_hash_init(&conn_hash, 0);
     assert(0 == s);
@@ -77,6 +84,223 @@ main (int argc, char **argv)
 
     conn_hash_cleanup(&conn_hash);
     lsquic_malo_destroy(malo);
+}
+
+
+/* This is what the engine does when it is destroyed */
+static void
+test_remove_while_iterating (void)
+{
+    struct malo *malo;
+    struct conn_hash conn_hash;
+    struct lsquic_conn *lconn;
+    unsigned n;
+    int s;
+
+    malo = lsquic_malo_create(sizeof(*lconn));
+    s = conn_hash_init(&conn_hash, 0);
+    assert(0 == s);
+
+    for (n = 0; n < 1000; ++n)
+    {
+        lconn = get_new_lsquic_conn(malo);
+        s = conn_hash_add(&conn_hash, lconn);
+        assert(0 == s);
+    }
+
+    /* Make the cache point to a connection before removing it */
+    lconn = lsquic_malo_first(malo);
+    assert(lconn == conn_hash_find_by_cid(&conn_hash, lconn->cn_cid));
+
+    n = 0;
+    for (lconn = conn_hash_first(&conn_hash); lconn;
+                                    lconn = conn_hash_next(&conn_hash))
+    {
+        assert(!lconn->cn_flags);
+        lconn->cn_flags = 1;    /* Visited */
+        conn_hash_remove(&conn_hash, lconn);
+        ++n;
+    }
+    assert(1000 == n);
+    assert(0 == conn_hash_count(&conn_hash));
+
+    lconn = lsquic_malo_first(malo);
+    assert(!conn_hash_find_by_cid(&conn_hash, lconn->cn_cid));
+
+    conn_hash_cleanup(&conn_hash);
+    lsquic_malo_destroy(malo);
+}
+
+
+static void
+test_by_addr (void)
+{
+    struct malo *malo;
+    struct conn_hash conn_hash;
+    struct lsquic_conn *lconn;
+    struct sockaddr_in sin;
+    unsigned n;
+    int s;
+
+    malo = lsquic_malo_create(sizeof(*lconn));
+    s = conn_hash_init(&conn_hash, CHF_USE_ADDR);
+    assert(0 == s);
+
+    memset(&sin, 0, sizeof(sin));
+    sin.sin_family = AF_INET;
+    sin.sin_addr.s_addr = htonl(0x7F000001);
+    for (n = 0; n < 100; ++n)
+    {
+        lconn = get_new_lsquic_conn(malo);
+        sin.sin_port = htons(10000 + n);
+        memcpy(lconn->cn_local_addr, &sin, sizeof(sin));
+        s = conn_hash_add(&conn_hash, lconn);
+        assert(0 == s);
+    }
+
+    for (n = 0; n < 100; ++n)
+    {
+        sin.sin_port = htons(10000 + n);
+        lconn = conn_hash_find_by_addr(&conn_hash, (struct sockaddr *) &sin);
+        assert(lconn);
+        assert(0 == memcmp(lconn->cn_local_addr, &sin, sizeof(sin)));
+        if (n & 1)
+            conn_hash_remove(&conn_hash, lconn);
+    }
+    for (n = 0; n < 100; ++n)
+    {
+        sin.sin_port = htons(10000 + n);
+        lconn = conn_hash_find_by_addr(&conn_hash, (struct sockaddr *) &sin);
+        assert(!!lconn == !(n & 1));
+    }
+    sin.sin_port = htons(9999);
+    assert(!conn_hash_find_by_addr(&conn_hash, (struct sockaddr *) &sin));
+    assert(50 == conn_hash_count(&conn_hash));
+
+    conn_hash_cleanup(&conn_hash);
+    lsquic_malo_destroy(malo);
+}
+
+
+static uint64_t
+xorshift (uint64_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+
+/* Look up `n_lookups' connections in bursts of `burst' lookups of the same
+ * connection.  Burst of one is random access.
+ */
+static void
+bench_lookups (unsigned n_conns, unsigned n_lookups, unsigned burst)
+{
+    struct conn_hash conn_hash;
+    struct lsquic_conn *conns, *lconn;
+    lsquic_cid_t *cids;
+    uint64_t rnd, cycles;
+    lsquic_time_t t0, t1;
+    unsigned n, i;
+    int s;
+
+    conns = calloc(n_conns, sizeof(conns[0]));
+    s = conn_hash_init(&conn_hash, 0);
+    assert(0 == s);
+    rnd = 0x9E3779B97F4A7C15ULL;
+    for (n = 0; n < n_conns; ++n)
+    {
+        conns[n].cn_cid = xorshift(&rnd);
+        s = conn_hash_add(&conn_hash, &conns[n]);
+        assert(0 == s);
+    }
+
+    /* Connection IDs to look up are chosen beforehand */
+    cids = malloc(n_lookups * sizeof(cids[0]));
+    for (n = 0; n < n_lookups; n += burst)
+    {
+        cids[n] = conns[ xorshift(&rnd) % n_conns ].cn_cid;
+        for (i = 1; i < burst && n + i < n_lookups; ++i)
+            cids[n + i] = cids[n];
+    }
+
+    t0 = lsquic_time_now();
+    cycles = get_cycles();
+    for (n = 0; n < n_lookups; ++n)
+    {
+        lconn = conn_hash_find_by_cid(&conn_hash, cids[n]);
+        assert(lconn);
+        (void) lconn;
+    }
+    cycles = get_cycles() - cycles;
+    t1 = lsquic_time_now();
+
+    printf("%8u conns, burst %2u: %6.1f %ss/lookup; %.1f M lookups/sec\n",
+        n_conns, burst, (double) cycles / (double) n_lookups, CYCLES_UNIT,
+        (double) n_lookups / (double) (t1 - t0 ? t1 - t0 : 1));
+
+    free(cids);
+    conn_hash_cleanup(&conn_hash);
+    free(conns);
+}
+
+
+int
+main (int argc, char **argv)
+{
+    static const unsigned sizes[] = { 1000, 100000, 1000000, };
+    unsigned n, nelems = 0, n_lookups = 10000000, burst = 8;
+    int opt, bench = 0;
+
+    while (-1 != (opt = getopt(argc, argv, "bk:l:n:")))
+    {
+        switch (opt)
+        {
+        case 'b':
+            bench = 1;
+            break;
+        case 'k':                   /* Lookups per burst */
+            burst = atoi(optarg);
+            break;
+        case 'l':                   /* Number of lookups */
+            n_lookups = atoi(optarg);
+            break;
+        case 'n':                   /* Number of connections */
+            nelems = atoi(optarg);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-b] [-n connections] [-l lookups] "
+                "[-k burst]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (bench)
+    {
+        if (burst < 1)
+            burst = 1;
+        if (nelems)
+        {
+            bench_lookups(nelems, n_lookups, 1);
+            bench_lookups(nelems, n_lookups, burst);
+        }
+        else
+            for (n = 0; n < sizeof(sizes) / sizeof(sizes[0]); ++n)
+            {
+                bench_lookups(sizes[n], n_lookups, 1);
+                bench_lookups(sizes[n], n_lookups, burst);
+            }
+        exit(0);
+    }
+
+    lsquic_log_to_fstream(stderr, LLTS_HHMMSSMS);
+    lsquic_set_log_level("info");
+
+    test_add_find_remove(nelems ? nelems : 1000000);
+    test_remove_while_iterating();
+    test_by_addr();
 
     exit(0);
 }
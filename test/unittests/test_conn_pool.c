@@ -0,0 +1,492 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_conn_pool.c -- Test the client connection pool.
+ *
+ * The pool opens connections using a real engine.  The server on the
+ * other end is the fake server (see fake_server.h).  Time is virtual.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#else
+#include <Windows.h>
+#include <WinSock2.h>
+#include <ws2ipdef.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_int_types.h"
+#include "lsquic_util.h"
+#include "conn_pool.h"
+#include "fake_server.h"
+
+#define MAX_REQS (2 * FSRV_MIDS + 1)
+
+
+static lsquic_time_t s_now = 1000000;
+
+
+static lsquic_time_t
+test_clock (void *ctx)
+{
+    return s_now;
+}
+
+
+struct test_req
+{
+    lsquic_stream_t    *stream;
+    lsquic_conn_t      *conn;
+    uint32_t            stream_id;
+    unsigned            order;      /* Order in which stream was given */
+    int                 closed,
+                        failed;
+};
+
+
+struct test_ctx
+{
+    struct lsquic_engine_settings   settings;
+    struct conn_pool                pool;
+    struct fsrv                    *srv;
+    lsquic_engine_t                *engine;
+    struct sockaddr_in              peer_sa;
+    unsigned short                  next_port;
+    int                             scheduled;
+    unsigned                        n_streams,
+                                    n_conn_closed;
+    struct test_req                 reqs[MAX_REQS];
+};
+
+
+static int
+test_connect (void *ctx, const char *hostname, const struct sockaddr *peer_sa)
+{
+    struct test_ctx *const test = ctx;
+    struct sockaddr_in local_sa;
+    lsquic_conn_t *conn;
+
+    /* Local addresses must differ, as the engine looks up client
+     * connections by address.
+     */
+    memset(&local_sa, 0, sizeof(local_sa));
+    local_sa.sin_family = AF_INET;
+    local_sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    local_sa.sin_port = htons(test->next_port++);
+    conn = lsquic_engine_connect(test->engine, (struct sockaddr *) &local_sa,
+                            peer_sa, test, NULL, hostname, 0);
+    return conn ? 0 : -1;
+}
+
+
+static void
+test_schedule (void *ctx)
+{
+    struct test_ctx *const test = ctx;
+    test->scheduled = 1;
+}
+
+
+static lsquic_stream_ctx_t *
+test_on_new_stream (void *req_ctx, lsquic_stream_t *stream)
+{
+    struct test_req *const req = req_ctx;
+    struct test_ctx *test;
+
+    test = (void *) lsquic_conn_get_peer_ctx(lsquic_stream_conn(stream));
+    req->stream = stream;
+    req->conn = lsquic_stream_conn(stream);
+    req->stream_id = lsquic_stream_id(stream);
+    req->order = test->n_streams++;
+    return (lsquic_stream_ctx_t *) req;
+}
+
+
+static void
+test_on_read (lsquic_stream_t *stream, lsquic_stream_ctx_t *h)
+{
+    lsquic_stream_wantread(stream, 0);
+}
+
+
+static void
+test_on_write (lsquic_stream_t *stream, lsquic_stream_ctx_t *h)
+{
+    lsquic_stream_wantwrite(stream, 0);
+}
+
+
+static void
+test_on_close (lsquic_stream_t *stream, lsquic_stream_ctx_t *h)
+{
+    struct test_req *const req = (void *) h;
+    req->stream = NULL;
+    req->closed = 1;
+}
+
+
+static void
+test_on_req_failed (void *req_ctx)
+{
+    struct test_req *const req = req_ctx;
+    req->failed = 1;
+}
+
+
+static void
+test_on_conn_closed (void *ctx, lsquic_conn_t *conn)
+{
+    struct test_ctx *const test = ctx;
+    ++test->n_conn_closed;
+}
+
+
+static const struct cpool_if test_cpool_if = {
+    .cpi_connect            = test_connect,
+    .cpi_schedule           = test_schedule,
+    .cpi_on_new_stream      = test_on_new_stream,
+    .cpi_on_read            = test_on_read,
+    .cpi_on_write           = test_on_write,
+    .cpi_on_close           = test_on_close,
+    .cpi_on_req_failed      = test_on_req_failed,
+    .cpi_on_conn_closed     = test_on_conn_closed,
+};
+
+
+static void
+init_test (struct test_ctx *test, unsigned max_conns, unsigned max_streams)
+{
+    struct lsquic_engine_api api;
+
+    memset(test, 0, sizeof(*test));
+    lsquic_engine_init_settings(&test->settings, 0);
+    test->settings.es_versions = 1 << LSQVER_039;
+    test->peer_sa.sin_family = AF_INET;
+    test->peer_sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    test->peer_sa.sin_port = htons(443);
+    test->next_port = 10000;
+
+    test->srv = fsrv_new();
+    assert(test->srv);
+    cpool_init(&test->pool, &test_cpool_if, test, max_conns, max_streams);
+
+    memset(&api, 0, sizeof(api));
+    api.ea_settings = &test->settings;
+    api.ea_stream_if = &cpool_stream_if;
+    api.ea_stream_if_ctx = &test->pool;
+    api.ea_packets_out = fsrv_packets_out;
+    api.ea_packets_out_ctx = test->srv;
+    lsquic_time_set_clock(test_clock, NULL);
+    test->engine = lsquic_engine_new(0, &api);
+    assert(test->engine);
+    fsrv_set_engine(test->srv, test->engine);
+}
+
+
+static void
+cleanup_test (struct test_ctx *test)
+{
+    lsquic_engine_destroy(test->engine);
+    cpool_cleanup(&test->pool);
+    fsrv_destroy(test->srv);
+    lsquic_time_set_clock(NULL, NULL);
+}
+
+
+static void
+submit (struct test_ctx *test, const char *hostname, unsigned short port,
+                                                                unsigned n)
+{
+    struct sockaddr_in peer_sa;
+    int s;
+
+    peer_sa = test->peer_sa;
+    peer_sa.sin_port = htons(port);
+    s = cpool_submit(&test->pool, hostname, (struct sockaddr *) &peer_sa,
+                                                            &test->reqs[n]);
+    assert(0 == s);
+}
+
+
+/* Process connections, then open the connections the pool could not open
+ * from inside engine callbacks.
+ */
+static void
+process (struct test_ctx *test)
+{
+    lsquic_engine_process_conns(test->engine);
+    if (test->scheduled)
+    {
+        test->scheduled = 0;
+        cpool_process(&test->pool);
+    }
+}
+
+
+/* Move the clock forward a second at a time, letting the server respond
+ * to whatever the clients send.
+ */
+static void
+advance_time (struct test_ctx *test, lsquic_time_t until)
+{
+    while (s_now < until)
+    {
+        s_now += 1000000;
+        process(test);
+        if (fsrv_respond(test->srv))
+            process(test);
+    }
+}
+
+
+static void
+close_req (struct test_ctx *test, unsigned n)
+{
+    assert(test->reqs[n].stream);
+    lsquic_stream_close(test->reqs[n].stream);
+    advance_time(test, s_now + 3000000);
+    assert(test->reqs[n].closed);
+}
+
+
+/* A connection closed outside of engine callbacks is only processed when
+ * it is ticked next, which may take a while.
+ */
+static void
+wait_conns_closed (struct test_ctx *test, unsigned n_closed)
+{
+    const lsquic_time_t deadline = s_now + 30000000;
+
+    while (test->n_conn_closed < n_closed && s_now < deadline)
+        advance_time(test, s_now + 1000000);
+    assert(n_closed == test->n_conn_closed);
+}
+
+
+static void
+deliver_goaway (struct test_ctx *test, lsquic_conn_t *conn,
+                                                uint32_t last_good_stream_id)
+{
+    unsigned char frame[0x40], packet[0x100];
+    int frame_sz, packet_sz, s;
+
+    frame_sz = fsrv_gen_goaway_frame(frame, sizeof(frame),
+                                                        last_good_stream_id);
+    assert(frame_sz > 0);
+    packet_sz = fsrv_gen_packet(test->srv, lsquic_conn_id(conn), 0, frame,
+                                    frame_sz, 1, packet, sizeof(packet));
+    assert(packet_sz > 0);
+    s = fsrv_deliver(test->srv, lsquic_conn_id(conn), packet, packet_sz);
+    assert(0 == s);
+}
+
+
+/* Requests that do not fit into the connection wait in the origin's queue
+ * and are given streams in the order they were submitted.  Requests to
+ * another origin do not wait behind them.
+ */
+static void
+test_queueing (void)
+{
+    struct test_ctx test;
+    unsigned n;
+
+    init_test(&test, 1, 2);
+    for (n = 0; n < 5; ++n)
+        submit(&test, "localhost", 443, n);
+    assert(1 == cpool_n_conns(&test.pool));
+    assert(test.reqs[0].stream && test.reqs[1].stream);
+    assert(test.reqs[0].conn == test.reqs[1].conn);
+    for (n = 2; n < 5; ++n)
+        assert(!test.reqs[n].stream);
+    assert(3 == test.pool.cp_stats.reqs_queued);
+    assert(3 == test.pool.cp_stats.max_queue);
+    advance_time(&test, s_now + 1000000);
+    assert(LSCONN_ST_CONNECTED
+                    == lsquic_conn_status(test.reqs[0].conn, NULL, 0));
+
+    /* Same hostname, different peer address: another origin */
+    submit(&test, "localhost", 444, 5);
+    assert(2 == cpool_n_conns(&test.pool));
+    assert(test.reqs[5].stream);
+    assert(test.reqs[5].conn != test.reqs[0].conn);
+
+    /* As streams close, queued requests are dispatched in order */
+    close_req(&test, 0);
+    assert(test.reqs[2].stream);
+    assert(test.reqs[2].conn == test.reqs[1].conn);
+    assert(!test.reqs[3].stream && !test.reqs[4].stream);
+    close_req(&test, 1);
+    assert(test.reqs[3].stream);
+    assert(!test.reqs[4].stream);
+    close_req(&test, 2);
+    assert(test.reqs[4].stream);
+    assert(test.reqs[2].order < test.reqs[3].order);
+    assert(test.reqs[3].order < test.reqs[4].order);
+
+    assert(2 == cpool_n_conns(&test.pool));
+    assert(2 == test.pool.cp_stats.conns_opened);
+    assert(0 == test.pool.cp_stats.reqs_failed);
+    cleanup_test(&test);
+}
+
+
+/* When the connection runs out of streams, the next request goes to a new
+ * connection.  The limit is either the pool's or the peer's (MIDS), which
+ * the handshake stream counts against.
+ */
+static void
+test_spill_over (unsigned max_streams)
+{
+    struct test_ctx test;
+    unsigned n, limit;
+
+    limit = max_streams ? max_streams : FSRV_MIDS - 1;
+    init_test(&test, 2, max_streams);
+    submit(&test, "localhost", 443, 0);
+    advance_time(&test, s_now + 1000000);
+    assert(LSCONN_ST_CONNECTED
+                    == lsquic_conn_status(test.reqs[0].conn, NULL, 0));
+
+    for (n = 1; n < limit; ++n)
+        submit(&test, "localhost", 443, n);
+    assert(1 == cpool_n_conns(&test.pool));
+    for (n = 1; n < limit; ++n)
+        assert(test.reqs[n].conn == test.reqs[0].conn);
+
+    submit(&test, "localhost", 443, limit);
+    assert(2 == cpool_n_conns(&test.pool));
+    assert(test.reqs[limit].stream);
+    assert(test.reqs[limit].conn != test.reqs[0].conn);
+    assert(0 == test.pool.cp_stats.reqs_queued);
+
+    /* New requests go to the least loaded connection until both are
+     * full.  Then they are queued, as there can be no more connections.
+     */
+    for (n = limit + 1; n < 2 * limit; ++n)
+    {
+        submit(&test, "localhost", 443, n);
+        assert(test.reqs[n].conn == test.reqs[limit].conn);
+    }
+    submit(&test, "localhost", 443, 2 * limit);
+    assert(!test.reqs[2 * limit].stream);
+    assert(2 == cpool_n_conns(&test.pool));
+    assert(1 == test.pool.cp_stats.reqs_queued);
+
+    close_req(&test, 0);
+    assert(test.reqs[2 * limit].stream);
+    assert(test.reqs[2 * limit].conn == test.reqs[0].conn);
+
+    cleanup_test(&test);
+}
+
+
+/* A connection whose peer sent GOAWAY takes no new requests.  Requests
+ * queued for the origin go to a new connection; since GOAWAY arrives
+ * inside an engine callback, the connection is opened by cpool_process().
+ * The retired connection is closed when its last stream closes.
+ */
+static void
+test_goaway (void)
+{
+    struct test_ctx test;
+    lsquic_conn_t *conn;
+    unsigned n;
+
+    init_test(&test, 1, 2);
+    for (n = 0; n < 3; ++n)
+        submit(&test, "localhost", 443, n);
+    advance_time(&test, s_now + 1000000);
+    conn = test.reqs[0].conn;
+    assert(LSCONN_ST_CONNECTED == lsquic_conn_status(conn, NULL, 0));
+    assert(test.reqs[1].conn == conn);
+    assert(!test.reqs[2].stream);
+
+    deliver_goaway(&test, conn, test.reqs[1].stream_id);
+    lsquic_engine_process_conns(test.engine);
+    assert(1 == test.pool.cp_stats.conns_retired);
+    assert(test.scheduled);
+    assert(!test.reqs[2].stream);
+    test.scheduled = 0;
+    cpool_process(&test.pool);
+    assert(2 == cpool_n_conns(&test.pool));
+    assert(test.reqs[2].stream);
+    assert(test.reqs[2].conn != conn);
+
+    /* The retired connection does not take new requests */
+    submit(&test, "localhost", 443, 3);
+    assert(test.reqs[3].conn == test.reqs[2].conn);
+
+    close_req(&test, 0);
+    assert(2 == cpool_n_conns(&test.pool));
+    assert(0 == test.n_conn_closed);
+    close_req(&test, 1);
+    wait_conns_closed(&test, 1);
+    assert(1 == cpool_n_conns(&test.pool));
+    assert(0 == test.pool.cp_stats.conns_failed);
+
+    cleanup_test(&test);
+}
+
+
+/* cpool_retire() drains all connections: idle ones are closed right away
+ * and busy ones once their last stream closes.  No new connections are
+ * opened, so new requests wait.
+ */
+static void
+test_retire (void)
+{
+    struct test_ctx test;
+    unsigned n;
+
+    init_test(&test, 2, 1);
+    for (n = 0; n < 2; ++n)
+        submit(&test, "localhost", 443, n);
+    assert(2 == cpool_n_conns(&test.pool));
+    advance_time(&test, s_now + 1000000);
+    close_req(&test, 1);
+
+    cpool_retire(&test.pool);
+    assert(2 == test.pool.cp_stats.conns_retired);
+    wait_conns_closed(&test, 1);
+    assert(1 == cpool_n_conns(&test.pool));
+
+    /* The draining connection takes no new requests */
+    submit(&test, "localhost", 443, 2);
+    assert(!test.reqs[2].stream);
+    assert(1 == cpool_n_conns(&test.pool));
+
+    close_req(&test, 0);
+    wait_conns_closed(&test, 2);
+    assert(0 == cpool_n_conns(&test.pool));
+    assert(!test.reqs[2].stream);
+    assert(!test.reqs[2].failed);
+
+    cleanup_test(&test);
+}
+
+
+int
+main (void)
+{
+    if (0 != lsquic_global_init(LSQUIC_GLOBAL_CLIENT))
+        return 1;
+    fsrv_install();
+
+    test_queueing();
+    test_spill_over(2);
+    test_spill_over(0);
+    test_goaway();
+    test_retire();
+
+    lsquic_global_cleanup();
+    return 0;
+}
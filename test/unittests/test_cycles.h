@@ -0,0 +1,41 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_cycles.h -- Cycle counter used by benchmarks.
+ *
+ * Where there is no cycle counter, nanoseconds are counted instead.
+ */
+
+#ifndef TEST_CYCLES_H
+#define TEST_CYCLES_H 1
+
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+#define CYCLES_UNIT "cycle"
+
+static inline uint64_t
+get_cycles (void)
+{
+    return __rdtsc();
+}
+
+
+#else
+#include <time.h>
+
+#define CYCLES_UNIT "ns"
+
+static inline uint64_t
+get_cycles (void)
+{
+    struct timespec ts;
+    (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+#endif
+
+#endif
@@ -4,6 +4,7 @@
  */
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/queue.h>
@@ -261,6 +262,7 @@ run_di_nocopy_test (const struct nocopy_test *test)
 
     lsquic_mm_init(&mm);
     memset(&conn, 0, sizeof(conn));
+    memset(&conn_pub, 0, sizeof(conn_pub));
     conn_pub.lconn = &conn;
     conn_pub.mm = &mm;
 
@@ -306,6 +308,88 @@ run_di_nocopy_test (const struct nocopy_test *test)
 }
 
 
+/* Small frames, each in a packet of its own, are copied into shared
+ * buffers and the packets are released.
+ */
+static void
+test_compaction (void)
+{
+    struct lsquic_mm mm;
+    struct lsquic_conn_public conn_pub;
+    struct lsquic_conn conn;
+    struct lsquic_packet_in *packet_in;
+    struct stream_frame *frame;
+    struct data_in *di;
+    struct data_frame *data_frame = NULL;
+    enum ins_frame ins;
+    const unsigned frame_sz = 200, n_frames = 8;
+    unsigned i, j;
+    uint64_t read_off;
+
+    lsquic_mm_init(&mm);
+    memset(&conn, 0, sizeof(conn));
+    memset(&conn_pub, 0, sizeof(conn_pub));
+    conn_pub.lconn = &conn;
+    conn_pub.mm = &mm;
+
+    di = data_in_nocopy_new(&conn_pub, 3);
+
+    /* Frame at offset zero is missing, so nothing can be read */
+    for (i = 0; i <= n_frames; ++i)
+    {
+        packet_in = lsquic_mm_get_packet_in(&mm);
+        packet_in->pi_data = lsquic_mm_get_1370(&mm);
+        packet_in->pi_data_sz = 1370;
+        packet_in->pi_flags = PI_OWN_DATA;
+        packet_in->pi_refcnt = 1;
+        for (j = 0; j < frame_sz; ++j)
+            packet_in->pi_data[500 + j] = (unsigned char) (i * frame_sz + j);
+        frame = lsquic_malo_get(mm.malo.stream_frame);
+        frame->packet_in = packet_in;
+        frame->data_frame = (struct data_frame) F(i * frame_sz, frame_sz, 0);
+        frame->data_frame.df_data = packet_in->pi_data + 500;
+        if (i == 0)
+        {
+            data_frame = &frame->data_frame;
+            continue;
+        }
+        ins = di->di_if->di_insert_frame(di, frame, 0);
+        assert(INS_FRAME_OK == ins);
+        assert(!(di->di_flags & DI_SWITCH_IMPL));
+        assert(conn_pub.in_useful == i * frame_sz);
+    }
+
+    /* All frames have been copied into two shared buffers.  The third
+     * buffer belongs to the packet that has not been inserted yet.
+     */
+    assert(conn_pub.in_pinned == n_frames * frame_sz);
+    assert(3 == lsquic_mm_pool_stats(&mm, MM_POOL_1370)->mps_in_use);
+    assert(di->di_if->di_mem_used(di) < 2 * 1370);
+
+    frame = (struct stream_frame *) ((unsigned char *) data_frame
+                                - offsetof(struct stream_frame, data_frame));
+    ins = di->di_if->di_insert_frame(di, frame, 0);
+    assert(INS_FRAME_OK == ins);
+
+    read_off = 0;
+    while ((data_frame = di->di_if->di_get_frame(di, read_off)))
+    {
+        for (j = 0; j < data_frame->df_size; ++j)
+            assert(data_frame->df_data[j] == (unsigned char) (read_off + j));
+        read_off += data_frame->df_size;
+        data_frame->df_read_off = data_frame->df_size;
+        di->di_if->di_frame_done(di, data_frame);
+    }
+    assert(read_off == (n_frames + 1) * frame_sz);
+    assert(0 == conn_pub.in_pinned);
+    assert(0 == conn_pub.in_useful);
+
+    di->di_if->di_destroy(di);
+    assert(0 == lsquic_mm_pool_stats(&mm, MM_POOL_1370)->mps_in_use);
+    lsquic_mm_cleanup(&mm);
+}
+
+
 int
 main (int argc, char **argv)
 {
@@ -329,5 +413,7 @@ main (int argc, char **argv)
     for (test = tests; test < tests + sizeof(tests) / sizeof(tests[0]); ++test)
         run_di_nocopy_test(test);
 
+    test_compaction();
+
     return 0;
 }
@@ -609,6 +609,84 @@ static const struct frame_reader_test tests[] = {
         },
     },
 
+    /* Header field is split between HEADERS and CONTINUATION frames */
+    {   .frt_lineno = __LINE__,
+        .frt_fr_flags = FRF_SERVER,
+        .frt_buf    = {
+            /* Length: */       0x00, 0x00, 0x0C,
+            /* Type: */         0x01,
+            /* Flags: */        HFHF_PRIORITY,
+            /* Stream Id: */    0x00, 0x00, 0x30, 0x39,
+            /* Exclusive: */    0x00|
+            /* Dep Stream Id: */
+                                0x00, 0x00, 0x12, 0x34,
+            /* Weight: */       0x00,
+            /* Block fragment: */
+                                0x82, 0x84, 0x86, 0x41, 0x8c, 0xf1, 0xe3,
+            /* Length: */       0x00, 0x00, 0x0A,
+            /* Type: */         HTTP_FRAME_CONTINUATION,
+            /* Flags: */        HFHF_END_HEADERS,
+            /* Stream Id: */    0x00, 0x00, 0x30, 0x39,
+            /* Block fragment: */
+                                0xc2, 0xe5, 0xf2, 0x3a, 0x6b, 0xa0, 0xab, 0x90,
+                                0xf4, 0xff,
+        },
+        .frt_bufsz  = 9 + 5 + 7
+                    + 9 + 0 + 10,
+        .frt_n_cb_vals = 1,
+        .frt_cb_vals = {
+            {
+                .type = CV_HEADERS,
+                .u.headers = {
+                    .stream_id       = 12345,
+                    .oth_stream_id   = 0x1234,
+                    .weight          = 1,
+                    .exclusive       = 0,
+                    .off             = 0,
+                    .flags           = UH_H1H,
+                    HEADERS("GET / HTTP/1.1\r\nHost: www.example.com\r\n\r\n"),
+                },
+            },
+        },
+    },
+
+    /* Header block ends in the middle of a header field */
+    {   .frt_lineno = __LINE__,
+        .frt_fr_flags = FRF_SERVER,
+        .frt_buf    = {
+            /* Length: */       0x00, 0x00, 0x0C,
+            /* Type: */         0x01,
+            /* Flags: */        HFHF_PRIORITY,
+            /* Stream Id: */    0x00, 0x00, 0x30, 0x39,
+            /* Exclusive: */    0x00|
+            /* Dep Stream Id: */
+                                0x00, 0x00, 0x12, 0x34,
+            /* Weight: */       0x00,
+            /* Block fragment: */
+                                0x82, 0x84, 0x86, 0x41, 0x8c, 0xf1, 0xe3,
+            /* Length: */       0x00, 0x00, 0x09,
+            /* Type: */         HTTP_FRAME_CONTINUATION,
+            /* Flags: */        HFHF_END_HEADERS,
+            /* Stream Id: */    0x00, 0x00, 0x30, 0x39,
+            /* Block fragment: */
+                                0xc2, 0xe5, 0xf2, 0x3a, 0x6b, 0xa0, 0xab, 0x90,
+                                0xf4,
+        },
+        .frt_bufsz  = 9 + 5 + 7
+                    + 9 + 0 + 9,
+        .frt_n_cb_vals = 1,
+        .frt_cb_vals = {
+            {
+                .type = CV_ERROR,
+                .stream_off = 9 + 5 + 7 + 9 + 9,
+                .u.error = {
+                    .stream_id  = 0x3039,
+                    .code       = FR_ERR_DECOMPRESS,
+                },
+            },
+        },
+    },
+
     {   .frt_lineno = __LINE__,
         .frt_fr_flags = FRF_SERVER,
         .frt_buf    = {
@@ -14,6 +14,7 @@
 #include "lsquic_mm.h"
 #include "lsquic_frame_common.h"
 #include "lsquic_frame_writer.h"
+#include "lsquic_hdr_tmpl.h"
 #if LSQUIC_CONN_STATS
 #include "lsquic_int_types.h"
 #include "lsquic_conn.h"
@@ -596,6 +597,158 @@ perl tools/hpack.pl :method GET :path /index.html :authority www.example.com :sc
 }
 
 
+/* Decode HEADERS frame in `output' and compare headers to `exp' */
+static void
+check_decoded_headers (struct lshpack_dec *hdec,
+                       const struct lsquic_http_header *exp, unsigned n_exp)
+{
+    struct http_frame_header fh;
+    const unsigned char *p, *end;
+    char out[0x100];
+    lshpack_strlen_t name_len, val_len;
+    uint32_t name_idx;
+    unsigned n;
+    int s;
+
+    memcpy(&fh, output.buf, sizeof(fh));
+    assert(HTTP_FRAME_HEADERS == fh.hfh_type);
+    assert(sizeof(fh) + hfh_get_length(&fh) == output.sz);
+    p = output.buf + sizeof(fh);
+    end = output.buf + output.sz;
+    for (n = 0; p < end; ++n)
+    {
+        s = lshpack_dec_decode(hdec, &p, end, out, out + sizeof(out),
+                                            &name_len, &val_len, &name_idx);
+        assert(0 == s);
+        assert(n < n_exp);
+        assert(name_len == exp[n].name.iov_len);
+        assert(0 == memcmp(out, exp[n].name.iov_base, name_len));
+        assert(val_len == exp[n].value.iov_len);
+        assert(0 == memcmp(out + name_len, exp[n].value.iov_base, val_len));
+    }
+    assert(n == n_exp);
+}
+
+
+static void
+test_header_template (void)
+{
+    struct lshpack_enc henc;
+    struct lshpack_dec hdec;
+    struct lsquic_frame_writer *fw;
+    struct lsquic_hdr_tmpl *tmpl;
+    unsigned char prev[sizeof(output.buf)];
+    unsigned i;
+    int s;
+    struct lsquic_mm mm;
+
+    struct lsquic_http_header tmpl_arr[] =
+    {
+        { .name = IOV(":status"), .value = IOV("200") },
+        { .name = IOV("content-type"), .value = IOV("text/html") },
+        { .name = IOV("server"), .value = IOV("lsquic") },
+        { .name = IOV("x-template"), .value = IOV("some-value") },
+    };
+    struct lsquic_http_headers tmpl_headers = { 4, tmpl_arr, };
+
+    struct lsquic_http_header var_arr[] =
+    {
+        { .name = IOV(":x-pseudo"), .value = IOV("abc") },
+        { .name = IOV("content-length"), .value = IOV("1234") },
+    };
+    struct lsquic_http_headers var_headers = { 2, var_arr, };
+
+    /* Order on the wire */
+    struct lsquic_http_header exp[] =
+    {
+        tmpl_arr[0], var_arr[0], tmpl_arr[1], tmpl_arr[2], tmpl_arr[3],
+        var_arr[1],
+    };
+
+    struct lsquic_http_header other_arr[] =
+    {
+        { .name = IOV(":status"), .value = IOV("404") },
+        { .name = IOV("x-other"), .value = IOV("adds to dynamic table") },
+    };
+    struct lsquic_http_headers other_headers = { 2, other_arr, };
+
+    lshpack_enc_init(&henc);
+    lshpack_dec_init(&hdec);
+    lsquic_mm_init(&mm);
+    fw = lsquic_frame_writer_new(&mm, NULL, 0x200, &henc, output_write,
+#if LSQUIC_CONN_STATS
+                                     &s_conn_stats,
+#endif
+                                1);
+
+    tmpl = lsquic_hdr_tmpl_new(&tmpl_headers);
+    assert(tmpl);
+
+    for (i = 0; i < 4; ++i)
+    {
+        reset_output(0);
+        var_arr[1].value.iov_base = i & 1 ? "1" : "1234";
+        var_arr[1].value.iov_len = i & 1 ? 1 : 4;
+        exp[5] = var_arr[1];
+        s = lsquic_frame_writer_write_headers_tmpl(fw, 1 + i * 2, tmpl,
+                                                    &var_headers, 0, 16);
+        assert(0 == s);
+        check_decoded_headers(&hdec, exp, 6);
+        /* The first time, template headers are added to the dynamic
+         * table.  After that, the table stays the same.
+         */
+        assert((i > 0) == (tmpl->ht_henc == &henc));
+        if (i > 1)
+            assert(0 == memcmp(prev + sizeof(struct http_frame_header),
+                               output.buf + sizeof(struct http_frame_header),
+                               tmpl->ht_enc_pseudo_sz));
+        memcpy(prev, output.buf, output.sz);
+    }
+
+    /* A change to the dynamic table invalidates encoded template */
+    reset_output(0);
+    s = lsquic_frame_writer_write_headers(fw, 9, &other_headers, 0, 16);
+    assert(0 == s);
+    check_decoded_headers(&hdec, other_arr, 2);
+    reset_output(0);
+    s = lsquic_frame_writer_write_headers_tmpl(fw, 11, tmpl, &var_headers,
+                                                                    1, 16);
+    assert(0 == s);
+    check_decoded_headers(&hdec, exp, 6);
+    assert(tmpl->ht_henc == &henc);
+
+    /* No varying headers */
+    reset_output(0);
+    s = lsquic_frame_writer_write_headers_tmpl(fw, 13, tmpl, NULL, 1, 16);
+    assert(0 == s);
+    check_decoded_headers(&hdec, tmpl_arr, 4);
+
+    /* Pseudo-header after regular header */
+    var_arr[0] = var_arr[1];
+    var_arr[1] = tmpl_arr[0];
+    reset_output(0);
+    s = lsquic_frame_writer_write_headers_tmpl(fw, 15, tmpl, &var_headers,
+                                                                    1, 16);
+    assert(-1 == s);
+    assert(EINVAL == errno);
+    assert(0 == output.sz);
+
+    lsquic_hdr_tmpl_destroy(tmpl);
+
+    /* Invalid templates */
+    tmpl_arr[3].name = (struct iovec) IOV("X-Template");
+    tmpl = lsquic_hdr_tmpl_new(&tmpl_headers);
+    assert(!tmpl && EINVAL == errno);
+    tmpl_arr[3] = tmpl_arr[0];
+    tmpl = lsquic_hdr_tmpl_new(&tmpl_headers);
+    assert(!tmpl && EINVAL == errno);
+
+    lsquic_frame_writer_destroy(fw);
+    lshpack_enc_cleanup(&henc);
+    lshpack_dec_cleanup(&hdec);
+    lsquic_mm_cleanup(&mm);
+}
+
 
 int
 main (void)
@@ -609,5 +762,6 @@ main (void)
     test_push_promise();
     test_errors();
     test_max_frame_size();
+    test_header_template();
     return 0;
 }
@@ -0,0 +1,645 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_full_conn.c -- Test client connections end to end.
+ *
+ * Connections are created by a real engine.  The server on the other end
+ * is the fake server (see fake_server.h), which lets the tests build
+ * packets with arbitrary frames and deliver them in any order.  Time is
+ * virtual.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#else
+#include <Windows.h>
+#include <WinSock2.h>
+#include <ws2ipdef.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_int_types.h"
+#include "lsquic_types.h"
+#include "lsquic_conn.h"
+#include "lsquic_util.h"
+#include "fake_server.h"
+
+
+static lsquic_time_t s_now = 1000000;
+
+
+static lsquic_time_t
+test_clock (void *ctx)
+{
+    return s_now;
+}
+
+
+struct test_ctx
+{
+    struct lsquic_engine_settings   settings;
+    struct fsrv                    *srv;
+    lsquic_engine_t                *engine;
+    struct sockaddr_in              local_sa,
+                                    peer_sa;
+    lsquic_conn_t                  *conn;
+    int                             hsk_ok;     /* -1: not called */
+    unsigned                        n_new_conn,
+                                    n_hsk_done,
+                                    n_conn_closed;
+    lsquic_stream_t                *stream;
+    char                            data[0x100];
+    size_t                          data_sz;
+    int                             fin;
+};
+
+
+static lsquic_conn_ctx_t *
+on_new_conn (void *stream_if_ctx, lsquic_conn_t *conn)
+{
+    struct test_ctx *const test = stream_if_ctx;
+    test->conn = conn;
+    ++test->n_new_conn;
+    return (lsquic_conn_ctx_t *) test;
+}
+
+
+static void
+on_conn_closed (lsquic_conn_t *conn)
+{
+    struct test_ctx *const test = (void *) lsquic_conn_get_ctx(conn);
+    ++test->n_conn_closed;
+    test->conn = NULL;
+    lsquic_conn_set_ctx(conn, NULL);
+}
+
+
+static void
+on_hsk_done (lsquic_conn_t *conn, int ok)
+{
+    struct test_ctx *const test = (void *) lsquic_conn_get_ctx(conn);
+    test->hsk_ok = ok;
+    ++test->n_hsk_done;
+}
+
+
+static lsquic_stream_ctx_t *
+on_new_stream (void *stream_if_ctx, lsquic_stream_t *stream)
+{
+    struct test_ctx *const test = stream_if_ctx;
+    test->stream = stream;
+    lsquic_stream_wantread(stream, 1);
+    return (lsquic_stream_ctx_t *) test;
+}
+
+
+static void
+on_read (lsquic_stream_t *stream, lsquic_stream_ctx_t *h)
+{
+    struct test_ctx *const test = (void *) h;
+    ssize_t nr;
+
+    nr = lsquic_stream_read(stream, test->data + test->data_sz,
+                                    sizeof(test->data) - test->data_sz);
+    assert(nr >= 0);
+    if (nr > 0)
+        test->data_sz += nr;
+    else
+    {
+        test->fin = 1;
+        lsquic_stream_wantread(stream, 0);
+    }
+}
+
+
+static void
+on_write (lsquic_stream_t *stream, lsquic_stream_ctx_t *h)
+{
+    lsquic_stream_wantwrite(stream, 0);
+}
+
+
+static void
+on_close (lsquic_stream_t *stream, lsquic_stream_ctx_t *h)
+{
+    struct test_ctx *const test = (void *) h;
+    test->stream = NULL;
+}
+
+
+static const struct lsquic_stream_if stream_if = {
+    .on_new_conn            = on_new_conn,
+    .on_conn_closed         = on_conn_closed,
+    .on_new_stream          = on_new_stream,
+    .on_read                = on_read,
+    .on_write               = on_write,
+    .on_close               = on_close,
+    .on_hsk_done            = on_hsk_done,
+};
+
+
+/* Settings can be modified between init_test() and start_test() */
+static void
+init_test (struct test_ctx *test)
+{
+    memset(test, 0, sizeof(*test));
+    lsquic_engine_init_settings(&test->settings, 0);
+    test->settings.es_versions = 1 << LSQVER_039;
+    test->hsk_ok = -1;
+
+    test->local_sa.sin_family = AF_INET;
+    test->local_sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    test->local_sa.sin_port = htons(12345);
+    test->peer_sa.sin_family = AF_INET;
+    test->peer_sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    test->peer_sa.sin_port = htons(443);
+}
+
+
+static void
+start_test (struct test_ctx *test)
+{
+    struct lsquic_engine_api api;
+
+    test->srv = fsrv_new();
+    assert(test->srv);
+
+    memset(&api, 0, sizeof(api));
+    api.ea_settings = &test->settings;
+    api.ea_stream_if = &stream_if;
+    api.ea_stream_if_ctx = test;
+    api.ea_packets_out = fsrv_packets_out;
+    api.ea_packets_out_ctx = test->srv;
+    lsquic_time_set_clock(test_clock, NULL);
+    test->engine = lsquic_engine_new(0, &api);
+    assert(test->engine);
+    fsrv_set_engine(test->srv, test->engine);
+}
+
+
+static void
+cleanup_test (struct test_ctx *test)
+{
+    lsquic_engine_destroy(test->engine);
+    fsrv_destroy(test->srv);
+    lsquic_time_set_clock(NULL, NULL);
+}
+
+
+/* Move the clock forward a second at a time, letting the server respond
+ * to whatever the client sends.
+ */
+static void
+advance_time (struct test_ctx *test, lsquic_time_t until)
+{
+    while (s_now < until)
+    {
+        s_now += 1000000;
+        lsquic_engine_process_conns(test->engine);
+        if (fsrv_respond(test->srv))
+            lsquic_engine_process_conns(test->engine);
+    }
+}
+
+
+static void
+connect_and_handshake (struct test_ctx *test)
+{
+    lsquic_conn_t *conn;
+
+    conn = lsquic_engine_connect(test->engine,
+            (struct sockaddr *) &test->local_sa,
+            (struct sockaddr *) &test->peer_sa, test, NULL, "localhost", 0);
+    assert(conn);
+    assert(conn == test->conn);
+    lsquic_engine_process_conns(test->engine);
+    assert(fsrv_n_packets_in(test->srv, lsquic_conn_id(conn)) > 0);
+    assert(1 == fsrv_respond(test->srv));
+    lsquic_engine_process_conns(test->engine);
+    assert(1 == test->hsk_ok);
+}
+
+
+static void
+deliver_stream_frame (struct test_ctx *test, uint32_t stream_id,
+        uint64_t offset, int fin, const char *data, int decryptable,
+        unsigned char *packet, int *packet_sz)
+{
+    unsigned char frame[0x100];
+    int frame_sz;
+
+    frame_sz = fsrv_gen_stream_frame(frame, sizeof(frame), stream_id,
+                                        offset, fin, data, strlen(data));
+    assert(frame_sz > 0);
+    *packet_sz = fsrv_gen_packet(test->srv, lsquic_conn_id(test->conn), 0,
+                    frame, frame_sz, decryptable, packet, 0x200);
+    assert(*packet_sz > 0);
+}
+
+
+/* Packets are parsed in the next tick, in the order they were received.
+ * Frames from packets that arrived out of order are reassembled; a packet
+ * that cannot be decrypted is dropped without affecting the others.
+ */
+static void
+test_out_of_order (int n_ticks)
+{
+    struct test_ctx test;
+    unsigned char packets[4][0x200];
+    int sizes[4], s;
+    lsquic_cid_t cid;
+    uint32_t stream_id;
+
+    init_test(&test);
+    start_test(&test);
+    connect_and_handshake(&test);
+    cid = lsquic_conn_id(test.conn);
+
+    lsquic_conn_make_stream(test.conn);
+    lsquic_engine_process_conns(test.engine);
+    assert(test.stream);
+    stream_id = lsquic_stream_id(test.stream);
+
+    deliver_stream_frame(&test, stream_id, 0, 0, "Hello, ", 1,
+                                                    packets[0], &sizes[0]);
+    deliver_stream_frame(&test, stream_id, 7, 0, "world", 1,
+                                                    packets[1], &sizes[1]);
+    deliver_stream_frame(&test, stream_id, 7, 0, "WORLD", 0,
+                                                    packets[2], &sizes[2]);
+    deliver_stream_frame(&test, stream_id, 12, 1, "!", 1,
+                                                    packets[3], &sizes[3]);
+
+    s = fsrv_deliver(test.srv, cid, packets[3], sizes[3]);
+    assert(0 == s);
+    s = fsrv_deliver(test.srv, cid, packets[2], sizes[2]);
+    assert(0 == s);
+    if (n_ticks > 1)
+    {
+        lsquic_engine_process_conns(test.engine);
+        assert(0 == test.data_sz);
+    }
+    s = fsrv_deliver(test.srv, cid, packets[1], sizes[1]);
+    assert(0 == s);
+    s = fsrv_deliver(test.srv, cid, packets[0], sizes[0]);
+    assert(0 == s);
+    lsquic_engine_process_conns(test.engine);
+
+    assert(13 == test.data_sz);
+    assert(0 == memcmp(test.data, "Hello, world!", 13));
+    assert(test.fin);
+    assert(LSCONN_ST_CONNECTED == lsquic_conn_status(test.conn, NULL, 0));
+
+    /* Duplicate is ignored */
+    s = fsrv_deliver(test.srv, cid, packets[1], sizes[1]);
+    assert(0 == s);
+    lsquic_engine_process_conns(test.engine);
+    assert(LSCONN_ST_CONNECTED == lsquic_conn_status(test.conn, NULL, 0));
+
+    cleanup_test(&test);
+}
+
+
+static void
+preconnect (struct test_ctx *test)
+{
+    int s;
+
+    s = lsquic_engine_preconnect(test->engine,
+            (struct sockaddr *) &test->local_sa,
+            (struct sockaddr *) &test->peer_sa, test, "localhost", 0);
+    assert(0 == s);
+    lsquic_engine_process_conns(test->engine);
+}
+
+
+/* No callbacks are called until the connection is claimed.  Claiming it
+ * replays on_hsk_done if the handshake has already completed.
+ */
+static void
+test_preconn_claim (int hsk_done_first)
+{
+    struct test_ctx test;
+    lsquic_conn_t *conn;
+    struct sockaddr_in other_sa;
+
+    init_test(&test);
+    start_test(&test);
+    preconnect(&test);
+    if (hsk_done_first)
+    {
+        assert(1 == fsrv_respond(test.srv));
+        lsquic_engine_process_conns(test.engine);
+    }
+    assert(0 == test.n_new_conn);
+    assert(0 == test.n_hsk_done);
+
+    conn = lsquic_engine_take_preconn(test.engine,
+                    (struct sockaddr *) &test.peer_sa, NULL, "example.com");
+    assert(!conn);
+    other_sa = test.peer_sa;
+    other_sa.sin_port = htons(444);
+    conn = lsquic_engine_take_preconn(test.engine,
+                    (struct sockaddr *) &other_sa, NULL, "localhost");
+    assert(!conn);
+
+    conn = lsquic_engine_take_preconn(test.engine,
+                    (struct sockaddr *) &test.peer_sa, NULL, "localhost");
+    assert(conn);
+    assert(conn == test.conn);
+    assert(1 == test.n_new_conn);
+    if (hsk_done_first)
+    {
+        assert(1 == test.n_hsk_done);
+        assert(1 == test.hsk_ok);
+    }
+    else
+    {
+        assert(0 == test.n_hsk_done);
+        assert(1 == fsrv_respond(test.srv));
+        lsquic_engine_process_conns(test.engine);
+        assert(1 == test.n_hsk_done);
+        assert(1 == test.hsk_ok);
+    }
+
+    /* Only claimed once */
+    assert(!lsquic_engine_take_preconn(test.engine,
+                    (struct sockaddr *) &test.peer_sa, NULL, "localhost"));
+
+    /* Now it is like any other connection */
+    lsquic_conn_close(conn);
+    advance_time(&test, s_now + 3000000);
+    assert(1 == test.n_conn_closed);
+    assert(1 == test.n_hsk_done);
+
+    cleanup_test(&test);
+}
+
+
+/* Unclaimed connection is kept alive using PINGs for es_preconn_keepalive
+ * microseconds; after that, it times out without calling any callbacks.
+ */
+static void
+test_preconn_expiry (int claim)
+{
+    struct test_ctx test;
+    lsquic_conn_t *conn;
+    lsquic_time_t start;
+    int diff;
+
+    init_test(&test);
+    test.settings.es_preconn_keepalive = 40 * 1000 * 1000;
+    start_test(&test);
+    start = s_now;
+    preconnect(&test);
+    assert(1 == fsrv_respond(test.srv));
+    lsquic_engine_process_conns(test.engine);
+
+    /* The connection outlives the idle timeout thanks to PINGs */
+    assert(test.settings.es_preconn_keepalive
+                                        > test.settings.es_idle_conn_to);
+    advance_time(&test, start + test.settings.es_preconn_keepalive);
+    assert(0 == test.n_new_conn);
+
+    if (claim)
+    {
+        conn = lsquic_engine_take_preconn(test.engine,
+                    (struct sockaddr *) &test.peer_sa, NULL, "localhost");
+        assert(conn);
+        assert(1 == test.n_new_conn);
+        assert(1 == test.n_hsk_done);
+        assert(LSCONN_ST_CONNECTED == lsquic_conn_status(conn, NULL, 0));
+        lsquic_conn_close(conn);
+        advance_time(&test, s_now + 3000000);
+        assert(1 == test.n_conn_closed);
+    }
+    else
+    {
+        /* PINGs stop and the connection times out */
+        advance_time(&test, start + test.settings.es_preconn_keepalive
+                                + 2 * test.settings.es_idle_conn_to);
+        assert(!lsquic_engine_take_preconn(test.engine,
+                    (struct sockaddr *) &test.peer_sa, NULL, "localhost"));
+        assert(0 == test.n_new_conn);
+        assert(0 == test.n_hsk_done);
+        assert(0 == test.n_conn_closed);
+        assert(0 == lsquic_engine_earliest_adv_tick(test.engine, &diff));
+    }
+
+    cleanup_test(&test);
+}
+
+
+static void
+get_mem_report (lsquic_conn_t *conn, struct lsquic_conn_mem_report *report)
+{
+    int s;
+
+    s = lsquic_conn_get_mem_report(conn, report);
+    assert(0 == s);
+    assert(report->cmr_total == report->cmr_conn + report->cmr_send_ctl
+        + report->cmr_rechist + report->cmr_closed_streams
+        + report->cmr_stream_hist + report->cmr_packet_objs
+        + report->cmr_stream_hash + report->cmr_streams
+        + report->cmr_headers + report->cmr_handshake);
+}
+
+
+/* With es_compact, the connection does not have its own packet pool and
+ * it releases handshake state once it goes quiet after the handshake.
+ */
+static void
+test_mem_report (int compact)
+{
+    struct test_ctx test;
+    struct lsquic_conn_mem_report before, after;
+    lsquic_conn_t *conn;
+
+    init_test(&test);
+    test.settings.es_compact = compact;
+    start_test(&test);
+
+    conn = lsquic_engine_connect(test.engine,
+            (struct sockaddr *) &test.local_sa,
+            (struct sockaddr *) &test.peer_sa, &test, NULL, "localhost", 0);
+    assert(conn);
+    get_mem_report(conn, &before);
+    assert(FSRV_HSK_MEM_FULL == before.cmr_handshake);
+    assert(before.cmr_conn > 0);
+    assert(before.cmr_stream_hash > 0);
+    assert(before.cmr_streams > 0);     /* Handshake stream */
+    if (compact)
+        assert(0 == before.cmr_packet_objs);
+    else
+        assert(before.cmr_packet_objs > 0);
+
+    lsquic_engine_process_conns(test.engine);
+    assert(1 == fsrv_respond(test.srv));
+    lsquic_engine_process_conns(test.engine);
+    assert(1 == test.hsk_ok);
+    advance_time(&test, s_now + 2000000);
+
+    get_mem_report(conn, &after);
+    if (compact)
+    {
+        assert(FSRV_HSK_MEM_COMPACT == after.cmr_handshake);
+        assert(0 == after.cmr_packet_objs);
+        assert(after.cmr_total < before.cmr_total);
+    }
+    else
+    {
+        assert(FSRV_HSK_MEM_FULL == after.cmr_handshake);
+        assert(after.cmr_packet_objs > 0);
+    }
+
+    cleanup_test(&test);
+}
+
+
+/* Only full connections can report memory use */
+static void
+test_mem_report_other_conn (void)
+{
+    static const struct conn_iface other_iface;
+    struct lsquic_conn lconn;
+    struct lsquic_conn_mem_report report;
+    int s;
+
+    memset(&lconn, 0, sizeof(lconn));
+    lconn.cn_if = &other_iface;
+    s = lsquic_conn_get_mem_report(&lconn, &report);
+    assert(-1 == s);
+}
+
+
+/* Hibernating connection has no stream hash */
+static int
+is_hibernating (lsquic_conn_t *conn)
+{
+    struct lsquic_conn_mem_report report;
+
+    get_mem_report(conn, &report);
+    return 0 == report.cmr_stream_hash;
+}
+
+
+enum wake_by { WAKE_PACKET, WAKE_PING, WAKE_MAKE_STREAM, WAKE_CLOSE, };
+
+
+/* Idle connection hibernates after es_hibernate_after and uses less
+ * memory.  It wakes up when a packet arrives or a PING is due -- and goes
+ * back to sleep when quiet -- or when it is used.
+ */
+static void
+test_hibernate (enum wake_by wake_by)
+{
+    struct test_ctx test;
+    struct lsquic_conn_mem_report awake, asleep;
+    unsigned char frame[0x10], packet[0x100];
+    lsquic_time_t start;
+    unsigned n_packets, n_avail;
+    lsquic_cid_t cid;
+    int sz;
+
+    init_test(&test);
+    test.settings.es_hibernate_after = 5 * 1000 * 1000;
+    start_test(&test);
+    connect_and_handshake(&test);
+    cid = lsquic_conn_id(test.conn);
+    start = s_now;
+
+    get_mem_report(test.conn, &awake);
+    assert(!is_hibernating(test.conn));
+    n_avail = lsquic_conn_n_avail_streams(test.conn);
+    assert(n_avail > 0);
+    advance_time(&test, start + test.settings.es_hibernate_after + 2000000);
+    assert(is_hibernating(test.conn));
+    get_mem_report(test.conn, &asleep);
+    assert(asleep.cmr_total < awake.cmr_total);
+    assert(0 == asleep.cmr_packet_objs);
+
+    /* Looking does not wake it up */
+    assert(n_avail == lsquic_conn_n_avail_streams(test.conn));
+    assert(is_hibernating(test.conn));
+
+    n_packets = fsrv_n_packets_in(test.srv, cid);
+    switch (wake_by)
+    {
+    case WAKE_PACKET:
+        sz = fsrv_gen_ping_frame(frame, sizeof(frame));
+        assert(sz > 0);
+        sz = fsrv_gen_packet(test.srv, cid, 0, frame, sz, 1, packet,
+                                                            sizeof(packet));
+        assert(sz > 0);
+        assert(0 == fsrv_deliver(test.srv, cid, packet, sz));
+        lsquic_engine_process_conns(test.engine);
+        assert(!is_hibernating(test.conn));     /* ACK is due */
+        /* The PING is acknowledged and the connection goes back to sleep */
+        advance_time(&test, s_now + 1000000);
+        assert(fsrv_n_packets_in(test.srv, cid) > n_packets);
+        assert(is_hibernating(test.conn));
+        break;
+    case WAKE_PING:
+        /* Step without responding until the PING goes out */
+        while (fsrv_n_packets_in(test.srv, cid) == n_packets)
+        {
+            assert(s_now < start + 30 * 1000 * 1000);
+            s_now += 1000000;
+            lsquic_engine_process_conns(test.engine);
+        }
+        assert(!is_hibernating(test.conn));     /* Waiting for ACK */
+        advance_time(&test, s_now + 1000000);
+        assert(is_hibernating(test.conn));
+        break;
+    case WAKE_MAKE_STREAM:
+        lsquic_conn_make_stream(test.conn);
+        assert(!is_hibernating(test.conn));
+        lsquic_engine_process_conns(test.engine);
+        assert(test.stream);
+        /* No longer idle */
+        advance_time(&test, s_now + 2 * test.settings.es_hibernate_after);
+        assert(!is_hibernating(test.conn));
+        assert(LSCONN_ST_CONNECTED == lsquic_conn_status(test.conn, NULL, 0));
+        break;
+    case WAKE_CLOSE:
+        lsquic_conn_close(test.conn);
+        assert(!is_hibernating(test.conn));
+        /* The connection is not tickable until its next alarm */
+        advance_time(&test, start + 30 * 1000 * 1000);
+        assert(1 == test.n_conn_closed);
+        break;
+    }
+
+    cleanup_test(&test);
+}
+
+
+int
+main (void)
+{
+    if (0 != lsquic_global_init(LSQUIC_GLOBAL_CLIENT))
+        return 1;
+    fsrv_install();
+
+    test_out_of_order(1);
+    test_out_of_order(2);
+    test_preconn_claim(0);
+    test_preconn_claim(1);
+    test_preconn_expiry(0);
+    test_preconn_expiry(1);
+    test_mem_report(0);
+    test_mem_report(1);
+    test_mem_report_other_conn();
+    test_hibernate(WAKE_PACKET);
+    test_hibernate(WAKE_PING);
+    test_hibernate(WAKE_MAKE_STREAM);
+    test_hibernate(WAKE_CLOSE);
+
+    lsquic_global_cleanup();
+    return 0;
+}
@@ -0,0 +1,212 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_hpack_dyn.c -- Test HPACK dynamic tables.
+ *
+ * Header blocks are encoded with incremental indexing and decoded, while
+ * the table capacity changes and entries are evicted and wrap around the
+ * end of the table buffer.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lshpack.h"
+
+#define N_NAMES 40
+#define N_VALUES 80
+
+static char names[N_NAMES][64], values[N_VALUES][300];
+static lshpack_strlen_t name_lens[N_NAMES], val_lens[N_VALUES];
+
+
+static void
+init_strings (void)
+{
+    unsigned i, n;
+
+    srand(1);
+    for (i = 0; i < N_NAMES; ++i)
+    {
+        name_lens[i] = 1 + rand() % (i < 30 ? 20 : 60);
+        for (n = 0; n < name_lens[i]; ++n)
+            names[i][n] = 'a' + rand() % 26;
+    }
+    for (i = 0; i < N_VALUES; ++i)
+    {
+        val_lens[i] = rand() % (i < 60 ? 40 : 300);
+        for (n = 0; n < val_lens[i]; ++n)
+            values[i][n] = ' ' + rand() % 90;
+    }
+}
+
+
+/* Encode and decode `n_blocks' random header blocks */
+static void
+run_blocks (struct lshpack_enc *enc, struct lshpack_dec *dec,
+            unsigned n_blocks, int by_ref)
+{
+    unsigned char block[0x8000], *p, *end;
+    const unsigned char *src, *field;
+    char out[0x1000];
+    unsigned names_idx[30], vals_idx[30], n_headers, i;
+    const char *name, *value;
+    lshpack_strlen_t name_len, val_len;
+    uint32_t name_idx;
+    int s, len;
+
+    while (n_blocks-- > 0)
+    {
+        n_headers = 1 + rand() % 30;
+        p = block;
+        for (i = 0; i < n_headers; ++i)
+        {
+            names_idx[i] = rand() % N_NAMES;
+            vals_idx[i] = rand() % N_VALUES;
+            end = lshpack_enc_encode2(enc, p, block + sizeof(block),
+                    names[names_idx[i]], name_lens[names_idx[i]],
+                    values[vals_idx[i]], val_lens[vals_idx[i]],
+                    rand() % 4 ? 0 : rand() % 3);
+            assert(end > p);
+            p = end;
+        }
+
+        src = block;
+        for (i = 0; i < n_headers; ++i)
+        {
+            /* A field is only complete with its last byte */
+            len = lshpack_dec_field_len(src, p);
+            assert(len > 0);
+            assert(0 == lshpack_dec_field_len(src, src + len - 1));
+            field = src;
+            if (by_ref)
+                s = lshpack_dec_decode_ref(dec, &src, p, out,
+                        out + sizeof(out), &name, &name_len, &value,
+                        &val_len, &name_idx);
+            else
+            {
+                s = lshpack_dec_decode(dec, &src, p, out, out + sizeof(out),
+                                            &name_len, &val_len, &name_idx);
+                name = out;
+                value = out + name_len;
+            }
+            assert(0 == s);
+            assert(src == field + len);
+            assert(name_len == name_lens[names_idx[i]]);
+            assert(0 == memcmp(name, names[names_idx[i]], name_len));
+            assert(val_len == val_lens[vals_idx[i]]);
+            assert(0 == memcmp(value, values[vals_idx[i]], val_len));
+        }
+        assert(src == p);
+        assert(dec->hpd_cur_capacity <= dec->hpd_cur_max_capacity);
+        assert(enc->hpe_cur_capacity <= enc->hpe_max_capacity);
+    }
+}
+
+
+static void
+test_capacity_changes (int by_ref)
+{
+    static const unsigned capacities[] = {
+        0, 31, 40, 100, 333, 1000, 4096, 8192, 65536,
+    };
+    struct lshpack_enc enc;
+    struct lshpack_dec dec;
+    unsigned i, capacity;
+    int s;
+
+    s = lshpack_enc_init(&enc);
+    assert(0 == s);
+    lshpack_dec_init(&dec);
+
+    run_blocks(&enc, &dec, 200, by_ref);
+    for (i = 0; i < 100; ++i)
+    {
+        capacity = capacities[ rand()
+                                % (sizeof(capacities) / sizeof(capacities[0])) ];
+        lshpack_enc_set_max_capacity(&enc, capacity);
+        lshpack_dec_set_max_capacity(&dec, capacity);
+        run_blocks(&enc, &dec, 20, by_ref);
+    }
+
+    lshpack_enc_cleanup(&enc);
+    lshpack_dec_cleanup(&dec);
+}
+
+
+/* The decoder evicts old entries to make room for new ones, even when
+ * the name of the new entry refers to an entry that is being evicted.
+ */
+static void
+test_evict_on_insert (int by_ref)
+{
+    struct lshpack_dec dec;
+    const unsigned char *src;
+    const char *name, *value;
+    char out[0x100];
+    lshpack_strlen_t name_len, val_len;
+    uint32_t name_idx;
+    unsigned i;
+    int s;
+    /* Literal with incremental indexing, new name: "name-1": "aaaa...a"
+     * (50 bytes); then three literals with indexing that use the name of
+     * dynamic entry 62 and value "b...b" (50 bytes).
+     */
+    unsigned char block[4 * 60], *p;
+
+    p = block;
+    *p++ = 0x40;
+    *p++ = 6;
+    memcpy(p, "name-1", 6);
+    p += 6;
+    *p++ = 50;
+    memset(p, 'a', 50);
+    p += 50;
+    for (i = 0; i < 3; ++i)
+    {
+        *p++ = 0x40 | 62;
+        *p++ = 50;
+        memset(p, 'b', 50);
+        p += 50;
+    }
+
+    lshpack_dec_init(&dec);
+    /* Room for a single entry */
+    lshpack_dec_set_max_capacity(&dec, 32 + 6 + 50 + 10);
+    src = block;
+    for (i = 0; i < 4; ++i)
+    {
+        if (by_ref)
+            s = lshpack_dec_decode_ref(&dec, &src, p, out, out + sizeof(out),
+                        &name, &name_len, &value, &val_len, &name_idx);
+        else
+        {
+            s = lshpack_dec_decode(&dec, &src, p, out, out + sizeof(out),
+                                            &name_len, &val_len, &name_idx);
+            name = out;
+            value = out + name_len;
+        }
+        assert(0 == s);
+        assert(6 == name_len);
+        assert(0 == memcmp(name, "name-1", 6));
+        assert(50 == val_len);
+        assert(value[0] == (i ? 'b' : 'a') && value[49] == value[0]);
+        assert(dec.hpd_nelem == 1);
+        assert(dec.hpd_cur_capacity == 32 + 6 + 50);
+    }
+    assert(src == p);
+    lshpack_dec_cleanup(&dec);
+}
+
+
+int
+main (void)
+{
+    init_strings();
+    test_evict_on_insert(0);
+    test_evict_on_insert(1);
+    test_capacity_changes(0);
+    test_capacity_changes(1);
+    return 0;
+}
@@ -0,0 +1,353 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_hpack_perf.c -- Measure HPACK decoding and encoding throughput.
+ *
+ * Header sets from test_hpack_corpus.h -- or from a file given with -f --
+ * are encoded as literals without indexing, so that every value is
+ * Huffman-coded on each pass.  By default, the header block is decoded
+ * over and over again; with -e, the headers are encoded instead.  The -c
+ * option selects a corpus: browser requests, API client requests, or
+ * responses.  With -s, only the encoder's static table lookup is timed.
+ *
+ * The file format is one "name: value" line per header; other lines are
+ * ignored.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <getopt.h>
+#endif
+
+#include "lsquic_int_types.h"
+#include "lsquic_util.h"
+#include "lshpack.h"
+#include "test_cycles.h"
+#include "test_hpack_corpus.h"
+
+#define MAX_HEADERS 10000
+
+static struct header
+{
+    const char         *name;
+    const char         *value;
+    lshpack_strlen_t    name_len;
+    lshpack_strlen_t    value_len;
+} headers[MAX_HEADERS];
+static unsigned n_headers;
+static int indexed_type = 1;    /* Without indexing */
+
+
+static void
+add_header_sets (const struct corpus_header *sets, size_t n_sets,
+                                                        size_t set_sz)
+{
+    const struct corpus_header *header;
+    size_t n;
+
+    for (n = 0; n < n_sets; ++n)
+        for (header = sets + n * set_sz; header->name; ++header)
+        {
+            assert(n_headers < MAX_HEADERS);
+            headers[n_headers].name = header->name;
+            headers[n_headers].value = header->value;
+            headers[n_headers].name_len = strlen(header->name);
+            headers[n_headers].value_len = strlen(header->value);
+            ++n_headers;
+        }
+}
+
+
+#define ADD_HEADER_SETS(sets) add_header_sets((sets)[0],                \
+    sizeof(sets) / sizeof((sets)[0]), sizeof((sets)[0]) / sizeof((sets)[0][0]))
+
+
+static void
+read_headers (const char *filename)
+{
+    FILE *file;
+    char line[0x2000], *colon;
+    size_t len;
+
+    file = fopen(filename, "r");
+    if (!file)
+    {
+        perror("fopen");
+        exit(EXIT_FAILURE);
+    }
+
+    while (fgets(line, sizeof(line), file))
+    {
+        len = strlen(line);
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+            line[--len] = '\0';
+        /* Skip the first character: pseudo-header names start with colon */
+        colon = len > 1 ? strchr(line + 1, ':') : NULL;
+        if (!colon)
+            continue;
+        *colon++ = '\0';
+        while (*colon == ' ')
+            ++colon;
+        if (n_headers >= MAX_HEADERS)
+        {
+            fprintf(stderr, "too many headers, using first %u\n", n_headers);
+            break;
+        }
+        headers[n_headers].name = strdup(line);
+        headers[n_headers].value = strdup(colon);
+        headers[n_headers].name_len = strlen(line);
+        headers[n_headers].value_len = strlen(colon);
+        ++n_headers;
+    }
+
+    (void) fclose(file);
+}
+
+
+/* Returns number of bytes in the header block */
+static size_t
+encode_headers (struct lshpack_enc *enc, unsigned char *buf, size_t bufsz)
+{
+    unsigned char *p, *end;
+    unsigned n;
+
+    p = buf;
+    for (n = 0; n < n_headers; ++n)
+    {
+        end = lshpack_enc_encode2(enc, p, buf + bufsz, headers[n].name,
+                headers[n].name_len, headers[n].value, headers[n].value_len,
+                indexed_type);
+        assert(end > p);
+        p = end;
+    }
+
+    return p - buf;
+}
+
+
+/* Returns number of header bytes produced by one decoding pass */
+static size_t
+decode_headers (const unsigned char *block, size_t block_sz, int by_ref,
+                                                                int verify)
+{
+    struct lshpack_dec dec;
+    const unsigned char *p, *const end = block + block_sz;
+    char out[0x10000];
+    const char *name, *value;
+    lshpack_strlen_t name_len, val_len;
+    uint32_t name_idx;
+    size_t total;
+    unsigned n;
+    int s;
+
+    lshpack_dec_init(&dec);
+    total = 0;
+    p = block;
+    for (n = 0; p < end; ++n)
+    {
+        if (by_ref)
+            s = lshpack_dec_decode_ref(&dec, &p, end, out, out + sizeof(out),
+                            &name, &name_len, &value, &val_len, &name_idx);
+        else
+        {
+            s = lshpack_dec_decode(&dec, &p, end, out, out + sizeof(out),
+                                            &name_len, &val_len, &name_idx);
+            name = out;
+            value = out + name_len;
+        }
+        assert(0 == s);
+        if (verify)
+        {
+            assert(name_len == headers[n].name_len);
+            assert(val_len == headers[n].value_len);
+            assert(0 == memcmp(name, headers[n].name, name_len));
+            assert(0 == memcmp(value, headers[n].value, val_len));
+        }
+        total += name_len + val_len;
+    }
+    assert(!verify || n == n_headers);
+    lshpack_dec_cleanup(&dec);
+    (void) s;
+
+    return total;
+}
+
+
+/* Returns number of static table matches */
+static unsigned
+lookup_static (const unsigned *order, unsigned count)
+{
+    const struct header *header;
+    unsigned n, n_matches;
+    int val_matched;
+
+    n_matches = 0;
+    for (n = 0; n < count; ++n)
+    {
+        header = &headers[ order[n] ];
+        n_matches += 0 != lshpack_enc_get_stx_tab_id(header->name,
+                        header->name_len, header->value,
+                        header->value_len, &val_matched);
+    }
+
+    return n_matches;
+}
+
+
+/* Look up headers in the order they are listed and then in random order.
+ * The former is what a branch predictor can learn; the latter is closer
+ * to a server that sees many different clients.
+ */
+static void
+bench_static (unsigned n_iters)
+{
+    unsigned *order, count, n, i, n_passes;
+    unsigned long n_matches;
+    uint64_t cycles;
+    lsquic_time_t t0, t1;
+    int shuffle;
+
+    /* Make the random sequence too long to learn, but keep the total
+     * number of lookups the same as n_iters passes over the headers.
+     */
+    count = n_headers < 0x1000 ? 0x1000 : n_headers;
+    n_passes = (uint64_t) n_iters * n_headers / count;
+    if (n_passes == 0)
+        n_passes = 1;
+    order = malloc(count * sizeof(order[0]));
+    for (shuffle = 0; shuffle < 2; ++shuffle)
+    {
+        srand(1);
+        for (n = 0; n < count; ++n)
+            order[n] = shuffle ? (unsigned) rand() % n_headers : n % n_headers;
+        n_matches = 0;
+        t0 = lsquic_time_now();
+        cycles = get_cycles();
+        for (i = 0; i < n_passes; ++i)
+            n_matches += lookup_static(order, count);
+        cycles = get_cycles() - cycles;
+        t1 = lsquic_time_now();
+        printf("%u lookups %s, %lu static table matches: %.1f %ss/lookup; "
+            "%.1f ns/lookup\n", count, shuffle ? "in random order" : "in order",
+            n_matches / n_passes,
+            (double) cycles / (double) n_passes / (double) count,
+            CYCLES_UNIT, (double) (t1 - t0) * 1000.0 / (double) n_passes
+                                                    / (double) count);
+    }
+    free(order);
+}
+
+
+int
+main (int argc, char **argv)
+{
+    unsigned n, n_iters = 100000;
+    unsigned char *block;
+    size_t block_sz, total, bufsz;
+    uint64_t cycles;
+    lsquic_time_t t0, t1;
+    struct lshpack_enc enc;
+    const char *corpus = NULL;
+    int opt, s, encode = 0, by_ref = 0, static_only = 0;
+
+    while (-1 != (opt = getopt(argc, argv, "c:ef:in:rs")))
+    {
+        switch (opt)
+        {
+        case 'c':
+            corpus = optarg;
+            break;
+        case 'e':
+            encode = 1;
+            break;
+        case 'f':
+            read_headers(optarg);
+            break;
+        case 'i':
+            indexed_type = 0;
+            break;
+        case 'n':
+            n_iters = atoi(optarg);
+            break;
+        case 'r':
+            by_ref = 1;
+            break;
+        case 's':
+            static_only = 1;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-e] [-i] [-r] [-s] "
+                "[-c browser|api|resp] [-f headers-file] [-n iterations]\n",
+                argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (0 == n_headers)
+    {
+        if (!corpus || 0 == strcmp(corpus, "browser"))
+            ADD_HEADER_SETS(corpus_browser_req);
+        if (!corpus || 0 == strcmp(corpus, "api"))
+            ADD_HEADER_SETS(corpus_api_req);
+        if (!corpus || 0 == strcmp(corpus, "resp"))
+            ADD_HEADER_SETS(corpus_resp);
+        if (0 == n_headers)
+        {
+            fprintf(stderr, "unknown corpus `%s'\n", corpus);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (static_only)
+    {
+        bench_static(n_iters);
+        exit(0);
+    }
+
+    bufsz = 0x100;
+    for (n = 0; n < n_headers; ++n)
+        bufsz += headers[n].name_len + headers[n].value_len + 0x10;
+    block = malloc(bufsz);
+    s = lshpack_enc_init(&enc);
+    assert(0 == s);
+    (void) s;
+    block_sz = encode_headers(&enc, block, bufsz);
+    total = decode_headers(block, block_sz, by_ref, 1);
+
+    t0 = lsquic_time_now();
+    cycles = get_cycles();
+    if (encode)
+        for (n = 0; n < n_iters; ++n)
+        {
+            if (0 == indexed_type)
+            {
+                /* Start with an empty dynamic table on each pass */
+                lshpack_enc_cleanup(&enc);
+                s = lshpack_enc_init(&enc);
+                assert(0 == s);
+            }
+            (void) encode_headers(&enc, block, bufsz);
+        }
+    else
+        for (n = 0; n < n_iters; ++n)
+            (void) decode_headers(block, block_sz, by_ref, 0);
+    cycles = get_cycles() - cycles;
+    t1 = lsquic_time_now();
+    total *= n_iters;
+
+    printf("%u headers, %zu-byte header block: %.2f %ss/byte; "
+        "%.1f MB/sec %s\n", n_headers, block_sz,
+        (double) cycles / (double) total, CYCLES_UNIT,
+        (double) total / (double) (t1 - t0 ? t1 - t0 : 1),
+        encode ? "encoded" : "decoded");
+
+    lshpack_enc_cleanup(&enc);
+    free(block);
+    exit(0);
+}
@@ -0,0 +1,225 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_hset.c -- Test built-in header set.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lsquic.h"
+#include "lsquic_http1x_if.h"
+
+
+struct header
+{
+    unsigned        name_idx;
+    const char     *name;
+    const char     *value;
+};
+
+
+static struct lsquic_hset *
+new_hset (int is_server, int is_push_promise, unsigned max_headers_sz)
+{
+    struct http1x_ctor_ctx ctx = {
+        .cid            = 0,
+        .max_headers_sz = max_headers_sz,
+        .is_server      = is_server,
+    };
+    struct lsquic_hset *hset;
+
+    hset = lsquic_hset_native_if->hsi_create_header_set(&ctx,
+                                                        is_push_promise);
+    assert(hset);
+    return hset;
+}
+
+
+/* Returns status of the first header that fails or of the final call */
+static enum lsquic_header_status
+add_headers (struct lsquic_hset *hset, const struct header *headers,
+                                                            unsigned count)
+{
+    enum lsquic_header_status st;
+    unsigned n;
+
+    for (n = 0; n < count; ++n)
+    {
+        st = lsquic_hset_native_if->hsi_process_header(hset,
+                headers[n].name_idx, headers[n].name, strlen(headers[n].name),
+                headers[n].value, strlen(headers[n].value));
+        if (st != LSQUIC_HDR_OK)
+            return st;
+    }
+
+    return lsquic_hset_native_if->hsi_process_header(hset, 0, 0, 0, 0, 0);
+}
+
+
+static void
+test_request (void)
+{
+    static const struct header headers[] = {
+        { 2,  ":method",    "GET", },
+        { 0,  ":scheme",    "https", },
+        { 1,  ":authority", "www.example.com", },
+        { 0,  ":path",      "/index.html", },
+        { 32, "cookie",     "a=b", },
+        { 0,  "x-custom",   "some value", },
+        /* Dynamic table index: not a static table name index */
+        { 70, "cookie",     "c=d", },
+    };
+    struct lsquic_hset *hset;
+    const struct lsquic_hset_header *header;
+    char names[100][10], values[100][200];
+    unsigned n;
+    enum lsquic_header_status st;
+
+    hset = new_hset(1, 0, 0);
+    st = add_headers(hset, headers, sizeof(headers) / sizeof(headers[0]));
+    assert(LSQUIC_HDR_OK == st);
+    assert(lsquic_hset_count(hset) == sizeof(headers) / sizeof(headers[0]));
+
+    for (header = lsquic_hset_first(hset), n = 0; header;
+                                header = lsquic_hset_next(hset, header), ++n)
+    {
+        assert(header->name_len == strlen(headers[n].name));
+        assert(0 == memcmp(header->name, headers[n].name, header->name_len));
+        assert(header->value_len == strlen(headers[n].value));
+        assert(0 == memcmp(header->value, headers[n].value,
+                                                        header->value_len));
+    }
+    assert(n == sizeof(headers) / sizeof(headers[0]));
+
+    /* Pseudo-header name index is always set */
+    header = lsquic_hset_find(hset, NULL, ":path", 5);
+    assert(header && 4 == header->name_idx);
+    header = lsquic_hset_find(hset, NULL, "x-custom", 8);
+    assert(header && 0 == header->name_idx);
+
+    /* Cookies are not concatenated */
+    header = lsquic_hset_find(hset, NULL, "cookie", 6);
+    assert(header && 32 == header->name_idx);
+    assert(3 == header->value_len && 0 == memcmp(header->value, "a=b", 3));
+    header = lsquic_hset_find(hset, header, "cookie", 6);
+    assert(header && 0 == header->name_idx);
+    assert(3 == header->value_len && 0 == memcmp(header->value, "c=d", 3));
+    assert(!lsquic_hset_find(hset, header, "cookie", 6));
+    assert(!lsquic_hset_find(hset, NULL, "host", 4));
+
+    lsquic_hset_native_if->hsi_discard_header_set(hset);
+
+    /* Enough headers for the header array and the buffer to grow */
+    hset = new_hset(0, 0, 0);
+    st = lsquic_hset_native_if->hsi_process_header(hset, 8, ":status", 7,
+                                                                    "200", 3);
+    assert(LSQUIC_HDR_OK == st);
+    for (n = 0; n < 100; ++n)
+    {
+        snprintf(names[n], sizeof(names[n]), "x-%u", n);
+        memset(values[n], 'a' + n % 26, sizeof(values[n]));
+        st = lsquic_hset_native_if->hsi_process_header(hset, 0, names[n],
+                    strlen(names[n]), values[n], n * 2);
+        assert(LSQUIC_HDR_OK == st);
+    }
+    st = lsquic_hset_native_if->hsi_process_header(hset, 0, 0, 0, 0, 0);
+    assert(LSQUIC_HDR_OK == st);
+    assert(101 == lsquic_hset_count(hset));
+    header = lsquic_hset_first(hset);
+    assert(header->name_len == 7 && 0 == memcmp(header->name, ":status", 7));
+    for (n = 0; n < 100; ++n)
+    {
+        header = lsquic_hset_next(hset, header);
+        assert(header);
+        assert(header->name_len == strlen(names[n]));
+        assert(0 == memcmp(header->name, names[n], header->name_len));
+        assert(header->value_len == n * 2);
+        assert(0 == memcmp(header->value, values[n], header->value_len));
+    }
+    assert(!lsquic_hset_next(hset, header));
+    lsquic_hset_destroy(hset);
+}
+
+
+static void
+test_errors (void)
+{
+    static const struct {
+        int                         is_server;
+        int                         is_push_promise;
+        unsigned                    max_headers_sz;
+        enum lsquic_header_status   status;
+        unsigned                    count;
+        struct header               headers[4];
+    } tests[] = {
+        {   1, 0, 0, LSQUIC_HDR_ERR_INCOMPL_REQ_PSDO_HDR, 2,
+            {   { 2, ":method", "GET", },
+                { 4, ":path", "/", }, },
+        },
+        {   0, 1, 0, LSQUIC_HDR_ERR_INCOMPL_REQ_PSDO_HDR, 1,
+            {   { 8, ":status", "200", }, },
+        },
+        {   1, 0, 0, LSQUIC_HDR_ERR_UNNEC_RESP_PSDO_HDR, 4,
+            {   { 2, ":method", "GET", },
+                { 4, ":path", "/", },
+                { 6, ":scheme", "https", },
+                { 0, ":status", "200", }, },
+        },
+        {   0, 0, 0, LSQUIC_HDR_ERR_INCOMPL_RESP_PSDO_HDR, 1,
+            {   { 0, "server", "x", }, },
+        },
+        {   0, 0, 0, LSQUIC_HDR_ERR_UNNEC_REQ_PSDO_HDR, 2,
+            {   { 8, ":status", "200", },
+                { 4, ":path", "/", }, },
+        },
+        {   0, 0, 0, LSQUIC_HDR_ERR_DUPLICATE_PSDO_HDR, 2,
+            {   { 8, ":status", "200", },
+                { 0, ":status", "404", }, },
+        },
+        {   0, 0, 0, LSQUIC_HDR_ERR_UNKNOWN_PSDO_HDR, 2,
+            {   { 8, ":status", "200", },
+                { 0, ":stat", "404", }, },
+        },
+        {   0, 0, 0, LSQUIC_HDR_ERR_MISPLACED_PSDO_HDR, 3,
+            {   { 8, ":status", "200", },
+                { 0, "server", "x", },
+                { 0, ":path", "/", }, },
+        },
+        {   0, 0, 0, LSQUIC_HDR_ERR_UPPERCASE_HEADER, 2,
+            {   { 8, ":status", "200", },
+                { 0, "Server", "x", }, },
+        },
+        {   0, 0, 100, LSQUIC_HDR_ERR_HEADERS_TOO_LARGE, 3,
+            {   { 8, ":status", "200", },
+                { 0, "server", "x", },
+                { 0, "x-header", "some value", }, },
+        },
+        {   0, 0, 100, LSQUIC_HDR_OK, 2,
+            {   { 8, ":status", "200", },
+                { 0, "server", "x", }, },
+        },
+    };
+    struct lsquic_hset *hset;
+    enum lsquic_header_status st;
+    unsigned n;
+
+    for (n = 0; n < sizeof(tests) / sizeof(tests[0]); ++n)
+    {
+        hset = new_hset(tests[n].is_server, tests[n].is_push_promise,
+                                                    tests[n].max_headers_sz);
+        st = add_headers(hset, tests[n].headers, tests[n].count);
+        assert(st == tests[n].status);
+        lsquic_hset_native_if->hsi_discard_header_set(hset);
+    }
+}
+
+
+int
+main (void)
+{
+    test_request();
+    test_errors();
+    return 0;
+}
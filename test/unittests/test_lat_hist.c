@@ -0,0 +1,144 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lat_hist.h"
+
+
+static struct lat_hist hist;
+
+
+/* Percentile of a single recorded value.  Another, much larger, value is
+ * recorded so that the result is not capped by the maximum.
+ */
+static unsigned long long
+bucket_value (unsigned long long value)
+{
+    lhist_init(&hist);
+    lhist_record(&hist, value);
+    lhist_record(&hist, LH_MAX_VALUE);
+    return lhist_percentile(&hist, 50);
+}
+
+
+/* Values `lo' through `hi' share a bucket and percentiles falling into it
+ * are reported as `hi'.
+ */
+static void
+check_bucket (unsigned long long lo, unsigned long long hi)
+{
+    assert(hi == bucket_value(lo));
+    assert(hi == bucket_value(hi));
+    if (lo > 0)
+        assert(lo - 1 == bucket_value(lo - 1));
+    if (hi < LH_MAX_VALUE)
+        assert(hi < bucket_value(hi + 1));
+    /* Within documented precision: */
+    assert((hi - lo) * 100 <= lo);
+}
+
+
+static void
+test_buckets (void)
+{
+    static const unsigned subs[] = { 128, 129, 200, 255, };
+    unsigned long long value;
+    unsigned shift, n;
+
+    /* Values below LH_N_SUB have their own buckets */
+    for (value = 0; value < LH_N_SUB; ++value)
+        assert(value == bucket_value(value));
+
+    /* Above that, buckets are 2^shift values wide */
+    check_bucket(256, 257);
+    check_bucket(510, 511);
+    check_bucket(512, 515);
+    for (shift = 1; shift <= LH_MAX_SHIFT; ++shift)
+        for (n = 0; n < sizeof(subs) / sizeof(subs[0]); ++n)
+            check_bucket((unsigned long long) subs[n] << shift,
+                        (((unsigned long long) subs[n] + 1) << shift) - 1);
+}
+
+
+/* Reported percentile is never below the real one and within 1% of it */
+static void
+check_percentile (const unsigned long long *values, unsigned count,
+                                                                double pct)
+{
+    unsigned long long rank, real, reported;
+
+    rank = (unsigned long long) (pct / 100 * count + 0.5);
+    if (rank < 1)
+        rank = 1;
+    real = values[rank - 1];
+    reported = lhist_percentile(&hist, pct);
+    assert(reported >= real);
+    assert((reported - real) * 100 <= real);
+}
+
+
+static void
+test_percentiles (void)
+{
+    static unsigned long long values[10000];
+    const unsigned count = sizeof(values) / sizeof(values[0]);
+    unsigned i;
+
+    /* Values spread over several powers of two, recorded out of order */
+    for (i = 0; i < count; ++i)
+        values[i] = 100 + (unsigned long long) i * i * 3;
+    lhist_init(&hist);
+    for (i = 0; i < count; i += 2)
+        lhist_record(&hist, values[i]);
+    for (i = 1; i < count; i += 2)
+        lhist_record(&hist, values[i]);
+
+    assert(count == hist.lh_n);
+    assert(values[0] == hist.lh_min);
+    assert(values[count - 1] == hist.lh_max);
+    check_percentile(values, count, 50);
+    check_percentile(values, count, 99);
+    check_percentile(values, count, 99.9);
+    assert(values[count - 1] == lhist_percentile(&hist, 100));
+
+    /* Exact below LH_N_SUB */
+    lhist_init(&hist);
+    for (i = 1; i <= 100; ++i)
+        lhist_record(&hist, i);
+    assert(50 == lhist_percentile(&hist, 50));
+    assert(99 == lhist_percentile(&hist, 99));
+    assert(100 == lhist_percentile(&hist, 100));
+    assert(100 == hist.lh_max);
+}
+
+
+static void
+test_edge_cases (void)
+{
+    lhist_init(&hist);
+    assert(0 == lhist_percentile(&hist, 50));
+
+    /* Percentile is capped by the maximum recorded value */
+    lhist_record(&hist, 1000);
+    assert(1000 == lhist_percentile(&hist, 50));
+    assert(1000 == lhist_percentile(&hist, 99));
+
+    /* Values that are too large are counted as LH_MAX_VALUE */
+    lhist_record(&hist, LH_MAX_VALUE + 12345);
+    assert(LH_MAX_VALUE == hist.lh_max);
+    assert(LH_MAX_VALUE == lhist_percentile(&hist, 99));
+    lhist_record(&hist, ~0ull);
+    assert(LH_MAX_VALUE == hist.lh_max);
+    assert(3 == hist.lh_n);
+}
+
+
+int
+main (void)
+{
+    test_buckets();
+    test_percentiles();
+    test_edge_cases();
+    return 0;
+}
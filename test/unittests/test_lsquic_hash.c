@@ -1,5 +1,13 @@
 /* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_lsquic_hash.c -- Test lsquic_hash.
+ *
+ * With -b, insert, find, and erase are benchmarked against the chained hash
+ * that lsquic_hash used to be, a copy of which is included below.
+ */
+
 #include <assert.h>
+#include <inttypes.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -7,9 +15,14 @@
 #include <sys/queue.h>
 #ifndef WIN32
 #include <unistd.h>
+#else
+#include <getopt.h>
 #endif
 
+#include "lsquic_malo.h"
 #include "lsquic_hash.h"
+#include "lsquic_xxhash.h"
+#include "test_cycles.h"
 
 
 struct widget
@@ -19,21 +32,16 @@ struct widget
 };
 
 
-int
-main (int argc, char **argv)
+static void
+test_basic (unsigned nelems)
 {
     struct lsquic_hash *hash;
     struct lsquic_hash_elem *el;
-    unsigned n, nelems;
+    unsigned n;
     struct widget *widgets, *widget;
 
     hash = lsquic_hash_create();
 
-    if (argc > 1)
-        nelems = atoi(argv[1]);
-    else
-        nelems = 1000000;
-
     widgets = malloc(sizeof(widgets[0]) * nelems);
 
     for (n = 0; n < nelems; ++n)
@@ -73,6 +81,498 @@ main (int argc, char **argv)
 
     lsquic_hash_destroy(hash);
     free(widgets);
+}
+
+
+/* Erase every other element while iterating: each element must be visited
+ * exactly once.
+ */
+static void
+test_erase_while_iterating (void)
+{
+    struct lsquic_hash *hash;
+    struct lsquic_hash_elem *el;
+    unsigned long keys[1000];
+    unsigned char seen[1000];
+    unsigned n, idx;
+
+    hash = lsquic_hash_create();
+    for (n = 0; n < 1000; ++n)
+    {
+        keys[n] = n * 7919;
+        el = lsquic_hash_insert(hash, &keys[n], sizeof(keys[n]), &keys[n]);
+        assert(el);
+    }
+
+    memset(seen, 0, sizeof(seen));
+    for (el = lsquic_hash_first(hash); el; el = lsquic_hash_next(hash))
+    {
+        idx = (unsigned long *) lsquic_hashelem_getdata(el) - keys;
+        assert(idx < 1000);
+        assert(!seen[idx]);
+        seen[idx] = 1;
+        if (idx & 1)
+            lsquic_hash_erase(hash, el);
+    }
+    for (n = 0; n < 1000; ++n)
+        assert(seen[n]);
+    assert(500 == lsquic_hash_count(hash));
+
+    for (n = 0; n < 1000; ++n)
+    {
+        el = lsquic_hash_find(hash, &keys[n], sizeof(keys[n]));
+        assert(!!el == !(n & 1));
+    }
+
+    lsquic_hash_destroy(hash);
+}
+
+
+/* Keys longer than the inline buffer are referenced rather than copied.
+ * Keys that differ only past the inline buffer must not be confused.
+ */
+static void
+test_long_keys (void)
+{
+    struct lsquic_hash *hash;
+    struct lsquic_hash_elem *el;
+    char keys[100][40];
+    unsigned n;
+
+    hash = lsquic_hash_create();
+    for (n = 0; n < 100; ++n)
+    {
+        snprintf(keys[n], sizeof(keys[n]), "%-32s%u",
+                                        "a rather long common prefix:", n);
+        el = lsquic_hash_insert(hash, keys[n], strlen(keys[n]), keys[n]);
+        assert(el);
+    }
+
+    for (n = 0; n < 100; ++n)
+    {
+        char key[40];
+        snprintf(key, sizeof(key), "%-32s%u", "a rather long common prefix:",
+                                                                            n);
+        el = lsquic_hash_find(hash, key, strlen(key));
+        assert(el);
+        assert(lsquic_hashelem_getdata(el) == keys[n]);
+        /* Prefix of a key is a different key */
+        el = lsquic_hash_find(hash, key, strlen(key) - 1);
+        assert(!el || lsquic_hashelem_getdata(el) != keys[n]);
+    }
+
+    /* Short keys live alongside long keys; the key buffer may be reused
+     * after insertion.
+     */
+    for (n = 0; n < 100; ++n)
+    {
+        char key[8];
+        snprintf(key, sizeof(key), "%u", n);
+        el = lsquic_hash_insert(hash, key, strlen(key), &keys[n][1]);
+        assert(el);
+        memset(key, 'X', sizeof(key));
+    }
+    for (n = 0; n < 100; ++n)
+    {
+        char key[8];
+        snprintf(key, sizeof(key), "%u", n);
+        el = lsquic_hash_find(hash, key, strlen(key));
+        assert(el);
+        assert(lsquic_hashelem_getdata(el) == &keys[n][1]);
+    }
+    assert(200 == lsquic_hash_count(hash));
+
+    lsquic_hash_destroy(hash);
+}
+
+
+/* Random inserts and erases with a small working set: this exercises
+ * deleted slots and rehashing without growth.  Presence of each key is
+ * tracked separately and checked against the hash.
+ */
+static void
+test_churn (void)
+{
+    struct lsquic_hash *hash;
+    struct lsquic_hash_elem *el;
+    uint32_t keys[300];
+    unsigned char present[300];
+    unsigned n, idx, count, rnd;
+    size_t max_mem;
+
+    hash = lsquic_hash_create();
+    for (n = 0; n < 300; ++n)
+        keys[n] = n;
+    memset(present, 0, sizeof(present));
+    count = 0;
+    max_mem = 0;
+    rnd = 1;
+
+    for (n = 0; n < 200000; ++n)
+    {
+        rnd = rnd * 1103515245 + 12345;
+        idx = (rnd >> 8) % 300;
+        el = lsquic_hash_find(hash, &keys[idx], sizeof(keys[idx]));
+        assert(!!el == present[idx]);
+        if (el)
+        {
+            assert(lsquic_hashelem_getdata(el) == &keys[idx]);
+            lsquic_hash_erase(hash, el);
+            present[idx] = 0;
+            --count;
+        }
+        else
+        {
+            el = lsquic_hash_insert(hash, &keys[idx], sizeof(keys[idx]),
+                                                                &keys[idx]);
+            assert(el);
+            present[idx] = 1;
+            ++count;
+        }
+        assert(count == lsquic_hash_count(hash));
+        if (n == 10000)
+            max_mem = lsquic_hash_mem_used(hash);
+    }
+
+    for (n = 0; n < 300; ++n)
+        assert(!!lsquic_hash_find(hash, &keys[n], sizeof(keys[n]))
+                                                                == present[n]);
+    /* The table does not grow without bound because of deleted slots */
+    assert(lsquic_hash_mem_used(hash) <= max_mem * 2);
+
+    for (n = 0, el = lsquic_hash_first(hash); el; el = lsquic_hash_next(hash))
+        ++n;
+    assert(n == count);
+
+    lsquic_hash_destroy(hash);
+}
+
+
+/* The chained hash that lsquic_hash used to be, for comparison: */
+
+struct chained_elem
+{
+    TAILQ_ENTRY(chained_elem)
+                    ce_next_bucket,
+                    ce_next_all;
+    const void     *ce_key_data;
+    unsigned        ce_key_len;
+    void           *ce_value;
+    unsigned        ce_hash_val;
+};
+
+TAILQ_HEAD(chained_head, chained_elem);
+
+#define N_BUCKETS(n_bits) (1U << (n_bits))
+#define BUCKNO(n_bits, hash) ((hash) & (N_BUCKETS(n_bits) - 1))
+
+struct chained_hash
+{
+    struct chained_head     *ch_buckets,
+                             ch_all;
+    struct malo             *ch_malo_els;
+    unsigned                 ch_count;
+    unsigned                 ch_nbits;
+};
+
+
+static struct chained_hash *
+chained_create (void)
+{
+    struct chained_hash *hash;
+    unsigned i;
+
+    hash = malloc(sizeof(*hash));
+    hash->ch_nbits = 2;
+    hash->ch_buckets = malloc(sizeof(hash->ch_buckets[0])
+                                                * N_BUCKETS(hash->ch_nbits));
+    hash->ch_malo_els = lsquic_malo_create(sizeof(struct chained_elem));
+    for (i = 0; i < N_BUCKETS(hash->ch_nbits); ++i)
+        TAILQ_INIT(&hash->ch_buckets[i]);
+    TAILQ_INIT(&hash->ch_all);
+    hash->ch_count = 0;
+    return hash;
+}
+
+
+static void
+chained_destroy (struct chained_hash *hash)
+{
+    lsquic_malo_destroy(hash->ch_malo_els);
+    free(hash->ch_buckets);
+    free(hash);
+}
+
+
+static void
+chained_grow (struct chained_hash *hash)
+{
+    struct chained_head *new_buckets, *new[2];
+    struct chained_elem *el;
+    unsigned n, old_nbits;
+    int idx;
+
+    old_nbits = hash->ch_nbits;
+    new_buckets = malloc(sizeof(hash->ch_buckets[0])
+                                                * N_BUCKETS(old_nbits + 1));
+    for (n = 0; n < N_BUCKETS(old_nbits); ++n)
+    {
+        new[0] = &new_buckets[n];
+        new[1] = &new_buckets[n + N_BUCKETS(old_nbits)];
+        TAILQ_INIT(new[0]);
+        TAILQ_INIT(new[1]);
+        while ((el = TAILQ_FIRST(&hash->ch_buckets[n])))
+        {
+            TAILQ_REMOVE(&hash->ch_buckets[n], el, ce_next_bucket);
+            idx = (BUCKNO(old_nbits + 1, el->ce_hash_val) >> old_nbits) & 1;
+            TAILQ_INSERT_TAIL(new[idx], el, ce_next_bucket);
+        }
+    }
+    free(hash->ch_buckets);
+    hash->ch_nbits   = old_nbits + 1;
+    hash->ch_buckets = new_buckets;
+}
+
+
+static struct chained_elem *
+chained_insert (struct chained_hash *hash, const void *key, unsigned key_sz,
+                                                                    void *data)
+{
+    unsigned buckno, hash_val;
+    struct chained_elem *el;
+
+    el = lsquic_malo_get(hash->ch_malo_els);
+    if (hash->ch_count >= N_BUCKETS(hash->ch_nbits) / 2)
+        chained_grow(hash);
+
+    hash_val = XXH64(key, key_sz, (uintptr_t) hash);
+    buckno = BUCKNO(hash->ch_nbits, hash_val);
+    TAILQ_INSERT_TAIL(&hash->ch_all, el, ce_next_all);
+    TAILQ_INSERT_TAIL(&hash->ch_buckets[buckno], el, ce_next_bucket);
+    el->ce_key_data = key;
+    el->ce_key_len  = key_sz;
+    el->ce_value    = data;
+    el->ce_hash_val = hash_val;
+    ++hash->ch_count;
+    return el;
+}
+
+
+static struct chained_elem *
+chained_find (struct chained_hash *hash, const void *key, unsigned key_sz)
+{
+    unsigned buckno, hash_val;
+    struct chained_elem *el;
+
+    hash_val = XXH64(key, key_sz, (uintptr_t) hash);
+    buckno = BUCKNO(hash->ch_nbits, hash_val);
+    TAILQ_FOREACH(el, &hash->ch_buckets[buckno], ce_next_bucket)
+        if (hash_val == el->ce_hash_val &&
+            key_sz   == el->ce_key_len &&
+            0 == memcmp(key, el->ce_key_data, key_sz))
+        {
+            return el;
+        }
+
+    return NULL;
+}
+
+
+static void
+chained_erase (struct chained_hash *hash, struct chained_elem *el)
+{
+    unsigned buckno;
+
+    buckno = BUCKNO(hash->ch_nbits, el->ce_hash_val);
+    TAILQ_REMOVE(&hash->ch_buckets[buckno], el, ce_next_bucket);
+    TAILQ_REMOVE(&hash->ch_all, el, ce_next_all);
+    lsquic_malo_put(el);
+    --hash->ch_count;
+}
+
+
+enum { OP_INSERT, OP_FIND, OP_ERASE, N_OPS, };
+
+/* Key size is not a compile-time constant in the library: do not let the
+ * compiler specialize the chained hash functions for it.
+ */
+static volatile unsigned key_size = sizeof(uint64_t);
+
+static const char *const op_names[N_OPS] = { "insert", "find", "erase", };
+
+
+/* Keys are the same kind that lsquic uses: connection IDs.  Elements are
+ * looked up and erased in random order, as they would be when packets
+ * arrive for many connections.
+ */
+static void
+bench_open (const uint64_t *keys, const unsigned *order, unsigned nelems,
+                                                    uint64_t cycles[N_OPS])
+{
+    struct lsquic_hash *hash;
+    struct lsquic_hash_elem *el;
+    uint64_t t;
+    unsigned n, key_sz = key_size;
+
+    hash = lsquic_hash_create();
+
+    t = get_cycles();
+    for (n = 0; n < nelems; ++n)
+    {
+        el = lsquic_hash_insert(hash, &keys[n], key_sz,
+                                                        (void *) &keys[n]);
+        assert(el);
+    }
+    cycles[OP_INSERT] += get_cycles() - t;
+
+    t = get_cycles();
+    for (n = 0; n < nelems; ++n)
+    {
+        el = lsquic_hash_find(hash, &keys[order[n]], key_sz);
+        assert(el);
+    }
+    cycles[OP_FIND] += get_cycles() - t;
+
+    t = get_cycles();
+    for (n = 0; n < nelems; ++n)
+    {
+        el = lsquic_hash_find(hash, &keys[order[n]], key_sz);
+        lsquic_hash_erase(hash, el);
+    }
+    cycles[OP_ERASE] += get_cycles() - t;
+
+    assert(0 == lsquic_hash_count(hash));
+    lsquic_hash_destroy(hash);
+}
+
+
+static void
+bench_chained (const uint64_t *keys, const unsigned *order, unsigned nelems,
+                                                    uint64_t cycles[N_OPS])
+{
+    struct chained_hash *hash;
+    struct chained_elem *el;
+    uint64_t t;
+    unsigned n, key_sz = key_size;
+
+    hash = chained_create();
+
+    t = get_cycles();
+    for (n = 0; n < nelems; ++n)
+    {
+        el = chained_insert(hash, &keys[n], key_sz,
+                                                        (void *) &keys[n]);
+        assert(el);
+    }
+    cycles[OP_INSERT] += get_cycles() - t;
+
+    t = get_cycles();
+    for (n = 0; n < nelems; ++n)
+    {
+        el = chained_find(hash, &keys[order[n]], key_sz);
+        assert(el);
+    }
+    cycles[OP_FIND] += get_cycles() - t;
+
+    t = get_cycles();
+    for (n = 0; n < nelems; ++n)
+    {
+        el = chained_find(hash, &keys[order[n]], key_sz);
+        chained_erase(hash, el);
+    }
+    cycles[OP_ERASE] += get_cycles() - t;
+
+    assert(0 == hash->ch_count);
+    chained_destroy(hash);
+}
+
+
+static void
+run_bench (unsigned nelems, unsigned n_iters)
+{
+    uint64_t *keys, open[N_OPS], chained[N_OPS];
+    uint64_t rnd;
+    unsigned *order;
+    unsigned n, op, idx, tmp;
+
+    keys = malloc(sizeof(keys[0]) * nelems);
+    rnd = 0x9E3779B97F4A7C15ULL;
+    for (n = 0; n < nelems; ++n)
+    {
+        rnd ^= rnd << 13;
+        rnd ^= rnd >> 7;
+        rnd ^= rnd << 17;
+        keys[n] = rnd;
+    }
+
+    order = malloc(sizeof(order[0]) * nelems);
+    for (n = 0; n < nelems; ++n)
+        order[n] = n;
+    for (n = nelems; n > 1; --n)
+    {
+        idx = keys[n - 1] % n;
+        tmp = order[n - 1];
+        order[n - 1] = order[idx];
+        order[idx] = tmp;
+    }
+
+    memset(open, 0, sizeof(open));
+    memset(chained, 0, sizeof(chained));
+    for (n = 0; n < n_iters; ++n)
+    {
+        bench_chained(keys, order, nelems, chained);
+        bench_open(keys, order, nelems, open);
+    }
+
+    printf("%u elements, %u iterations; %ss/operation:\n", nelems, n_iters,
+                                                                CYCLES_UNIT);
+    printf("%-8s %10s %10s\n", "", "chained", "open");
+    for (op = 0; op < N_OPS; ++op)
+        printf("%-8s %10.1f %10.1f\n", op_names[op],
+            (double) chained[op] / (double) nelems / (double) n_iters,
+            (double) open[op] / (double) nelems / (double) n_iters);
+
+    free(order);
+    free(keys);
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int opt, bench = 0;
+    unsigned nelems = 1000000, n_iters = 10;
+
+    while (-1 != (opt = getopt(argc, argv, "bi:n:")))
+    {
+        switch (opt)
+        {
+        case 'b':
+            bench = 1;
+            break;
+        case 'i':
+            n_iters = atoi(optarg);
+            break;
+        case 'n':
+            nelems = atoi(optarg);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-b] [-n elements] [-i iterations]\n",
+                                                                    argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (bench)
+    {
+        run_bench(nelems, n_iters);
+        exit(0);
+    }
+
+    test_basic(nelems);
+    test_erase_while_iterating();
+    test_long_keys();
+    test_churn();
 
     exit(0);
 }
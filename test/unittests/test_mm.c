@@ -0,0 +1,157 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+
+#include "lsquic_int_types.h"
+#include "lsquic_mm.h"
+
+
+static void
+test_watermarks (void)
+{
+    struct lsquic_mm mm;
+    const struct mm_pool_stats *stats;
+    void *bufs[10];
+    unsigned i;
+
+    lsquic_mm_init(&mm);
+    lsquic_mm_set_watermarks(&mm, MM_POOL_4K, 2, 5);
+    stats = lsquic_mm_pool_stats(&mm, MM_POOL_4K);
+
+    for (i = 0; i < 10; ++i)
+    {
+        bufs[i] = lsquic_mm_get_4k(&mm);
+        assert(bufs[i]);
+        memset(bufs[i], 'A', 0x1000);
+    }
+    assert(10 == stats->mps_in_use);
+    assert(0 == stats->mps_cached);
+    assert(10 == stats->mps_peak);
+
+    for (i = 0; i < 10; ++i)
+        lsquic_mm_put_4k(&mm, bufs[i]);
+    assert(0 == stats->mps_in_use);
+    assert(5 == stats->mps_cached);     /* High watermark */
+    assert(10 == stats->mps_peak);
+
+    /* Reuse cached buffers: peak does not change */
+    for (i = 0; i < 7; ++i)
+        bufs[i] = lsquic_mm_get_4k(&mm);
+    assert(7 == stats->mps_in_use);
+    assert(0 == stats->mps_cached);
+    assert(10 == stats->mps_peak);
+    for (i = 0; i < 7; ++i)
+        lsquic_mm_put_4k(&mm, bufs[i]);
+    assert(5 == stats->mps_cached);
+
+    /* Lowering the high watermark releases buffers right away */
+    lsquic_mm_set_watermarks(&mm, MM_POOL_4K, 1, 3);
+    assert(3 == stats->mps_cached);
+
+    /* Other pools are not affected */
+    assert(0 == lsquic_mm_pool_stats(&mm, MM_POOL_16K)->mps_peak);
+
+    lsquic_mm_cleanup(&mm);
+}
+
+
+static void
+test_periodic_trim (void)
+{
+    struct lsquic_mm mm;
+    const struct mm_pool_stats *stats;
+    void *bufs[20];
+    lsquic_time_t now;
+    size_t freed;
+    unsigned i;
+
+    lsquic_mm_init(&mm);
+    lsquic_mm_set_watermarks(&mm, MM_POOL_1370, 4, 100);
+    stats = lsquic_mm_pool_stats(&mm, MM_POOL_1370);
+
+    now = 1000000;
+    freed = lsquic_mm_maybe_trim(&mm, now);
+    assert(0 == freed);
+
+    for (i = 0; i < 20; ++i)
+        bufs[i] = lsquic_mm_get_1370(&mm);
+    for (i = 0; i < 20; ++i)
+        lsquic_mm_put_1370(&mm, bufs[i]);
+    assert(20 == stats->mps_cached);
+
+    /* Not time yet */
+    freed = lsquic_mm_maybe_trim(&mm, now + 1);
+    assert(0 == freed);
+
+    /* Buffers were just used: the first period only records the minimum */
+    now += 1000000;
+    freed = lsquic_mm_maybe_trim(&mm, now);
+    assert(0 == freed);
+    assert(20 == stats->mps_cached);
+
+    /* Use some buffers during this period: those are kept */
+    for (i = 0; i < 6; ++i)
+        bufs[i] = lsquic_mm_get_1370(&mm);
+    for (i = 0; i < 6; ++i)
+        lsquic_mm_put_1370(&mm, bufs[i]);
+
+    now += 1000000;
+    freed = lsquic_mm_maybe_trim(&mm, now);
+    assert(14 * 1370 == freed);
+    assert(6 == stats->mps_cached);
+
+    /* Nothing used: trim down to the low watermark */
+    now += 1000000;
+    freed = lsquic_mm_maybe_trim(&mm, now);
+    assert(2 * 1370 == freed);
+    assert(4 == stats->mps_cached);
+
+    now += 1000000;
+    freed = lsquic_mm_maybe_trim(&mm, now);
+    assert(0 == freed);
+    assert(4 == stats->mps_cached);
+
+    lsquic_mm_cleanup(&mm);
+}
+
+
+static void
+test_forced_trim (void)
+{
+    struct lsquic_mm mm;
+    void *bufs[10];
+    size_t freed, used_before;
+    unsigned i;
+
+    lsquic_mm_init(&mm);
+    lsquic_mm_set_watermarks(&mm, MM_POOL_16K, 3, 10);
+
+    for (i = 0; i < 10; ++i)
+        bufs[i] = lsquic_mm_get_16k(&mm);
+    for (i = 0; i < 10; ++i)
+        lsquic_mm_put_16k(&mm, bufs[i]);
+    assert(10 == lsquic_mm_pool_stats(&mm, MM_POOL_16K)->mps_cached);
+
+    used_before = lsquic_mm_mem_used(&mm);
+    freed = lsquic_mm_trim(&mm);
+    assert(7 * 0x4000 == freed);
+    assert(3 == lsquic_mm_pool_stats(&mm, MM_POOL_16K)->mps_cached);
+    assert(used_before - freed == lsquic_mm_mem_used(&mm));
+
+    freed = lsquic_mm_trim(&mm);
+    assert(0 == freed);
+
+    lsquic_mm_cleanup(&mm);
+}
+
+
+int
+main (void)
+{
+    test_watermarks();
+    test_periodic_trim();
+    test_forced_trim();
+    return 0;
+}
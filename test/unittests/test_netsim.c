@@ -0,0 +1,844 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_netsim.c -- Test the network simulator and use it to run transfers
+ * through the send controller.
+ *
+ * The transfer sender is a real send controller -- with cubic and the pacer
+ * -- that sends packets over a simulated link.  The receiver records them in
+ * a receive history and sends ACKs back over the reverse link.  Everything
+ * runs on virtual time, which makes the results exactly reproducible: the
+ * test checks this by running each transfer twice.
+ *
+ * Link options change the transfer parameters; -v prints the results.  For
+ * example, to see how the sender copes with 2% loss in bursts of three on a
+ * 100 Mbit/s link with 100 ms RTT:
+ *
+ *      test_netsim -v -b 12500000 -d 50 -l 20000 -B 3
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <getopt.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_alarmset.h"
+#include "lsquic_packet_common.h"
+#include "lsquic_packet_out.h"
+#include "lsquic_parse.h"
+#include "lsquic_conn_flow.h"
+#include "lsquic_rtt.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
+#include "lsquic_malo.h"
+#include "lsquic_mm.h"
+#include "lsquic_conn_public.h"
+#include "lsquic_conn.h"
+#include "lsquic_engine_public.h"
+#include "lsquic_cubic.h"
+#include "lsquic_pacer.h"
+#include "lsquic_senhist.h"
+#include "lsquic_send_ctl.h"
+#include "lsquic_ver_neg.h"
+#include "lsquic_packints.h"
+#include "lsquic_rechist.h"
+#include "lsquic_util.h"
+#include "lat_hist.h"
+#include "netsim.h"
+
+
+struct sink
+{
+    unsigned            n_packets;
+    lsquic_time_t       arrival[100];
+    unsigned            seqno[100];
+    struct netsim      *sim;
+};
+
+
+static void
+sink_deliver (void *ctx, const unsigned char *buf, size_t sz,
+            const struct sockaddr *local_sa, const struct sockaddr *peer_sa)
+{
+    struct sink *const sink = ctx;
+
+    if (sink->n_packets < sizeof(sink->seqno) / sizeof(sink->seqno[0]))
+    {
+        sink->arrival[sink->n_packets] = netsim_now(sink->sim);
+        memcpy(&sink->seqno[sink->n_packets], buf, sizeof(unsigned));
+    }
+    ++sink->n_packets;
+}
+
+
+static void
+send_seqno (struct netsim_link *link, unsigned seqno, size_t sz)
+{
+    unsigned char buf[1500];
+
+    assert(sz <= sizeof(buf) && sz >= sizeof(seqno));
+    memset(buf, 0, sz);
+    memcpy(buf, &seqno, sizeof(seqno));
+    assert(0 == netsim_link_send(link, buf, sz, NULL, NULL));
+}
+
+
+static void
+test_bandwidth_and_queue (void)
+{
+    struct netsim_link_params params;
+    struct netsim_link *link;
+    struct netsim *sim;
+    struct sink sink;
+    unsigned n;
+
+    memset(&params, 0, sizeof(params));
+    params.nlp_bandwidth = 1000000;
+    params.nlp_delay = 10000;
+    sim = netsim_new();
+    memset(&sink, 0, sizeof(sink));
+    sink.sim = sim;
+    link = netsim_link_new(sim, &params, sink_deliver, &sink);
+
+    /* Packets leave the bottleneck one transmission time apart */
+    for (n = 0; n < 10; ++n)
+        send_seqno(link, n, 1000);
+    assert(NETSIM_EPOCH + 10000 + 1000 == netsim_next_delivery(sim));
+    netsim_advance(sim, NETSIM_EPOCH + 10000 + 5000);
+    assert(5 == sink.n_packets);
+    assert(NETSIM_EPOCH + 10000 + 5000 == netsim_now(sim));
+    netsim_advance(sim, NETSIM_EPOCH + 100000);
+    assert(10 == sink.n_packets);
+    for (n = 0; n < 10; ++n)
+    {
+        assert(n == sink.seqno[n]);
+        assert(NETSIM_EPOCH + 10000 + (n + 1) * 1000 == sink.arrival[n]);
+    }
+    assert(0 == netsim_next_delivery(sim));
+
+    /* Transmission time that is not a whole number of microseconds does
+     * not add up rounding errors: 3 * 333.33... is 1000.
+     */
+    params.nlp_bandwidth = 3000000;
+    link = netsim_link_new(sim, &params, sink_deliver, &sink);
+    for (n = 0; n < 3; ++n)
+        send_seqno(link, n, 1000);
+    netsim_advance(sim, NETSIM_EPOCH + 200000);
+    assert(13 == sink.n_packets);
+    assert(NETSIM_EPOCH + 100000 + 10000 + 333 == sink.arrival[10]);
+    assert(NETSIM_EPOCH + 100000 + 10000 + 1000 == sink.arrival[12]);
+    netsim_destroy(sim);
+    params.nlp_bandwidth = 1000000;
+
+    /* Tail drop: 3000-byte queue holds three 1000-byte packets */
+    params.nlp_queue_size = 3000;
+    sim = netsim_new();
+    memset(&sink, 0, sizeof(sink));
+    sink.sim = sim;
+    link = netsim_link_new(sim, &params, sink_deliver, &sink);
+    for (n = 0; n < 10; ++n)
+        send_seqno(link, n, 1000);
+    assert(7 == netsim_link_stats(link)->nls_dropped_queue);
+    /* After 1.5 ms, backlog is 1500 bytes: only one more packet fits */
+    netsim_advance(sim, NETSIM_EPOCH + 1500);
+    send_seqno(link, 10, 1000);
+    send_seqno(link, 11, 1000);
+    assert(8 == netsim_link_stats(link)->nls_dropped_queue);
+    netsim_advance(sim, NETSIM_EPOCH + 100000);
+    assert(4 == sink.n_packets);
+    assert(0 == sink.seqno[0] && 1 == sink.seqno[1] && 2 == sink.seqno[2]
+                                                    && 10 == sink.seqno[3]);
+    assert(NETSIM_EPOCH + 10000 + 4000 == sink.arrival[3]);
+    assert(4 == netsim_link_stats(link)->nls_delivered);
+    assert(4000 == netsim_link_stats(link)->nls_bytes_delivered);
+    netsim_destroy(sim);
+}
+
+
+static void
+test_loss (void)
+{
+    struct netsim_link_params params;
+    const struct netsim_link_stats *stats;
+    struct netsim_link *link;
+    struct netsim *sim;
+    struct sink sink;
+    unsigned n;
+
+    /* Every fourth packet is dropped */
+    memset(&params, 0, sizeof(params));
+    params.nlp_loss_every = 4;
+    sim = netsim_new();
+    memset(&sink, 0, sizeof(sink));
+    sink.sim = sim;
+    link = netsim_link_new(sim, &params, sink_deliver, &sink);
+    for (n = 0; n < 100; ++n)
+        send_seqno(link, n, 100);
+    netsim_advance(sim, NETSIM_EPOCH + 1);
+    assert(75 == sink.n_packets);
+    for (n = 0; n < 75; ++n)
+        assert(sink.seqno[n] == n + n / 3);
+    assert(25 == netsim_link_stats(link)->nls_dropped_loss);
+    netsim_destroy(sim);
+
+    /* Random loss: 1% of 100,000 packets */
+    params.nlp_loss_every = 0;
+    params.nlp_loss_ppm = 10000;
+    sim = netsim_new();
+    memset(&sink, 0, sizeof(sink));
+    sink.sim = sim;
+    link = netsim_link_new(sim, &params, sink_deliver, &sink);
+    for (n = 0; n < 100000; ++n)
+    {
+        send_seqno(link, n, 100);
+        netsim_advance(sim, netsim_now(sim) + 1);
+    }
+    stats = netsim_link_stats(link);
+    assert(stats->nls_dropped_loss > 800 && stats->nls_dropped_loss < 1200);
+    assert(stats->nls_dropped_loss + stats->nls_delivered == 100000);
+    netsim_destroy(sim);
+}
+
+
+struct burst_sink
+{
+    unsigned            next_seqno;
+    unsigned            n_bursts;
+    unsigned            n_lost;
+};
+
+
+static void
+burst_sink_deliver (void *ctx, const unsigned char *buf, size_t sz,
+            const struct sockaddr *local_sa, const struct sockaddr *peer_sa)
+{
+    struct burst_sink *const sink = ctx;
+    unsigned seqno;
+
+    memcpy(&seqno, buf, sizeof(seqno));
+    if (seqno != sink->next_seqno)
+    {
+        ++sink->n_bursts;
+        sink->n_lost += seqno - sink->next_seqno;
+    }
+    sink->next_seqno = seqno + 1;
+}
+
+
+static void
+test_burst_loss (void)
+{
+    struct netsim_link_params params;
+    struct netsim_link *link;
+    struct netsim *sim;
+    struct burst_sink sink;
+    unsigned n;
+
+    memset(&params, 0, sizeof(params));
+    params.nlp_loss_ppm = 10000;
+    params.nlp_loss_burst = 5;
+    params.nlp_seed = 7;
+    sim = netsim_new();
+    memset(&sink, 0, sizeof(sink));
+    link = netsim_link_new(sim, &params, burst_sink_deliver, &sink);
+    for (n = 0; n < 100000; ++n)
+    {
+        send_seqno(link, n, 100);
+        netsim_advance(sim, netsim_now(sim) + 1);
+    }
+    assert(sink.n_lost == netsim_link_stats(link)->nls_dropped_loss);
+    assert(sink.n_lost > 600 && sink.n_lost < 1400);
+    /* Average burst length is five */
+    assert(sink.n_lost > sink.n_bursts * 4 && sink.n_lost < sink.n_bursts * 6);
+    netsim_destroy(sim);
+}
+
+
+static void
+test_jitter_and_reordering (void)
+{
+    struct netsim_link_params params;
+    struct netsim_link *link;
+    struct netsim *sim;
+    struct sink sink;
+    unsigned n, n_reordered;
+
+    /* Jitter alone does not reorder packets */
+    memset(&params, 0, sizeof(params));
+    params.nlp_delay = 10000;
+    params.nlp_jitter = 5000;
+    sim = netsim_new();
+    memset(&sink, 0, sizeof(sink));
+    sink.sim = sim;
+    link = netsim_link_new(sim, &params, sink_deliver, &sink);
+    for (n = 0; n < 100; ++n)
+    {
+        send_seqno(link, n, 100);
+        netsim_advance(sim, netsim_now(sim) + 1000);
+    }
+    netsim_advance(sim, netsim_now(sim) + 100000);
+    assert(100 == sink.n_packets);
+    for (n = 0; n < 100; ++n)
+    {
+        assert(n == sink.seqno[n]);
+        assert(sink.arrival[n] >= NETSIM_EPOCH + n * 1000 + 10000);
+        if (n > 0)
+            assert(sink.arrival[n] >= sink.arrival[n - 1]);
+    }
+    /* Arrival times are not all the same */
+    for (n = 1; n < 100; ++n)
+        if (sink.arrival[n] - sink.arrival[n - 1] != 1000)
+            break;
+    assert(n < 100);
+    netsim_destroy(sim);
+
+    /* Packets held back for 3 ms arrive after the next three packets */
+    params.nlp_jitter = 0;
+    params.nlp_reorder_ppm = 100000;
+    params.nlp_reorder_delay = 3000;
+    sim = netsim_new();
+    memset(&sink, 0, sizeof(sink));
+    sink.sim = sim;
+    link = netsim_link_new(sim, &params, sink_deliver, &sink);
+    for (n = 0; n < 100; ++n)
+    {
+        send_seqno(link, n, 100);
+        netsim_advance(sim, netsim_now(sim) + 1000);
+    }
+    netsim_advance(sim, netsim_now(sim) + 100000);
+    assert(100 == sink.n_packets);
+    n_reordered = 0;
+    for (n = 1; n < 100; ++n)
+        n_reordered += sink.seqno[n] < sink.seqno[n - 1];
+    assert(n_reordered > 0);
+    assert(netsim_link_stats(link)->nls_reordered > 0
+        && netsim_link_stats(link)->nls_reordered < 30);
+    netsim_destroy(sim);
+}
+
+
+/* Transfer through the send controller */
+
+struct xfer_params
+{
+    struct netsim_link_params   data_link, ack_link;
+    unsigned                    n_packets;
+    int                         pace;
+    unsigned                    ack_every;  /* ACK every N packets... */
+    lsquic_time_t               ack_delay;  /* ...or after this long */
+};
+
+
+struct xfer_result
+{
+    lsquic_time_t               elapsed;
+    unsigned long long          n_sent, n_retx;
+    lsquic_time_t               srtt, rttvar;
+    struct netsim_link_stats    data_stats, ack_stats;
+    struct lat_hist             owd;        /* One-way delay */
+};
+
+
+struct sender
+{
+    struct lsquic_conn          lconn;
+    struct lsquic_engine_public eng_pub;
+    struct lsquic_conn_public   conn_pub;
+    struct lsquic_send_ctl      send_ctl;
+    struct lsquic_alarmset      alset;
+    struct ver_neg              ver_neg;
+    struct netsim_link         *link;
+    unsigned                    next_seqno, n_packets;
+    unsigned long long          n_sent;
+    int                         got_bad_ack;
+};
+
+
+struct receiver
+{
+    struct lsquic_rechist       rechist;
+    struct netsim              *sim;
+    struct netsim_link         *link;
+    const struct xfer_params   *params;
+    struct xfer_result         *result;
+    unsigned char              *seen;
+    unsigned                    n_seen;
+    unsigned                    n_unacked;
+    lsquic_time_t               ack_time;   /* Delayed ACK due; 0 if none */
+    lsquic_time_t               done_time;
+    lsquic_packno_t             cutoff;
+};
+
+
+/* Data packet: packet number, smallest unacked -- our STOP_WAITING -- send
+ * time, and sequence number, padded to packet size.
+ */
+#define DATA_HDR_SZ (8 + 8 + 8 + 4)
+
+/* ACK packet: number of ranges, delta, and the ranges */
+#define MAX_ACK_RANGES (sizeof(((struct ack_info *) 0)->ranges) \
+                                / sizeof(((struct ack_info *) 0)->ranges[0]))
+
+
+static int
+sender_doesnt_write_ack (struct lsquic_conn *lconn)
+{
+    return 0;
+}
+
+
+static const struct conn_iface sender_conn_if =
+{
+    .ci_can_write_ack = sender_doesnt_write_ack,
+};
+
+
+static void
+sender_init (struct sender *sender, const struct xfer_params *params,
+                                                    struct netsim_link *link)
+{
+    memset(sender, 0, sizeof(*sender));
+    sender->lconn.cn_pf = select_pf_by_ver(LSQVER_039);
+    sender->lconn.cn_pack_size = 1370;
+    sender->lconn.cn_if = &sender_conn_if;
+    sender->lconn.cn_flags |= LSCONN_HANDSHAKE_DONE;
+    sender->eng_pub.enp_settings.es_pace_packets = params->pace;
+    lsquic_mm_init(&sender->eng_pub.enp_mm);
+    lsquic_alarmset_init(&sender->alset, 0);
+    sender->conn_pub.mm = &sender->eng_pub.enp_mm;
+    sender->conn_pub.lconn = &sender->lconn;
+    sender->conn_pub.enpub = &sender->eng_pub;
+    sender->conn_pub.send_ctl = &sender->send_ctl;
+    sender->conn_pub.packet_out_malo =
+                        lsquic_malo_create(sizeof(struct lsquic_packet_out));
+    lsquic_send_ctl_init(&sender->send_ctl, &sender->alset, &sender->eng_pub,
+        &sender->ver_neg, &sender->conn_pub, sender->lconn.cn_pack_size);
+    sender->link = link;
+    sender->n_packets = params->n_packets;
+}
+
+
+static void
+sender_cleanup (struct sender *sender)
+{
+    lsquic_send_ctl_cleanup(&sender->send_ctl);
+    lsquic_malo_destroy(sender->conn_pub.packet_out_malo);
+    lsquic_mm_cleanup(&sender->eng_pub.enp_mm);
+}
+
+
+/* Each packet carries a WINDOW_UPDATE frame, which is retransmittable, and
+ * padding.  The sequence number goes into the stream ID field: it stays the
+ * same when the packet is retransmitted.
+ */
+static void
+sender_schedule_new (struct sender *sender)
+{
+    struct lsquic_packet_out *packet_out;
+
+    packet_out = lsquic_send_ctl_new_packet_out(&sender->send_ctl, 0);
+    assert(packet_out);
+    packet_out->po_data[0] = 0x04;      /* WINDOW_UPDATE */
+    memcpy(packet_out->po_data + 1, &sender->next_seqno, 4);
+    memset(packet_out->po_data + 5, 0, 8);
+    packet_out->po_data_sz = 13;
+    packet_out->po_frame_types |= 1 << QUIC_FRAME_WINDOW_UPDATE;
+    memset(packet_out->po_data + packet_out->po_data_sz, 0,
+                                        lsquic_packet_out_avail(packet_out));
+    packet_out->po_data_sz += lsquic_packet_out_avail(packet_out);
+    lsquic_send_ctl_scheduled_one(&sender->send_ctl, packet_out);
+    ++sender->next_seqno;
+}
+
+
+static void
+sender_tick (struct sender *sender, lsquic_time_t now)
+{
+    struct lsquic_send_ctl *const ctl = &sender->send_ctl;
+    struct lsquic_conn *const lconn = &sender->lconn;
+    struct lsquic_packet_out *packet_out;
+    unsigned char buf[1500];
+    lsquic_packno_t packno, smallest_unacked;
+    size_t sz;
+
+    lsquic_alarmset_ring_expired(&sender->alset, now);
+    /* Not lsquic_send_ctl_tick(): it relies on the engine to schedule the
+     * next tick, while the transfer loop asks the pacer directly.
+     */
+    if (ctl->sc_flags & SC_PACE)
+        pacer_tick(&ctl->sc_pacer, now);
+    lsquic_send_ctl_reschedule_packets(ctl);
+    while (sender->next_seqno < sender->n_packets
+                                        && lsquic_send_ctl_can_send(ctl))
+        sender_schedule_new(sender);
+
+    while ((packet_out = lsquic_send_ctl_next_packet_to_send(ctl)))
+    {
+        sz = lsquic_packet_out_total_sz(lconn, packet_out);
+        assert(sz <= sizeof(buf) && sz >= DATA_HDR_SZ);
+        packno = packet_out->po_packno;
+        smallest_unacked = lsquic_send_ctl_smallest_unacked(ctl);
+        memcpy(buf, &packno, 8);
+        memcpy(buf + 8, &smallest_unacked, 8);
+        memcpy(buf + 16, &now, 8);
+        memcpy(buf + 24, packet_out->po_data + 1, 4);
+        memset(buf + DATA_HDR_SZ, 0, sz - DATA_HDR_SZ);
+        assert(0 == netsim_link_send(sender->link, buf, sz, NULL, NULL));
+        packet_out->po_sent = now;
+        lsquic_send_ctl_sent_packet(ctl, packet_out, 1);
+        ++sender->n_sent;
+    }
+}
+
+
+static lsquic_time_t
+sender_next_time (const struct sender *sender)
+{
+    lsquic_time_t alarm_time, pacer_time;
+
+    alarm_time = lsquic_alarmset_mintime(&sender->alset);
+    pacer_time = lsquic_send_ctl_next_pacer_time(&sender->send_ctl);
+    if (alarm_time && pacer_time)
+        return alarm_time < pacer_time ? alarm_time : pacer_time;
+    else
+        return alarm_time ? alarm_time : pacer_time;
+}
+
+
+static void
+sender_got_ack (void *ctx, const unsigned char *buf, size_t sz,
+            const struct sockaddr *local_sa, const struct sockaddr *peer_sa)
+{
+    struct sender *const sender = ctx;
+    static struct ack_info acki;
+    uint16_t n_ranges;
+    unsigned n;
+
+    memcpy(&n_ranges, buf, 2);
+    assert(n_ranges > 0 && n_ranges <= MAX_ACK_RANGES);
+    assert(sz == 2 + 8 + (size_t) n_ranges * 16);
+    acki.n_ranges = n_ranges;
+    memcpy(&acki.lack_delta, buf + 2, 8);
+    for (n = 0; n < n_ranges; ++n)
+    {
+        memcpy(&acki.ranges[n].high, buf + 10 + n * 16, 8);
+        memcpy(&acki.ranges[n].low, buf + 10 + n * 16 + 8, 8);
+    }
+    if (0 != lsquic_send_ctl_got_ack(&sender->send_ctl, &acki,
+                                                            lsquic_time_now()))
+        sender->got_bad_ack = 1;
+}
+
+
+static void
+receiver_send_ack (struct receiver *receiver, lsquic_time_t now)
+{
+    const struct lsquic_packno_range *range;
+    unsigned char buf[2 + 8 + MAX_ACK_RANGES * 16];
+    lsquic_time_t lack_delta;
+    uint16_t n_ranges;
+
+    /* Like a real ACK frame, leave out the oldest ranges if there are too
+     * many of them.
+     */
+    n_ranges = 0;
+    range = lsquic_rechist_first(&receiver->rechist);
+    while (range && n_ranges < MAX_ACK_RANGES)
+    {
+        memcpy(buf + 10 + n_ranges * 16, &range->high, 8);
+        memcpy(buf + 10 + n_ranges * 16 + 8, &range->low, 8);
+        ++n_ranges;
+        range = lsquic_rechist_next(&receiver->rechist);
+    }
+    assert(n_ranges > 0);
+    memcpy(buf, &n_ranges, 2);
+    lack_delta = now - lsquic_rechist_largest_recv(&receiver->rechist);
+    memcpy(buf + 2, &lack_delta, 8);
+    assert(0 == netsim_link_send(receiver->link, buf, 2 + 8 + n_ranges * 16,
+                                                                NULL, NULL));
+    receiver->n_unacked = 0;
+    receiver->ack_time = 0;
+}
+
+
+static void
+receiver_got_data (void *ctx, const unsigned char *buf, size_t sz,
+            const struct sockaddr *local_sa, const struct sockaddr *peer_sa)
+{
+    struct receiver *const receiver = ctx;
+    lsquic_packno_t packno, smallest_unacked;
+    lsquic_time_t now, sent;
+    unsigned seqno;
+
+    now = netsim_now(receiver->sim);
+    assert(sz >= DATA_HDR_SZ);
+    memcpy(&packno, buf, 8);
+    memcpy(&smallest_unacked, buf + 8, 8);
+    memcpy(&sent, buf + 16, 8);
+    memcpy(&seqno, buf + 24, 4);
+    assert(seqno < receiver->params->n_packets);
+
+    if (smallest_unacked > receiver->cutoff)
+    {
+        receiver->cutoff = smallest_unacked;
+        lsquic_rechist_stop_wait(&receiver->rechist, smallest_unacked);
+    }
+    if (REC_ST_OK != lsquic_rechist_received(&receiver->rechist, packno, now))
+        return;
+
+    lhist_record(&receiver->result->owd, now - sent);
+    if (!receiver->seen[seqno])
+    {
+        receiver->seen[seqno] = 1;
+        if (++receiver->n_seen == receiver->params->n_packets)
+            receiver->done_time = now;
+    }
+
+    if (++receiver->n_unacked >= receiver->params->ack_every)
+        receiver_send_ack(receiver, now);
+    else if (!receiver->ack_time)
+        receiver->ack_time = now + receiver->params->ack_delay;
+}
+
+
+static lsquic_time_t
+min_time (lsquic_time_t a, lsquic_time_t b)
+{
+    if (a && b)
+        return a < b ? a : b;
+    else
+        return a ? a : b;
+}
+
+
+static void
+run_xfer (const struct xfer_params *params, struct xfer_result *result)
+{
+    struct netsim *sim;
+    struct sender sender;
+    struct receiver receiver;
+    struct netsim_link *data_link, *ack_link;
+    lsquic_time_t now, next;
+
+    memset(result, 0, sizeof(*result));
+    lhist_init(&result->owd);
+
+    /* Set the clock first: the send controller reads it during init */
+    sim = netsim_new();
+    lsquic_time_set_clock(netsim_clock, sim);
+
+    memset(&receiver, 0, sizeof(receiver));
+    data_link = netsim_link_new(sim, &params->data_link, receiver_got_data,
+                                                                    &receiver);
+    ack_link = netsim_link_new(sim, &params->ack_link, sender_got_ack,
+                                                                    &sender);
+    sender_init(&sender, params, data_link);
+    lsquic_rechist_init(&receiver.rechist, 0);
+    receiver.sim = sim;
+    receiver.link = ack_link;
+    receiver.params = params;
+    receiver.result = result;
+    receiver.seen = calloc(params->n_packets, 1);
+    assert(receiver.seen);
+
+    while (!receiver.done_time)
+    {
+        now = netsim_now(sim);
+        if (receiver.ack_time && receiver.ack_time <= now)
+            receiver_send_ack(&receiver, now);
+        sender_tick(&sender, now);
+        assert(!sender.got_bad_ack);
+
+        next = min_time(sender_next_time(&sender), receiver.ack_time);
+        next = min_time(next, netsim_next_delivery(sim));
+        assert(next);       /* Otherwise, the transfer is stuck */
+        if (next <= now)
+            next = now + 1;
+        assert(next < NETSIM_EPOCH + 3600ull * 1000000);
+        netsim_advance(sim, next);
+    }
+
+    result->elapsed = receiver.done_time - NETSIM_EPOCH;
+    result->n_sent = sender.n_sent;
+    result->n_retx = sender.n_sent - params->n_packets;
+    result->srtt = lsquic_rtt_stats_get_srtt(&sender.conn_pub.rtt_stats);
+    result->rttvar = lsquic_rtt_stats_get_rttvar(&sender.conn_pub.rtt_stats);
+    result->data_stats = *netsim_link_stats(data_link);
+    result->ack_stats = *netsim_link_stats(ack_link);
+
+    free(receiver.seen);
+    lsquic_rechist_cleanup(&receiver.rechist);
+    sender_cleanup(&sender);
+    lsquic_time_set_clock(NULL, NULL);
+    netsim_destroy(sim);
+}
+
+
+static void
+print_result (const struct xfer_params *params,
+                                            const struct xfer_result *result)
+{
+    unsigned long long n_bytes;
+
+    n_bytes = (unsigned long long) params->n_packets * 1370;
+    printf("transferred %u packets in %.3f s: %.3f Mbit/s (link: %.3f Mbit/s)"
+        "\n", params->n_packets, (double) result->elapsed / 1000000,
+        (double) n_bytes * 8 / result->elapsed,
+        (double) params->data_link.nlp_bandwidth * 8 / 1000000);
+    printf("sent %llu packets, %llu retransmitted; dropped: %llu in queue, "
+        "%llu lost; reordered: %llu\n", result->n_sent, result->n_retx,
+        result->data_stats.nls_dropped_queue,
+        result->data_stats.nls_dropped_loss,
+        result->data_stats.nls_reordered);
+    printf("ACKs: sent %llu, delivered %llu\n", result->ack_stats.nls_sent,
+        result->ack_stats.nls_delivered);
+    printf("srtt: %.3f ms; rttvar: %.3f ms\n",
+        (double) result->srtt / 1000, (double) result->rttvar / 1000);
+    lhist_print(&result->owd, stdout, "one-way delay");
+}
+
+
+/* Returns transfer time */
+static lsquic_time_t
+test_xfer (const struct xfer_params *params, int verbose)
+{
+    struct xfer_result *results;
+    lsquic_time_t elapsed;
+
+    results = malloc(sizeof(results[0]) * 2);
+    assert(results);
+    run_xfer(params, &results[0]);
+    run_xfer(params, &results[1]);
+
+    assert(results[0].elapsed > 0);
+    assert(results[0].n_sent >= params->n_packets);
+    /* Virtual time makes transfers reproducible */
+    assert(0 == memcmp(&results[0], &results[1], sizeof(results[0])));
+
+    if (verbose)
+        print_result(params, &results[0]);
+    elapsed = results[0].elapsed;
+    free(results);
+    return elapsed;
+}
+
+
+static void
+init_xfer_params (struct xfer_params *params)
+{
+    memset(params, 0, sizeof(*params));
+    params->n_packets = 2000;
+    params->pace = 1;
+    params->ack_every = 2;
+    params->ack_delay = 25000;
+    /* 10 Mbit/s, 40 ms RTT, queue of one bandwidth-delay product */
+    params->data_link.nlp_bandwidth = 1250000;
+    params->data_link.nlp_delay = 20000;
+    params->data_link.nlp_queue_size = 50000;
+    params->ack_link.nlp_delay = 20000;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    struct xfer_params params;
+    lsquic_time_t elapsed;
+    int opt, verbose = 0, custom = 0;
+
+    init_xfer_params(&params);
+    while (-1 != (opt = getopt(argc, argv, "b:B:d:e:j:l:n:Pq:r:R:s:v")))
+    {
+        custom |= opt != 'v';
+        switch (opt)
+        {
+        case 'b':                   /* Bandwidth, bytes per second */
+            params.data_link.nlp_bandwidth = strtoull(optarg, NULL, 10);
+            break;
+        case 'B':                   /* Average loss burst length */
+            params.data_link.nlp_loss_burst = atoi(optarg);
+            break;
+        case 'd':                   /* One-way delay, milliseconds */
+            params.data_link.nlp_delay = atoi(optarg) * 1000;
+            params.ack_link.nlp_delay = atoi(optarg) * 1000;
+            break;
+        case 'e':                   /* Drop every Nth packet */
+            params.data_link.nlp_loss_every = atoi(optarg);
+            break;
+        case 'j':                   /* Jitter, milliseconds */
+            params.data_link.nlp_jitter = atoi(optarg) * 1000;
+            break;
+        case 'l':                   /* Loss, parts per million */
+            params.data_link.nlp_loss_ppm = atoi(optarg);
+            break;
+        case 'n':                   /* Number of packets to transfer */
+            params.n_packets = atoi(optarg);
+            break;
+        case 'P':                   /* Turn off pacing */
+            params.pace = 0;
+            break;
+        case 'q':                   /* Queue size, bytes */
+            params.data_link.nlp_queue_size = atoi(optarg);
+            break;
+        case 'r':                   /* Reordering, parts per million */
+            params.data_link.nlp_reorder_ppm = atoi(optarg);
+            break;
+        case 'R':                   /* Reordering delay, milliseconds */
+            params.data_link.nlp_reorder_delay = atoi(optarg) * 1000;
+            break;
+        case 's':                   /* Random number generator seed */
+            params.data_link.nlp_seed = strtoull(optarg, NULL, 10);
+            break;
+        case 'v':
+            verbose = 1;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-v] [-n packets] [-b bytes/sec] "
+                "[-d delay ms] [-j jitter ms] [-q queue bytes] "
+                "[-l loss ppm] [-B burst length] [-e drop every N] "
+                "[-r reorder ppm] [-R reorder delay ms] [-s seed] [-P]\n",
+                argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (custom)
+    {
+        test_xfer(&params, verbose);
+        return 0;
+    }
+
+    test_bandwidth_and_queue();
+    test_loss();
+    test_burst_loss();
+    test_jitter_and_reordering();
+
+    /* On a clean link, the sender should get close to the link bandwidth:
+     * the ideal transfer time here is 2.192 seconds.
+     */
+    elapsed = test_xfer(&params, verbose);
+    assert(elapsed < 2500000);
+
+    /* Lossy link: 1% loss in bursts of two, jitter, and reordering */
+    params.data_link.nlp_loss_ppm = 10000;
+    params.data_link.nlp_loss_burst = 2;
+    params.data_link.nlp_jitter = 2000;
+    params.data_link.nlp_reorder_ppm = 10000;
+    params.data_link.nlp_reorder_delay = 5000;
+    test_xfer(&params, verbose);
+
+    params.pace = 0;
+    test_xfer(&params, verbose);
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_packet_mem.c -- Benchmark packet allocation backends.
+ *
+ * Compare cycles per packet when packet_out objects and their payload
+ * buffers come from the heap and when they come from the arena (see
+ * es_mem_arena).  Each iteration allocates a window of packets and fills
+ * in their headers, like the send controller does, and then touches and
+ * releases them in random order, like ACK and loss processing does.  With
+ * many packets in flight, the second pass is dominated by TLB and cache
+ * misses.
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <getopt.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_int_types.h"
+#include "lsquic_packet_common.h"
+#include "lsquic_packet_out.h"
+#include "lsquic_mm.h"
+#include "test_cycles.h"
+
+
+static void
+shuffle (unsigned *order, unsigned count)
+{
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    unsigned i, j, tmp;
+
+    for (i = 0; i < count; ++i)
+        order[i] = i;
+    for (i = count - 1; i > 0; --i)
+    {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;    /* xorshift64 */
+        j = (unsigned) (x % (i + 1));
+        tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+}
+
+
+static uint64_t
+run (struct lsquic_mm *mm, struct lsquic_packet_out **packets,
+        const unsigned *order, unsigned n_packets, unsigned short size)
+{
+    struct lsquic_packet_out *packet_out;
+    uint64_t start, sum;
+    unsigned i;
+
+    start = get_cycles();
+
+    for (i = 0; i < n_packets; ++i)
+    {
+        packet_out = lsquic_mm_get_packet_out(mm, NULL, size);
+        assert(packet_out);
+        packet_out->po_packno = i;
+        packet_out->po_data_sz = size;
+        memset(packet_out->po_data, (unsigned char) i, 32);
+        packets[i] = packet_out;
+    }
+
+    sum = 0;
+    for (i = 0; i < n_packets; ++i)
+    {
+        packet_out = packets[ order[i] ];
+        sum += packet_out->po_packno + packet_out->po_data[0];
+        lsquic_mm_put_packet_out(mm, packet_out);
+    }
+
+    /* Make sure the compiler does not throw the reads away */
+    if (sum == 1)
+        puts("");
+
+    return get_cycles() - start;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int opt;
+    unsigned i, n_iters = 10, n_packets = 100000;
+    unsigned short size = 1350;
+    struct lsquic_mm mm;
+    struct lsquic_packet_out **packets;
+    unsigned *order;
+    uint64_t cycles[2];
+    static const char *const names[2] = { "heap", "arena", };
+    unsigned mode;
+
+    while (-1 != (opt = getopt(argc, argv, "n:p:s:")))
+    {
+        switch (opt)
+        {
+        case 'n':                   /* Number of iterations */
+            n_iters = atoi(optarg);
+            break;
+        case 'p':                   /* Number of packets in flight */
+            n_packets = atoi(optarg);
+            break;
+        case 's':                   /* Payload size */
+            size = atoi(optarg);
+            if (size > QUIC_MAX_PAYLOAD_SZ)
+                size = QUIC_MAX_PAYLOAD_SZ;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n iterations] [-p packets in flight] "
+                "[-s payload size]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (n_packets < 1)
+        n_packets = 1;
+
+    packets = malloc(n_packets * sizeof(packets[0]));
+    order = malloc(n_packets * sizeof(order[0]));
+    shuffle(order, n_packets);
+
+    for (mode = 0; mode < 2; ++mode)
+    {
+        if (0 != (mode ? lsquic_mm_init_arena(&mm) : lsquic_mm_init(&mm)))
+        {
+            fprintf(stderr, "cannot initialize %s memory manager\n",
+                                                                names[mode]);
+            exit(EXIT_FAILURE);
+        }
+        /* Let all buffers stay cached, like they would in a busy engine */
+        for (i = 0; i < MM_N_OUT_BUCKETS; ++i)
+            lsquic_mm_set_watermarks(&mm, MM_POOL_PACKET_OUT_0 + i, 0, ~0u);
+
+        /* Warm up: this also populates the free lists */
+        (void) run(&mm, packets, order, n_packets, size);
+
+        cycles[mode] = 0;
+        for (i = 0; i < n_iters; ++i)
+            cycles[mode] += run(&mm, packets, order, n_packets, size);
+
+        lsquic_mm_cleanup(&mm);
+    }
+
+    printf("%u iterations, %u packets in flight, %hu-byte payload\n",
+                                                n_iters, n_packets, size);
+    for (mode = 0; mode < 2; ++mode)
+        printf("%-6s %"PRIu64" %ss; %.1f %ss/packet\n",
+            names[mode], cycles[mode], CYCLES_UNIT,
+            (double) cycles[mode] / (double) n_packets / (double) n_iters,
+            CYCLES_UNIT);
+
+    free(packets);
+    free(order);
+    return 0;
+}
@@ -0,0 +1,422 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_seal.c -- Benchmark the engine's send path, in which packets of a
+ * batch are sealed connection by connection.
+ *
+ * Client connections created by a real engine talk to the fake server
+ * (see fake_server.h).  The fake crypto session's encrypt function is
+ * replaced with one that seals packets using AES-128-GCM, each connection
+ * with its own key.  In each iteration, every connection writes to its
+ * stream and lsquic_engine_process_conns() is timed; the server then
+ * acknowledges everything.  Time spent in the encrypt function itself is
+ * reported separately.
+ *
+ * The benchmark is run twice: first with batches of a single packet, so
+ * that each packet is sealed and sent before the next one is collected,
+ * and then with the batch size managed by the engine.  The batch size is
+ * fixed using LSQUIC_OUT_BATCH_SIZE environment variable, which is only
+ * looked at in debug builds.
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#else
+#include <Windows.h>
+#include <WinSock2.h>
+#include <ws2ipdef.h>
+#include <getopt.h>
+#endif
+
+#include <openssl/aead.h>
+#include <openssl/rand.h>
+
+#include "lsquic.h"
+#include "lsquic_int_types.h"
+#include "lsquic_types.h"
+#include "lsquic_crypto.h"
+#include "lsquic_str.h"
+#include "lsquic_handshake.h"
+#include "fake_server.h"
+#include "test_cycles.h"
+
+#define TAG_SZ 12
+#define MAX_CONNS 1000
+
+
+struct bench_conn
+{
+    EVP_AEAD_CTX        aead_ctx;
+    unsigned char       nonce[4];
+    lsquic_conn_t      *conn;
+    lsquic_stream_t    *stream;
+    size_t              to_write;
+};
+
+
+static struct bench
+{
+    struct bench_conn  *conns;
+    unsigned            n_conns,
+                        n_created;
+    lsquic_cid_t        first_cid;
+    const unsigned char *payload;
+    size_t              payload_sz;
+    struct fsrv        *srv;
+    unsigned long long  n_packets,
+                        n_bytes;
+    uint64_t            enc_cycles;
+} s_bench;
+
+
+/* Client packets carry the connection ID right after the flags byte.
+ * Connection IDs are generated sequentially by the fake session.
+ */
+static struct bench_conn *
+header2conn (const unsigned char *header)
+{
+    lsquic_cid_t cid;
+
+    memcpy(&cid, header + 1, sizeof(cid));
+    assert(cid - s_bench.first_cid < s_bench.n_conns);
+    return &s_bench.conns[ cid - s_bench.first_cid ];
+}
+
+
+static enum enc_level
+bench_encrypt (lsquic_enc_session_t *enc_session, enum lsquic_version version,
+               uint8_t path_id, uint64_t packno,
+               const unsigned char *header, size_t header_len,
+               const unsigned char *data, size_t data_len,
+               unsigned char *buf_out, size_t max_out_len, size_t *out_len,
+               int is_hello)
+{
+    struct bench_conn *const bconn = header2conn(header);
+    unsigned char nonce[12];
+    size_t enc_len;
+    uint64_t start;
+    int s;
+
+    if (header_len + data_len + TAG_SZ > max_out_len)
+        return (enum enc_level) -1;
+
+    start = get_cycles();
+    memcpy(nonce, bconn->nonce, 4);
+    memcpy(nonce + 4, &packno, 8);
+    memcpy(buf_out, header, header_len);
+    enc_len = max_out_len - header_len;
+    s = aes_aead_enc(&bconn->aead_ctx, header, header_len, nonce,
+            sizeof(nonce), data, data_len, buf_out + header_len, &enc_len);
+    s_bench.enc_cycles += get_cycles() - start;
+    if (s != 0)
+        return (enum enc_level) -1;
+
+    *out_len = header_len + enc_len;
+    if (lsquic_enc_session_gquic_1.esf_is_hsk_done(enc_session))
+        return ENC_LEV_FORW;
+    else
+        return ENC_LEV_CLEAR;
+}
+
+
+static int
+bench_packets_out (void *ctx, const struct lsquic_out_spec *specs,
+                                                                unsigned count)
+{
+    unsigned n;
+
+    for (n = 0; n < count; ++n)
+        s_bench.n_bytes += specs[n].sz;
+    s_bench.n_packets += count;
+    return fsrv_packets_out(ctx, specs, count);
+}
+
+
+static lsquic_conn_ctx_t *
+on_new_conn (void *stream_if_ctx, lsquic_conn_t *conn)
+{
+    struct bench_conn *bconn;
+
+    if (0 == s_bench.n_created)
+        s_bench.first_cid = lsquic_conn_id(conn);
+    assert(lsquic_conn_id(conn) - s_bench.first_cid == s_bench.n_created);
+    bconn = &s_bench.conns[ s_bench.n_created++ ];
+    bconn->conn = conn;
+    return (lsquic_conn_ctx_t *) bconn;
+}
+
+
+static void
+on_conn_closed (lsquic_conn_t *conn)
+{
+    struct bench_conn *const bconn = (void *) lsquic_conn_get_ctx(conn);
+    bconn->conn = NULL;
+    lsquic_conn_set_ctx(conn, NULL);
+}
+
+
+static lsquic_stream_ctx_t *
+on_new_stream (void *stream_if_ctx, lsquic_stream_t *stream)
+{
+    struct bench_conn *const bconn
+            = (void *) lsquic_conn_get_ctx(lsquic_stream_conn(stream));
+    bconn->stream = stream;
+    return (lsquic_stream_ctx_t *) bconn;
+}
+
+
+static void
+on_write (lsquic_stream_t *stream, lsquic_stream_ctx_t *h)
+{
+    struct bench_conn *const bconn = (void *) h;
+    ssize_t nw;
+
+    while (bconn->to_write > 0)
+    {
+        nw = lsquic_stream_write(stream, s_bench.payload,
+                bconn->to_write < s_bench.payload_sz
+                                ? bconn->to_write : s_bench.payload_sz);
+        assert(nw >= 0);
+        if (nw == 0)
+            return;
+        bconn->to_write -= nw;
+    }
+    lsquic_stream_wantwrite(stream, 0);
+    lsquic_stream_flush(stream);
+}
+
+
+static void
+on_read (lsquic_stream_t *stream, lsquic_stream_ctx_t *h)
+{
+    lsquic_stream_wantread(stream, 0);
+}
+
+
+static void
+on_close (lsquic_stream_t *stream, lsquic_stream_ctx_t *h)
+{
+    struct bench_conn *const bconn = (void *) h;
+    bconn->stream = NULL;
+}
+
+
+static const struct lsquic_stream_if stream_if = {
+    .on_new_conn            = on_new_conn,
+    .on_conn_closed         = on_conn_closed,
+    .on_new_stream          = on_new_stream,
+    .on_read                = on_read,
+    .on_write               = on_write,
+    .on_close               = on_close,
+};
+
+
+/* Returns number of cycles spent in lsquic_engine_process_conns() */
+static uint64_t
+run_bench (unsigned n_iters, size_t write_sz)
+{
+    unsigned i, j;
+    struct lsquic_engine_settings settings;
+    struct lsquic_engine_api api;
+    struct sockaddr_in local_sa, peer_sa;
+    lsquic_engine_t *engine;
+    lsquic_conn_t *conn;
+    unsigned long long n_packets, n_bytes;
+    uint64_t start, cycles;
+
+    s_bench.n_created = 0;
+    for (i = 0; i < s_bench.n_conns; ++i)
+    {
+        s_bench.conns[i].conn = NULL;
+        s_bench.conns[i].stream = NULL;
+        s_bench.conns[i].to_write = 0;
+    }
+
+    s_bench.srv = fsrv_new();
+    lsquic_engine_init_settings(&settings, 0);
+    settings.es_versions = 1 << LSQVER_039;
+    settings.es_pace_packets = 0;
+    memset(&api, 0, sizeof(api));
+    api.ea_settings = &settings;
+    api.ea_stream_if = &stream_if;
+    api.ea_packets_out = bench_packets_out;
+    api.ea_packets_out_ctx = s_bench.srv;
+    engine = lsquic_engine_new(0, &api);
+    assert(engine);
+    fsrv_set_engine(s_bench.srv, engine);
+
+    memset(&local_sa, 0, sizeof(local_sa));
+    local_sa.sin_family = AF_INET;
+    local_sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    peer_sa = local_sa;
+    peer_sa.sin_port = htons(443);
+    for (i = 0; i < s_bench.n_conns; ++i)
+    {
+        /* Local addresses must differ, as the engine looks up client
+         * connections by address.
+         */
+        local_sa.sin_port = htons(10000 + i);
+        conn = lsquic_engine_connect(engine, (struct sockaddr *) &local_sa,
+                        (struct sockaddr *) &peer_sa, NULL, NULL, "localhost",
+                        0);
+        assert(conn);
+        lsquic_conn_make_stream(conn);
+    }
+
+    /* Handshake */
+    lsquic_engine_process_conns(engine);
+    fsrv_respond(s_bench.srv);
+    lsquic_engine_process_conns(engine);
+    for (i = 0; i < s_bench.n_conns; ++i)
+        assert(s_bench.conns[i].stream);
+
+    cycles = 0;
+    s_bench.n_packets = 0;
+    s_bench.n_bytes = 0;
+    s_bench.enc_cycles = 0;
+    for (i = 0; i < n_iters; ++i)
+    {
+        for (j = 0; j < s_bench.n_conns; ++j)
+        {
+            s_bench.conns[j].to_write = write_sz;
+            lsquic_stream_wantwrite(s_bench.conns[j].stream, 1);
+        }
+        start = get_cycles();
+        lsquic_engine_process_conns(engine);
+        cycles += get_cycles() - start;
+        n_packets = s_bench.n_packets;
+        n_bytes = s_bench.n_bytes;
+        fsrv_respond(s_bench.srv);
+        lsquic_engine_process_conns(engine);
+        /* Do not count ACKs sent in response to the server */
+        s_bench.n_packets = n_packets;
+        s_bench.n_bytes = n_bytes;
+    }
+
+    lsquic_engine_destroy(engine);
+    fsrv_destroy(s_bench.srv);
+    s_bench.srv = NULL;
+    return cycles;
+}
+
+
+static void
+set_batch_size (const char *batch_size)
+{
+#ifndef WIN32
+    if (batch_size)
+        setenv("LSQUIC_OUT_BATCH_SIZE", batch_size, 1);
+    else
+        unsetenv("LSQUIC_OUT_BATCH_SIZE");
+#else
+    _putenv_s("LSQUIC_OUT_BATCH_SIZE", batch_size ? batch_size : "");
+#endif
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int opt;
+    unsigned i, mode, n_iters = 50, n_conns = 32;
+    size_t write_sz = 8 * 1024;
+    unsigned char key[16];
+    unsigned char *payload;
+    unsigned long long n_packets[2], n_bytes[2];
+    uint64_t cycles[2], enc_cycles[2];
+    static const char *const names[2] = { "single", "batched", };
+    static const char *const batch_sizes[2] = { "1", NULL, };
+
+    while (-1 != (opt = getopt(argc, argv, "c:n:s:")))
+    {
+        switch (opt)
+        {
+        case 'c':                   /* Number of connections */
+            n_conns = atoi(optarg);
+            if (n_conns < 1 || n_conns > MAX_CONNS)
+            {
+                fprintf(stderr, "number of connections must be 1 "
+                                                "through %u\n", MAX_CONNS);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'n':                   /* Number of iterations */
+            n_iters = atoi(optarg);
+            break;
+        case 's':                   /* Bytes written per iteration */
+            write_sz = atoi(optarg);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-c n conns] [-n iterations] "
+                "[-s bytes per connection per iteration]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    /* The fake server does not open flow control windows */
+    if ((unsigned long long) write_sz * n_iters > FSRV_SFCW
+            || (unsigned long long) write_sz * n_iters > FSRV_CFCW)
+    {
+        fprintf(stderr, "cannot write more than %u bytes per connection\n",
+                                                                FSRV_SFCW);
+        exit(EXIT_FAILURE);
+    }
+
+    if (0 != lsquic_global_init(LSQUIC_GLOBAL_CLIENT))
+        exit(EXIT_FAILURE);
+    fsrv_install();
+    lsquic_enc_session_gquic_1.esf_encrypt = bench_encrypt;
+
+    s_bench.n_conns = n_conns;
+    s_bench.conns = calloc(n_conns, sizeof(s_bench.conns[0]));
+    for (i = 0; i < n_conns; ++i)
+    {
+        RAND_bytes(key, sizeof(key));
+        RAND_bytes(s_bench.conns[i].nonce, sizeof(s_bench.conns[i].nonce));
+        EVP_AEAD_CTX_init(&s_bench.conns[i].aead_ctx, EVP_aead_aes_128_gcm(),
+                                            key, sizeof(key), TAG_SZ, NULL);
+    }
+    s_bench.payload_sz = 0x1000;
+    payload = malloc(s_bench.payload_sz);
+    RAND_bytes(payload, s_bench.payload_sz);
+    s_bench.payload = payload;
+
+    for (mode = 0; mode < 2; ++mode)
+    {
+        set_batch_size(batch_sizes[mode]);
+        cycles[mode] = run_bench(n_iters, write_sz);
+        n_packets[mode] = s_bench.n_packets;
+        n_bytes[mode] = s_bench.n_bytes;
+        enc_cycles[mode] = s_bench.enc_cycles;
+    }
+    set_batch_size(NULL);
+
+    printf("%u iterations, %u connections, %zu bytes per connection per "
+        "iteration\n", n_iters, n_conns, write_sz);
+    for (mode = 0; mode < 2; ++mode)
+        printf("%-8s %llu packets, %llu bytes; %"PRIu64" %ss; %.3f bytes/%s; "
+            "%.1f %ss/packet, of which encrypting: %.1f\n", names[mode],
+            n_packets[mode], n_bytes[mode], cycles[mode], CYCLES_UNIT,
+            (double) n_bytes[mode] / (double) (cycles[mode] ? cycles[mode] : 1),
+            CYCLES_UNIT,
+            (double) cycles[mode]
+                        / (double) (n_packets[mode] ? n_packets[mode] : 1),
+            CYCLES_UNIT,
+            (double) enc_cycles[mode]
+                        / (double) (n_packets[mode] ? n_packets[mode] : 1));
+
+    for (i = 0; i < n_conns; ++i)
+        EVP_AEAD_CTX_cleanup(&s_bench.conns[i].aead_ctx);
+    free(s_bench.conns);
+    free(payload);
+    lsquic_global_cleanup();
+    return 0;
+}
@@ -72,6 +72,8 @@ test_lsquic_set32 (void)
     for (i = 1000; i < 2000; ++i)
         assert(("Value is in the set", lsquic_set32_has(&set, i)));
 
+    assert(lsquic_set32_mem_used(&set) > sizeof(set));
+
     lsquic_set32_cleanup(&set);
 }
 
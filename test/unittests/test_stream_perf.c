@@ -0,0 +1,282 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+/*
+ * test_stream_perf.c -- Benchmark stream creation and teardown.
+ *
+ * Each request creates a stream, writes a short request into the stream's
+ * send buffer, receives a short response with FIN, reads it, and destroys
+ * the stream.  Up to `concurrency' requests are in progress at the same
+ * time.  Streams and their send buffers come from the engine's memory
+ * manager, so in steady state no calls to the system allocator should be
+ * needed for them.
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/queue.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <getopt.h>
+#endif
+
+#include "lsquic.h"
+#include "lsquic_types.h"
+#include "lsquic_int_types.h"
+#include "lsquic_alarmset.h"
+#include "lsquic_packet_common.h"
+#include "lsquic_packet_in.h"
+#include "lsquic_packet_out.h"
+#include "lsquic_parse.h"
+#include "lsquic_conn_flow.h"
+#include "lsquic_rtt.h"
+#include "lsquic_sfcw.h"
+#include "lsquic_stream.h"
+#include "lsquic_malo.h"
+#include "lsquic_mm.h"
+#include "lsquic_conn_public.h"
+#include "lsquic_conn.h"
+#include "lsquic_engine_public.h"
+#include "lsquic_cubic.h"
+#include "lsquic_pacer.h"
+#include "lsquic_senhist.h"
+#include "lsquic_send_ctl.h"
+#include "lsquic_ver_neg.h"
+#include "lsquic_util.h"
+#include "test_cycles.h"
+
+
+struct test_objs {
+    struct lsquic_conn          lconn;
+    struct lsquic_engine_public eng_pub;
+    struct lsquic_conn_public   conn_pub;
+    struct lsquic_send_ctl      send_ctl;
+    struct lsquic_alarmset      alset;
+    struct ver_neg              ver_neg;
+};
+
+
+static lsquic_stream_ctx_t *
+on_new_stream (void *stream_if_ctx, lsquic_stream_t *stream)
+{
+    return NULL;
+}
+
+
+static void
+on_close (lsquic_stream_t *stream, lsquic_stream_ctx_t *st_h)
+{
+}
+
+
+static const struct lsquic_stream_if stream_if = {
+    .on_new_stream          = on_new_stream,
+    .on_close               = on_close,
+};
+
+
+/* There is no engine: connection is not added to the tickable queue */
+void
+lsquic_engine_add_conn_to_tickable (struct lsquic_engine_public *enpub,
+                                    lsquic_conn_t *conn)
+{
+}
+
+
+static int
+unit_test_doesnt_write_ack (struct lsquic_conn *lconn)
+{
+    return 0;
+}
+
+
+static const struct conn_iface our_conn_if =
+{
+    .ci_can_write_ack = unit_test_doesnt_write_ack,
+};
+
+
+static void
+init_test_objs (struct test_objs *tobjs)
+{
+    memset(tobjs, 0, sizeof(*tobjs));
+    tobjs->lconn.cn_pf = select_pf_by_ver(LSQVER_039);
+    tobjs->lconn.cn_pack_size = 1370;
+    tobjs->lconn.cn_if = &our_conn_if;
+    lsquic_mm_init(&tobjs->eng_pub.enp_mm);
+    TAILQ_INIT(&tobjs->conn_pub.sending_streams);
+    TAILQ_INIT(&tobjs->conn_pub.read_streams);
+    TAILQ_INIT(&tobjs->conn_pub.write_streams);
+    TAILQ_INIT(&tobjs->conn_pub.service_streams);
+    /* Connection windows are large enough never to run out */
+    lsquic_cfcw_init(&tobjs->conn_pub.cfcw, &tobjs->conn_pub, 0x40000000);
+    lsquic_conn_cap_init(&tobjs->conn_pub.conn_cap, 0x40000000);
+    lsquic_alarmset_init(&tobjs->alset, 0);
+    tobjs->conn_pub.mm = &tobjs->eng_pub.enp_mm;
+    tobjs->conn_pub.lconn = &tobjs->lconn;
+    tobjs->conn_pub.enpub = &tobjs->eng_pub;
+    tobjs->conn_pub.send_ctl = &tobjs->send_ctl;
+    tobjs->conn_pub.packet_out_malo =
+                        lsquic_malo_create(sizeof(struct lsquic_packet_out));
+    lsquic_send_ctl_init(&tobjs->send_ctl, &tobjs->alset, &tobjs->eng_pub,
+        &tobjs->ver_neg, &tobjs->conn_pub, tobjs->lconn.cn_pack_size);
+}
+
+
+static void
+deinit_test_objs (struct test_objs *tobjs)
+{
+    lsquic_send_ctl_cleanup(&tobjs->send_ctl);
+    lsquic_malo_destroy(tobjs->conn_pub.packet_out_malo);
+    lsquic_mm_cleanup(&tobjs->eng_pub.enp_mm);
+}
+
+
+/* The response arrives in a single packet */
+static stream_frame_t *
+new_frame_in (struct test_objs *tobjs, size_t sz)
+{
+    lsquic_packet_in_t *packet_in;
+    stream_frame_t *frame;
+
+    packet_in = lsquic_mm_get_packet_in(&tobjs->eng_pub.enp_mm);
+    packet_in->pi_data = lsquic_mm_get_1370(&tobjs->eng_pub.enp_mm);
+    packet_in->pi_flags |= PI_OWN_DATA;
+    memset(packet_in->pi_data, 'R', sz);
+    packet_in->pi_data_sz = sz;
+    packet_in->pi_refcnt = 1;
+
+    frame = lsquic_malo_get(tobjs->eng_pub.enp_mm.malo.stream_frame);
+    memset(frame, 0, sizeof(*frame));
+    frame->packet_in = packet_in;
+    frame->data_frame.df_offset = 0;
+    frame->data_frame.df_size = sz;
+    frame->data_frame.df_data = &packet_in->pi_data[0];
+    frame->data_frame.df_fin  = 1;
+
+    return frame;
+}
+
+
+static uint64_t
+run (struct test_objs *tobjs, struct lsquic_stream **streams,
+        unsigned n_requests, unsigned concurrency, size_t req_sz,
+        size_t resp_sz, uint32_t *stream_id)
+{
+    unsigned char req[1000], resp[1000];
+    uint64_t start;
+    unsigned done, n, i;
+    ssize_t nw, nr;
+    int s;
+
+    memset(req, 'Q', req_sz);
+    start = get_cycles();
+
+    for (done = 0; done < n_requests; done += n)
+    {
+        n = n_requests - done;
+        if (n > concurrency)
+            n = concurrency;
+        for (i = 0; i < n; ++i)
+        {
+            streams[i] = lsquic_stream_new_ext(*stream_id, &tobjs->conn_pub,
+                            &stream_if, NULL, 0, 0, SCF_CALL_ON_NEW);
+            assert(streams[i]);
+            *stream_id += 2;
+            nw = lsquic_stream_write(streams[i], req, req_sz);
+            assert(nw == (ssize_t) req_sz);
+            (void) nw;
+        }
+        for (i = 0; i < n; ++i)
+        {
+            s = lsquic_stream_frame_in(streams[i], new_frame_in(tobjs,
+                                                                resp_sz));
+            assert(0 == s);
+            nr = lsquic_stream_read(streams[i], resp, sizeof(resp));
+            assert(nr == (ssize_t) resp_sz);
+            (void) nr;
+            (void) s;
+        }
+        for (i = 0; i < n; ++i)
+            lsquic_stream_destroy(streams[i]);
+    }
+
+    return get_cycles() - start;
+}
+
+
+int
+main (int argc, char **argv)
+{
+    int opt;
+    unsigned i, n_iters = 10, n_requests = 100000, concurrency = 100;
+    size_t req_sz = 100, resp_sz = 500;
+    struct test_objs tobjs;
+    struct lsquic_stream **streams;
+    uint32_t stream_id = 5;     /* Skip handshake and headers streams */
+    uint64_t cycles;
+    lsquic_time_t t0, t1;
+
+    while (-1 != (opt = getopt(argc, argv, "c:n:r:q:s:")))
+    {
+        switch (opt)
+        {
+        case 'c':                   /* Number of concurrent requests */
+            concurrency = atoi(optarg);
+            break;
+        case 'n':                   /* Number of iterations */
+            n_iters = atoi(optarg);
+            break;
+        case 'r':                   /* Number of requests per iteration */
+            n_requests = atoi(optarg);
+            break;
+        case 'q':                   /* Request size */
+            req_sz = atoi(optarg);
+            break;
+        case 's':                   /* Response size */
+            resp_sz = atoi(optarg);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n iterations] [-r requests] "
+                "[-c concurrency] [-q request size] [-s response size]\n",
+                argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (concurrency < 1)
+        concurrency = 1;
+    if (req_sz < 1 || req_sz > 1000)
+        req_sz = 100;
+    if (resp_sz < 1 || resp_sz > 1000)
+        resp_sz = 500;
+
+    streams = malloc(concurrency * sizeof(streams[0]));
+    init_test_objs(&tobjs);
+
+    /* Warm up: this also populates malo pages and free lists */
+    (void) run(&tobjs, streams, concurrency, concurrency, req_sz, resp_sz,
+                                                                &stream_id);
+
+    cycles = 0;
+    t0 = lsquic_time_now();
+    for (i = 0; i < n_iters; ++i)
+        cycles += run(&tobjs, streams, n_requests, concurrency, req_sz,
+                                                        resp_sz, &stream_id);
+    t1 = lsquic_time_now();
+
+    printf("%u iterations, %u requests, %u concurrent, %zu-byte requests, "
+        "%zu-byte responses\n", n_iters, n_requests, concurrency, req_sz,
+        resp_sz);
+    printf("%"PRIu64" %ss; %.1f %ss/request; %.0f requests/sec\n", cycles,
+        CYCLES_UNIT, (double) cycles / (double) n_requests / (double) n_iters,
+        CYCLES_UNIT, (double) n_requests * n_iters * 1000000
+                                        / (double) (t1 - t0 ? t1 - t0 : 1));
+
+    deinit_test_objs(&tobjs);
+    free(streams);
+    return 0;
+}
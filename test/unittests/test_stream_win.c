@@ -0,0 +1,201 @@
+/* Copyright (c) 2017 - 2019 LiteSpeed Technologies Inc.  See LICENSE. */
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lsquic_stream_win.h"
+
+
+/* Streams are never dereferenced: any unique pointer will do */
+static char streams[4 * SW_MAX_SLOTS];
+#define STREAM(id) ((struct lsquic_stream *) &streams[id])
+
+
+static void
+test_sequential (void)
+{
+    struct lsquic_stream_win win;
+    uint32_t id;
+
+    lsquic_stream_win_init(&win);
+    assert(NULL == lsquic_stream_win_find(&win, 5));
+
+    for (id = 5; id < 5 + 2 * 100; id += 2)
+        assert(0 == lsquic_stream_win_insert(&win, id, STREAM(id)));
+    assert(100 == lsquic_stream_win_count(&win));
+    assert(128 == win.sw_n_slots);
+    for (id = 5; id < 5 + 2 * 100; id += 2)
+        assert(STREAM(id) == lsquic_stream_win_find(&win, id));
+    assert(NULL == lsquic_stream_win_find(&win, 3));
+    assert(NULL == lsquic_stream_win_find(&win, 5 + 2 * 100));
+
+    /* Removing streams at the bottom slides the window */
+    for (id = 5; id < 5 + 2 * 50; id += 2)
+        lsquic_stream_win_remove(&win, id, STREAM(id));
+    assert(50 == lsquic_stream_win_count(&win));
+    assert(5 + 2 * 50 == win.sw_base);
+    for (id = 5; id < 5 + 2 * 50; id += 2)
+        assert(NULL == lsquic_stream_win_find(&win, id));
+
+    /* New streams reuse freed slots without growing the window */
+    for (id = 5 + 2 * 100; id < 5 + 2 * 150; id += 2)
+        assert(0 == lsquic_stream_win_insert(&win, id, STREAM(id)));
+    assert(128 == win.sw_n_slots);
+    for (id = 5 + 2 * 50; id < 5 + 2 * 150; id += 2)
+        assert(STREAM(id) == lsquic_stream_win_find(&win, id));
+
+    /* Remove all: window restarts at the next stream */
+    for (id = 5 + 2 * 50; id < 5 + 2 * 150; id += 2)
+        lsquic_stream_win_remove(&win, id, STREAM(id));
+    assert(0 == lsquic_stream_win_count(&win));
+    assert(0 == lsquic_stream_win_insert(&win, 1001, STREAM(1001)));
+    assert(1001 == win.sw_base);
+    assert(STREAM(1001) == lsquic_stream_win_find(&win, 1001));
+
+    lsquic_stream_win_cleanup(&win);
+}
+
+
+static void
+test_out_of_order (void)
+{
+    struct lsquic_stream_win win;
+    uint32_t id;
+
+    lsquic_stream_win_init(&win);
+
+    /* Removal from the middle leaves the base alone */
+    assert(0 == lsquic_stream_win_insert(&win, 2, STREAM(2)));
+    assert(0 == lsquic_stream_win_insert(&win, 4, STREAM(4)));
+    assert(0 == lsquic_stream_win_insert(&win, 8, STREAM(8)));
+    lsquic_stream_win_remove(&win, 4, STREAM(4));
+    assert(2 == win.sw_base);
+    lsquic_stream_win_remove(&win, 2, STREAM(2));
+    assert(8 == win.sw_base);
+    assert(STREAM(8) == lsquic_stream_win_find(&win, 8));
+
+    /* Stream below the base fits if the top of the window is free */
+    assert(0 == lsquic_stream_win_insert(&win, 6, STREAM(6)));
+    assert(6 == win.sw_base);
+    assert(STREAM(6) == lsquic_stream_win_find(&win, 6));
+    assert(STREAM(8) == lsquic_stream_win_find(&win, 8));
+
+    /* Removing stream that is not in the window is a no-op */
+    lsquic_stream_win_remove(&win, 4, STREAM(4));
+    lsquic_stream_win_remove(&win, 10, STREAM(10));
+    assert(2 == lsquic_stream_win_count(&win));
+
+    /* The window grows up to SW_MAX_SLOTS */
+    id = 6 + 2 * (SW_MAX_SLOTS - 1);
+    assert(0 == lsquic_stream_win_insert(&win, id, STREAM(id)));
+    assert(SW_MAX_SLOTS == win.sw_n_slots);
+    assert(STREAM(id) == lsquic_stream_win_find(&win, id));
+    /* Streams below the base do not fit when the window is full */
+    assert(-1 == lsquic_stream_win_insert(&win, 4, STREAM(4)));
+    assert(NULL == lsquic_stream_win_find(&win, 4));
+
+    /* Stream beyond the top of the full window pushes the streams at the
+     * bottom out of it
+     */
+    assert(0 == lsquic_stream_win_insert(&win, id + 2, STREAM(id + 2)));
+    assert(SW_MAX_SLOTS == win.sw_n_slots);
+    assert(3 == lsquic_stream_win_count(&win));
+    assert(8 == win.sw_base);
+    assert(NULL == lsquic_stream_win_find(&win, 6));
+    assert(STREAM(8) == lsquic_stream_win_find(&win, 8));
+    assert(STREAM(id) == lsquic_stream_win_find(&win, id));
+    assert(STREAM(id + 2) == lsquic_stream_win_find(&win, id + 2));
+    /* Removing a stream that was dropped is a no-op */
+    lsquic_stream_win_remove(&win, 6, STREAM(6));
+    assert(3 == lsquic_stream_win_count(&win));
+
+    lsquic_stream_win_cleanup(&win);
+}
+
+
+static void
+test_wraparound (void)
+{
+    struct lsquic_stream_win win;
+    uint32_t id, low;
+    unsigned i;
+
+    lsquic_stream_win_init(&win);
+
+    /* Keep about ten streams open while the window slides through the
+     * ring many times.
+     */
+    low = 1;
+    for (id = 1, i = 0; i < 2000; ++i, id += 2)
+    {
+        assert(0 == lsquic_stream_win_insert(&win, id,
+                                        STREAM(id % sizeof(streams))));
+        if (lsquic_stream_win_count(&win) > 10)
+        {
+            lsquic_stream_win_remove(&win, low,
+                                        STREAM(low % sizeof(streams)));
+            low += 2;
+        }
+        assert(STREAM(id % sizeof(streams))
+                                    == lsquic_stream_win_find(&win, id));
+        assert(STREAM(low % sizeof(streams))
+                                    == lsquic_stream_win_find(&win, low));
+    }
+    assert(SW_MIN_SLOTS == win.sw_n_slots);
+    assert(low == win.sw_base);
+
+    lsquic_stream_win_cleanup(&win);
+}
+
+
+/* Streams 1 and 3 stay open while thousands of later streams open and
+ * close.  Once the window is full, they are dropped from it and the
+ * window keeps sliding: every stream goes in.
+ */
+static void
+test_long_lived (void)
+{
+    struct lsquic_stream_win win;
+    uint32_t id, low;
+    unsigned i;
+
+    lsquic_stream_win_init(&win);
+    assert(0 == lsquic_stream_win_insert(&win, 1, STREAM(1)));
+    assert(0 == lsquic_stream_win_insert(&win, 3, STREAM(3)));
+
+    low = 5;
+    for (id = 5, i = 0; i < 5000; ++i, id += 2)
+    {
+        assert(0 == lsquic_stream_win_insert(&win, id,
+                                        STREAM(id % sizeof(streams))));
+        if (id - low >= 2 * 10)
+        {
+            lsquic_stream_win_remove(&win, low,
+                                        STREAM(low % sizeof(streams)));
+            low += 2;
+        }
+        assert(STREAM(id % sizeof(streams))
+                                    == lsquic_stream_win_find(&win, id));
+        assert(STREAM(low % sizeof(streams))
+                                    == lsquic_stream_win_find(&win, low));
+        assert(win.sw_n_slots <= SW_MAX_SLOTS);
+    }
+    assert(NULL == lsquic_stream_win_find(&win, 1));
+    assert(NULL == lsquic_stream_win_find(&win, 3));
+    assert(low == win.sw_base);
+    assert(10 == lsquic_stream_win_count(&win));
+
+    lsquic_stream_win_cleanup(&win);
+}
+
+
+int
+main (void)
+{
+    test_sequential();
+    test_out_of_order();
+    test_wraparound();
+    test_long_lived();
+    return 0;
+}